@@ -613,6 +613,96 @@ const SpeciesRecord& SpeciesDataOfBand(const AbsorptionLines& band)
   return global_data::species_data[band.Species()];
 }
 
+/** Sets sum to the cross-section of a band at a single pressure level
+ *
+ * This is the per-level body shared by xsec_species and xsec_species_tiled.
+ * The band's CompiledLines and the sorted frequency grid are shared by all
+ * levels.
+ */
+static void xsec_band_at_level(Linefunctions::InternalData& scratch,
+                               Linefunctions::InternalData& sum,
+                               const ArrayOfRetrievalQuantity& jacobian_quantities,
+                               const ArrayOfIndex& jacobian_propmat_positions,
+                               const Vector& f_grid,
+                               const Numeric& pressure,
+                               const Numeric& temperature,
+                               const EnergyLevelMap& nlte,
+                               const ConstVectorView vmrs,
+                               const ArrayOfArrayOfSpeciesTag& abs_species,
+                               const AbsorptionLines& band,
+                               const std::vector<Numeric>& f_grid_sorted,
+                               const Numeric& isot_ratio,
+                               const SpeciesAuxData::AuxType& partfun_type,
+                               const ArrayOfGriddedField1& partfun_data,
+                               const Numeric& QT0,
+                               const Numeric& dT) {
+  // Constants for this level
+  const Numeric QT =
+      single_partition_function(temperature, partfun_type, partfun_data);
+  const Numeric dQTdT = dsingle_partition_function_dT(
+      QT,
+      temperature,
+      dT,
+      partfun_type,
+      partfun_data);
+  const Numeric DC =
+      Linefunctions::DopplerConstant(temperature, band.SpeciesMass());
+  const Numeric dDCdT = Linefunctions::dDopplerConstant_dT(temperature, DC);
+  const Vector line_shape_vmr = band.BroadeningSpeciesVMR(vmrs, abs_species);
+
+  Linefunctions::set_cross_section_of_band(scratch,
+                                           sum,
+                                           f_grid,
+                                           band,
+                                           jacobian_quantities,
+                                           jacobian_propmat_positions,
+                                           line_shape_vmr,
+                                           nlte,
+                                           pressure,
+                                           temperature,
+                                           isot_ratio,
+                                           0,
+                                           DC,
+                                           dDCdT,
+                                           QT,
+                                           dQTdT,
+                                           QT0,
+                                           false,
+                                           false,
+                                           Zeeman::Polarization::Pi,
+                                           f_grid_sorted);
+}
+
+/** Adds the cross-section of one level to column ip of the outputs */
+static void add_xsec_at_level(Matrix& xsec,
+                              Matrix& source,
+                              Matrix& phase,
+                              ArrayOfMatrix& dxsec_dx,
+                              ArrayOfMatrix& dsource_dx,
+                              ArrayOfMatrix& dphase_dx,
+                              const Linefunctions::InternalData& sum,
+                              const Index nj,
+                              const Index ip) {
+  // absorption cross-section
+  MapToEigen(xsec).col(ip).noalias() += sum.F.real();
+  for (Index j = 0; j < nj; j++)
+    MapToEigen(dxsec_dx[j]).col(ip).noalias() += sum.dF.col(j).real();
+
+  // phase cross-section
+  if (not phase.empty()) {
+    MapToEigen(phase).col(ip).noalias() += sum.F.imag();
+    for (Index j = 0; j < nj; j++)
+      MapToEigen(dphase_dx[j]).col(ip).noalias() += sum.dF.col(j).imag();
+  }
+
+  // source ratio cross-section
+  if (not source.empty()) {
+    MapToEigen(source).col(ip).noalias() += sum.N.real();
+    for (Index j = 0; j < nj; j++)
+      MapToEigen(dsource_dx[j]).col(ip).noalias() += sum.dN.col(j).real();
+  }
+}
+
 void xsec_species(Matrix& xsec,
                   Matrix& source,
                   Matrix& phase,
@@ -630,17 +720,14 @@ void xsec_species(Matrix& xsec,
                   const AbsorptionLines& band,
                   const Numeric& isot_ratio,
                   const SpeciesAuxData::AuxType& partfun_type,
-                  const ArrayOfGriddedField1& partfun_data) {
+                  const ArrayOfGriddedField1& partfun_data,
+                  const std::vector<Numeric>& f_grid_sorted) {
   // Size of problem
   const Index np = abs_p.nelem();      // number of pressure levels
   const Index nf = f_grid.nelem();     // number of Dirac frequencies
   const Index nl = band.NumLines();  // number of lines in the catalog
   const Index nj =
       jacobian_propmat_positions.nelem();  // number of partial derivatives
-  const Index nt = source.nrows();         // number of energy levels in NLTE
-
-  // Type of problem
-  const bool do_nonlte = nt;
 
   Linefunctions::InternalData scratch(nf, nj);
   Linefunctions::InternalData sum(nf, nj);
@@ -651,6 +738,11 @@ void xsec_species(Matrix& xsec,
   // Constant for all lines
   const Numeric QT0 = single_partition_function(band.T0(), partfun_type, partfun_data);
   const Numeric dT = temperature_perturbation(jacobian_quantities);
+  const std::vector<Numeric> f_sorted_here =
+      f_grid_sorted.empty() ? Linefunctions::sorted_frequency_grid(f_grid)
+                            : std::vector<Numeric>();
+  const std::vector<Numeric>& f_sorted =
+      f_grid_sorted.empty() ? f_sorted_here : f_grid_sorted;
 
   ArrayOfString fail_msg;
   bool do_abort = false;
@@ -660,62 +752,26 @@ void xsec_species(Matrix& xsec,
   for (Index ip = 0; ip < np; ip++) {
     if (do_abort) continue;
     try {
-      // Constants for this level
-      const Numeric& temperature = abs_t[ip];
-      const Numeric& pressure = abs_p[ip];
-
-      // Constants for this level
-      const Numeric QT =
-          single_partition_function(temperature, partfun_type, partfun_data);
-      const Numeric dQTdT = dsingle_partition_function_dT(
-          QT,
-          temperature,
-          dT,
-          partfun_type,
-          partfun_data);
-      const Numeric DC =
-          Linefunctions::DopplerConstant(temperature, band.SpeciesMass());
-      const Numeric dDCdT = Linefunctions::dDopplerConstant_dT(temperature, DC);
-      const Vector line_shape_vmr =
-          band.BroadeningSpeciesVMR(abs_vmrs(joker, ip), abs_species);
-
-      Linefunctions::set_cross_section_of_band(scratch,
-                                               sum,
-                                               f_grid,
-                                               band,
-                                               jacobian_quantities,
-                                               jacobian_propmat_positions,
-                                               line_shape_vmr,
-                                               abs_nlte[ip],
-                                               pressure,
-                                               temperature,
-                                               isot_ratio,
-                                               0,
-                                               DC,
-                                               dDCdT,
-                                               QT,
-                                               dQTdT,
-                                               QT0,
-                                               false);
-
-      // absorption cross-section
-      MapToEigen(xsec).col(ip).noalias() += sum.F.real();
-      for (Index j = 0; j < nj; j++)
-        MapToEigen(dxsec_dx[j]).col(ip).noalias() += sum.dF.col(j).real();
-
-      // phase cross-section
-      if (not phase.empty()) {
-        MapToEigen(phase).col(ip).noalias() += sum.F.imag();
-        for (Index j = 0; j < nj; j++)
-          MapToEigen(dphase_dx[j]).col(ip).noalias() += sum.dF.col(j).imag();
-      }
-
-      // source ratio cross-section
-      if (do_nonlte) {
-        MapToEigen(source).col(ip).noalias() += sum.N.real();
-        for (Index j = 0; j < nj; j++)
-          MapToEigen(dsource_dx[j]).col(ip).noalias() += sum.dN.col(j).real();
-      }
+      xsec_band_at_level(scratch,
+                         sum,
+                         jacobian_quantities,
+                         jacobian_propmat_positions,
+                         f_grid,
+                         abs_p[ip],
+                         abs_t[ip],
+                         abs_nlte[ip],
+                         abs_vmrs(joker, ip),
+                         abs_species,
+                         band,
+                         f_sorted,
+                         isot_ratio,
+                         partfun_type,
+                         partfun_data,
+                         QT0,
+                         dT);
+
+      add_xsec_at_level(
+          xsec, source, phase, dxsec_dx, dsource_dx, dphase_dx, sum, nj, ip);
     } catch (const std::runtime_error& e) {
       ostringstream os;
       os << "Runtime-error in cross-section calculation at p_abs index " << ip
@@ -738,3 +794,133 @@ void xsec_species(Matrix& xsec,
     throw std::runtime_error(os.str());
   }
 }
+
+void xsec_species_tiled(ArrayOfMatrix& xsec,
+                        ArrayOfMatrix& source,
+                        ArrayOfArrayOfMatrix& dxsec_dx,
+                        ArrayOfArrayOfMatrix& dsource_dx,
+                        const ArrayOfRetrievalQuantity& jacobian_quantities,
+                        const ArrayOfIndex& jacobian_propmat_positions,
+                        const Vector& f_grid,
+                        const Vector& abs_p,
+                        const Vector& abs_t,
+                        const EnergyLevelMap& abs_nlte,
+                        const Matrix& abs_vmrs,
+                        const ArrayOfArrayOfSpeciesTag& abs_species,
+                        const ArrayOfIndex& species,
+                        const ArrayOfArrayOfAbsorptionLines& abs_lines_per_species,
+                        const SpeciesAuxData& isotopologue_ratios,
+                        const SpeciesAuxData& partition_functions) {
+  // Size of problem
+  const Index np = abs_p.nelem();      // number of pressure levels
+  const Index nf = f_grid.nelem();     // number of Dirac frequencies
+  const Index nj =
+      jacobian_propmat_positions.nelem();  // number of partial derivatives
+
+  // Work list in the same (species, band, level) order as the serial path
+  struct Tile {
+    Index ispec;
+    Index iband;
+    Index ip;
+  };
+  std::vector<Tile> tiles;
+  for (const Index i : species)
+    for (Index ib = 0; ib < abs_lines_per_species[i].nelem(); ib++)
+      if (abs_lines_per_species[i][ib].NumLines())
+        for (Index ip = 0; ip < np; ip++) tiles.push_back({i, ib, ip});
+
+  const Index ntiles = Index(tiles.size());
+  if (not nf or not ntiles) return;
+
+  // The frequency grid sorted once for all tiles
+  const std::vector<Numeric> f_sorted =
+      Linefunctions::sorted_frequency_grid(f_grid);
+
+  const Numeric dT = temperature_perturbation(jacobian_quantities);
+
+  Linefunctions::InternalData scratch(nf, nj);
+  Linefunctions::InternalData sum(nf, nj);
+
+  // No phase output from this path
+  Matrix phase(0, 0);
+  ArrayOfMatrix dphase_dx(0);
+
+  ArrayOfString fail_msg;
+  bool do_abort = false;
+
+  // Tiles are computed in any order but added to the output in tile order,
+  // so the summation over bands is bitwise identical to the serial path
+#pragma omp parallel for schedule(dynamic, 1) ordered \
+    if (!arts_omp_in_parallel() && ntiles > 1) \
+    firstprivate(scratch, sum, phase, dphase_dx)
+  for (Index it = 0; it < ntiles; it++) {
+    const Tile& tile = tiles[it];
+    const AbsorptionLines& band = abs_lines_per_species[tile.ispec][tile.iband];
+
+    bool ok = not do_abort;
+    if (ok) {
+      try {
+        const auto partfun_type =
+            partition_functions.getParamType(band.QuantumIdentity());
+        const auto& partfun_data =
+            partition_functions.getParam(band.QuantumIdentity());
+        const Numeric QT0 =
+            single_partition_function(band.T0(), partfun_type, partfun_data);
+
+        xsec_band_at_level(
+            scratch,
+            sum,
+            jacobian_quantities,
+            jacobian_propmat_positions,
+            f_grid,
+            abs_p[tile.ip],
+            abs_t[tile.ip],
+            abs_nlte[tile.ip],
+            abs_vmrs(joker, tile.ip),
+            abs_species,
+            band,
+            f_sorted,
+            isotopologue_ratios.getIsotopologueRatio(band.QuantumIdentity()),
+            partfun_type,
+            partfun_data,
+            QT0,
+            dT);
+      } catch (const std::runtime_error& e) {
+        ok = false;
+        ostringstream os;
+        os << "Runtime-error in cross-section calculation of tag group "
+           << tile.ispec << ", band " << tile.iband << " at p_abs index "
+           << tile.ip << ": \n";
+        os << e.what();
+#pragma omp critical(xsec_species_tiled_cross_sections)
+        {
+          do_abort = true;
+          fail_msg.push_back(os.str());
+        }
+      }
+    }
+
+#pragma omp ordered
+    {
+      if (ok)
+        add_xsec_at_level(xsec[tile.ispec],
+                          source[tile.ispec],
+                          phase,
+                          dxsec_dx[tile.ispec],
+                          dsource_dx[tile.ispec],
+                          dphase_dx,
+                          sum,
+                          nj,
+                          tile.ip);
+    }
+  }
+
+  if (do_abort) {
+    std::ostringstream os;
+    os << "Error messages from failed cases:\n";
+    for (const auto& msg : fail_msg) {
+      os << msg << '\n';
+    }
+    throw std::runtime_error(os.str());
+  }
+}
@@ -397,6 +397,7 @@ void set_vmr_from_first_species(Vector& vmr,
  *  @param[in] isot_ratio Isotopologue ratio of this species
  *  @param[in] partfun_type Partition function type for this species
  *  @param[in] partfun_data Partition function model data for this species
+ *  @param[in] f_grid_sorted f_grid in increasing order, as from Linefunctions::sorted_frequency_grid.  If empty, it is sorted here when needed
  * 
  *  @author Richard Larsson
  *  @date   2019-10-10
@@ -418,7 +419,51 @@ void xsec_species(Matrix& xsec,
                   const AbsorptionLines& band,
                   const Numeric& isot_ratio,
                   const SpeciesAuxData::AuxType& partfun_type,
-                  const ArrayOfGriddedField1& partfun_data);
+                  const ArrayOfGriddedField1& partfun_data,
+                  const std::vector<Numeric>& f_grid_sorted={});
+
+/** Cross-section algorithm scheduled over species, bands and levels
+ * 
+ * Computes the same cross-sections as calling xsec_species for every band
+ * of the selected tag groups, but distributes all (tag group, band, level)
+ * combinations over the threads instead of only the pressure levels.  This
+ * keeps the threads busy when there are only few pressure levels.  The
+ * bands are added to the output in the same order as in the serial loop
+ * so the results are bitwise identical to it.
+ * 
+ *  @param[in,out] xsec Cross section per tag group.
+ *  @param[in,out] source Source cross section per tag group.
+ *  @param[in,out] dxsec_dx Partial derivatives of xsec per tag group.
+ *  @param[in,out] dsource_dx Partial derivatives of source per tag group.
+ *  @param[in] jacobian_quantities As WSV
+ *  @param[in] jacobian_propmat_positions Positions in jacobian_quantities affected by propmat calculations
+ *  @param[in] f_grid As WSV
+ *  @param[in] abs_p As WSV
+ *  @param[in] abs_t As WSV
+ *  @param[in] abs_nlte As WSV
+ *  @param[in] abs_vmrs As WSV
+ *  @param[in] abs_species As WSV
+ *  @param[in] species Tag groups to compute
+ *  @param[in] abs_lines_per_species As WSV
+ *  @param[in] isotopologue_ratios As WSV
+ *  @param[in] partition_functions As WSV
+ */
+void xsec_species_tiled(ArrayOfMatrix& xsec,
+                        ArrayOfMatrix& source,
+                        ArrayOfArrayOfMatrix& dxsec_dx,
+                        ArrayOfArrayOfMatrix& dsource_dx,
+                        const ArrayOfRetrievalQuantity& jacobian_quantities,
+                        const ArrayOfIndex& jacobian_propmat_positions,
+                        const Vector& f_grid,
+                        const Vector& abs_p,
+                        const Vector& abs_t,
+                        const EnergyLevelMap& abs_nlte,
+                        const Matrix& abs_vmrs,
+                        const ArrayOfArrayOfSpeciesTag& abs_species,
+                        const ArrayOfIndex& species,
+                        const ArrayOfArrayOfAbsorptionLines& abs_lines_per_species,
+                        const SpeciesAuxData& isotopologue_ratios,
+                        const SpeciesAuxData& partition_functions);
 
 /** Returns the species data
  * 
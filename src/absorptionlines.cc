@@ -31,10 +31,13 @@
 
 #include "absorptionlines.h"
 
+#include <numeric>
+
 #include "absorption.h"
 #include "constants.h"
 #include "file.h"
 #include "global_data.h"
+#include "linescaling.h"
 #include "quantum_parser_hitran.h"
 
 Rational Absorption::Lines::LowerQuantumNumber(size_t k, QuantumNumberType qnt) const noexcept {
@@ -77,6 +80,95 @@ LineShape::Output Absorption::Lines::ShapeParameters(size_t k, Numeric T, Numeri
   return mlines[k].LineShape().GetParams(T, mT0, P, m);
 }
 
+Absorption::CompiledLines::CompiledLines(const Lines& band)
+    : mnlines(band.NumLines()), mnspec(band.BroadeningSpecies().size()) {
+  const Index nl = mnlines;
+  mf0.resize(nl);
+  mi0.resize(nl);
+  me0.resize(nl);
+  mglow.resize(nl);
+  mgupp.resize(nl);
+  for (Index i=0; i<nl; i++) {
+    mf0[i] = band.F0(i);
+    mi0[i] = band.I0(i);
+    me0[i] = band.E0(i);
+    mglow[i] = band.g_low(i);
+    mgupp[i] = band.g_upp(i);
+  }
+  
+  for (auto& x: mshape)
+    x.resize(nl * mnspec);
+  
+  for (Index i=0; i<nl; i++) {
+    const auto& data = band.Line(i).LineShape().Data();
+    for (Index k=0; k<Index(data.size()) and k<mnspec; k++)
+      for (Index v=0; v<LineShape::nVars; v++)
+        mshape[v][k * nl + i] = data[k].Data()[v];
+  }
+  
+  mbyfrequency.resize(nl);
+  std::iota(mbyfrequency.begin(), mbyfrequency.end(), Index(0));
+  std::stable_sort(mbyfrequency.begin(), mbyfrequency.end(),
+                   [this](Index a, Index b){return mf0[a] < mf0[b];});
+}
+
+void Absorption::CompiledLines::LineStrengths(std::vector<Numeric>& S,
+                                              Numeric T,
+                                              Numeric T0,
+                                              Numeric isotopic_ratio,
+                                              Numeric QT,
+                                              Numeric QT0) const {
+  const Index nl = NumLines();
+  const Numeric invQT = 1.0 / QT;
+  S.resize(nl);
+  
+  // Same operations in the same order as apply_linestrength_scaling_by_lte
+  for (Index i=0; i<nl; i++) {
+    const Numeric K1 = boltzman_ratio(T, T0, me0[i]);
+    const Numeric K2 = stimulated_relative_emission(
+      stimulated_emission(T, mf0[i]), stimulated_emission(T0, mf0[i]));
+    S[i] = mi0[i] * isotopic_ratio * QT0 * invQT * K1 * K2;
+  }
+}
+
+void Absorption::CompiledLines::ShapeParameters(std::vector<LineShape::Output>& X,
+                                                const Lines& band,
+                                                Numeric T,
+                                                Numeric P,
+                                                const Vector& vmrs) const {
+  // Variables in the order of LineShape::Variable, and their pressure scaling
+  constexpr Numeric LineShape::Output::* var[LineShape::nVars] = {
+    &LineShape::Output::G0, &LineShape::Output::D0, &LineShape::Output::G2,
+    &LineShape::Output::D2, &LineShape::Output::FVC, &LineShape::Output::ETA,
+    &LineShape::Output::Y, &LineShape::Output::G, &LineShape::Output::DV};
+  const Numeric scale[LineShape::nVars] = {P, P, P, P, P, 1, P, P * P, P * P};
+  
+  const Index nl = NumLines();
+  const Index nspec = std::min(mnspec, vmrs.nelem());
+  const Numeric T0 = band.T0();
+  X.resize(nl);
+  
+  // Sum over broadening species in the same order as
+  // LineShape::Model::GetParams, so that the results are the same
+  for (Index v=0; v<LineShape::nVars; v++) {
+    const auto x = var[v];
+    for (Index i=0; i<nl; i++)
+      X[i].*x = 0;
+    for (Index k=0; k<nspec; k++) {
+      const Numeric vmr = vmrs[k];
+      const LineShape::ModelParameters* mp = mshape[v].data() + k * nl;
+      for (Index i=0; i<nl; i++)
+        X[i].*x += vmr * LineShape::SingleSpeciesModel::compute(mp[i], T, T0);
+    }
+    for (Index i=0; i<nl; i++)
+      X[i].*x = scale[v] * X[i].*x;
+  }
+  
+  if (not band.DoLineMixing(P))
+    for (auto& x: X)
+      x.Y = x.G = x.DV = 0;
+}
+
 LineShape::Output Absorption::Lines::ShapeParameters_dT(size_t k, Numeric T, Numeric P, const Vector& vmrs) const noexcept {
   auto x = mlines[k].LineShape().GetTemperatureDerivs(T, mT0, P, vmrs);
   
@@ -2438,9 +2530,11 @@ Absorption::SingleLineExternal Absorption::ReadFromLBLRTMStream(istream& is) {
 
 std::vector<Absorption::Lines> Absorption::split_list_of_external_lines(std::vector<SingleLineExternal>& external_lines,
                                                                         const std::vector<QuantumNumberType>& localquantas,
-                                                                        const std::vector<QuantumNumberType>& globalquantas)
+                                                                        const std::vector<QuantumNumberType>& globalquantas,
+                                                                        std::vector<std::size_t>* last_lines)
 {
   std::vector<Lines> lines(0);
+  if (last_lines) last_lines->resize(0);
   std::vector<Rational> lowerquanta_local(localquantas.size());
   std::vector<Rational> upperquanta_local(localquantas.size());
   std::vector<Rational> lowerquanta_global(globalquantas.size());
@@ -2478,6 +2572,7 @@ std::vector<Absorption::Lines> Absorption::split_list_of_external_lines(std::vec
                             sle.mirroring, sle.population, sle.normalization,
                             sle.lineshapetype, sle.T0, sle.cutofffreq,
                             sle.linemixinglimit, qid, localquantas, sle.species, {line}));
+      if (last_lines) last_lines->push_back(external_lines.size() - 1);
     }
     external_lines.pop_back();
   }
@@ -2680,6 +2775,7 @@ bool Absorption::SingleLine::SameQuantumNumbers(const Absorption::SingleLine& sl
 
 void Absorption::Lines::RemoveLine(Index i) noexcept
 {
+  mcompiled.reset();
   mlines.erase(mlines.begin() + i);
 }
 
@@ -2702,6 +2798,7 @@ Absorption::Lines Absorption::createEmptyCopy(const Absorption::Lines& al) noexc
 
 Absorption::SingleLine& Absorption::Lines::Line(Index i) noexcept
 {
+  mcompiled.reset();
   return mlines[i];
 }
 
@@ -2711,8 +2808,21 @@ const Absorption::SingleLine& Absorption::Lines::Line(Index i) const noexcept
   return mlines[i];
 }
 
+std::shared_ptr<const Absorption::CompiledLines> Absorption::Lines::Compiled() const
+{
+  // Threads that get here at the same time may all compile the band, the
+  // last one to store it wins.  The copies are identical.
+  auto compiled = std::atomic_load(&mcompiled);
+  if (not compiled) {
+    compiled = std::make_shared<const CompiledLines>(*this);
+    std::atomic_store(&mcompiled, compiled);
+  }
+  return compiled;
+}
+
 void Absorption::Lines::ReverseLines() noexcept
 {
+  mcompiled.reset();
   std::reverse(mlines.begin(), mlines.end());
 }
 
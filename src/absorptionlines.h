@@ -32,6 +32,7 @@
 #ifndef absorptionlines_h
 #define absorptionlines_h
 
+#include <memory>
 #include <vector>
 #include "bifstream.h"
 #include "bofstream.h"
@@ -552,6 +553,8 @@ struct SingleLineExternal {
   SingleLine line;
 };
 
+class CompiledLines;
+
 class Lines {
 private:
   /** Does the line broadening have self broadening */
@@ -596,6 +599,13 @@ private:
   /** A list of individual lines */
   std::vector<SingleLine> mlines;
   
+  /** The lines as CompiledLines, built on first use by Compiled()
+   * 
+   * Reset by every non-const access that can change what is compiled.
+   * Copies of the band share it.
+   */
+  mutable std::shared_ptr<const CompiledLines> mcompiled;
+  
 public:
   /** Default initialization
    * 
@@ -714,6 +724,7 @@ public:
        sl.LineShapeElems() not_eq mlines[0].LineShapeElems())
       throw std::runtime_error("Error calling appending function, bad size of broadening species");
     
+    mcompiled.reset();
     mlines.push_back(std::move(sl));
   }
   
@@ -738,6 +749,7 @@ public:
        sl.LineShapeElems() not_eq mlines[0].LineShapeElems())
       throw std::runtime_error("Error calling appending function, bad size of broadening species");
     
+    mcompiled.reset();
     mlines.push_back(sl);
   }
   
@@ -819,12 +831,14 @@ public:
   
   /** Sort inner line list by frequency */
   void sort_by_frequency() {
+    mcompiled.reset();
     std::sort(mlines.begin(), mlines.end(),
               [](const SingleLine& a, const SingleLine& b){return a.F0() < b.F0();});
   }
   
   /** Sort inner line list by Einstein coefficient */
   void sort_by_einstein() {
+    mcompiled.reset();
     std::sort(mlines.begin(), mlines.end(),
               [](const SingleLine& a, const SingleLine& b){return a.A() < b.A();});
   }
@@ -863,7 +877,7 @@ public:
   const std::vector<SingleLine>& AllLines() const noexcept {return mlines;}
   
   /** Lines */
-  std::vector<SingleLine>& AllLines() noexcept {return mlines;}
+  std::vector<SingleLine>& AllLines() noexcept {mcompiled.reset(); return mlines;}
   
   /** Number of broadening species */
   Index NumBroadeners() const noexcept {return Index(mbroadeningspecies.nelem());}
@@ -982,7 +996,7 @@ public:
    * @param[in] k Line number (less than NumLines())
    * @return Central frequency
    */
-  Numeric& F0(size_t k) noexcept {return mlines[k].F0();}
+  Numeric& F0(size_t k) noexcept {mcompiled.reset(); return mlines[k].F0();}
   
   /** Mean frequency by weight of line strengt
    * 
@@ -1022,7 +1036,7 @@ public:
    * @param[in] k Line number (less than NumLines())
    * @return Lower level energy
    */
-  Numeric& E0(size_t k) noexcept {return mlines[k].E0();}
+  Numeric& E0(size_t k) noexcept {mcompiled.reset(); return mlines[k].E0();}
   
   /** Reference line strength
    * 
@@ -1036,7 +1050,7 @@ public:
    * @param[in] k Line number (less than NumLines())
    * @return Reference line strength
    */
-  Numeric& I0(size_t k) noexcept {return mlines[k].I0();}
+  Numeric& I0(size_t k) noexcept {mcompiled.reset(); return mlines[k].I0();}
   
   /** Einstein spontaneous emission
    * 
@@ -1064,7 +1078,7 @@ public:
    * @param[in] k Line number (less than NumLines())
    * @return Lower level statistical weight
    */
-  Numeric& g_low(size_t k) noexcept {return mlines[k].g_low();}
+  Numeric& g_low(size_t k) noexcept {mcompiled.reset(); return mlines[k].g_low();}
   
   /** Upper level statistical weight
    * 
@@ -1078,7 +1092,7 @@ public:
    * @param[in] k Line number (less than NumLines())
    * @return Upper level statistical weight
    */
-  Numeric& g_upp(size_t k) noexcept {return mlines[k].g_upp();}
+  Numeric& g_upp(size_t k) noexcept {mcompiled.reset(); return mlines[k].g_upp();}
   
   /** Returns mirroring style */
   MirroringType Mirroring() const noexcept {return mmirroring;}
@@ -1372,6 +1386,7 @@ public:
   
   /** Returns the broadening species */
   ArrayOfSpeciesTag& BroadeningSpecies() noexcept {
+    mcompiled.reset();
     return mbroadeningspecies;
   }
   
@@ -1430,6 +1445,13 @@ public:
   /** Returns a single line */
   const SingleLine& Line(Index) const noexcept;
   
+  /** The band as CompiledLines
+   * 
+   * Built on the first call and kept with the band until the band is
+   * changed.  Safe to call from several threads at once.
+   */
+  std::shared_ptr<const CompiledLines> Compiled() const;
+  
   /** Reverses the order of the internal lines */
   void ReverseLines() noexcept;
   
@@ -1463,6 +1485,7 @@ public:
   
   /** Binary read for Lines */
   bifstream& read(bifstream& is) {
+    mcompiled.reset();
     for (auto& line: mlines)
       line.read(is);
     return is;
@@ -1481,6 +1504,118 @@ public:
 std::ostream& operator<<(std::ostream&, const Lines&);
 std::istream& operator>>(std::istream&, Lines&);
 
+/** Read-only structure-of-arrays copy of the line data of a band
+ * 
+ * Lines keeps an array of SingleLine, and each line keeps its line shape
+ * model in a vector of its own.  This class copies the data that is needed
+ * for every line at every pressure level into contiguous arrays: F0, I0,
+ * E0, the statistical weights, and the line shape model parameters by
+ * variable and broadening species.  The line strengths and the shape
+ * parameters of all lines can then be computed in one pass over contiguous
+ * data each.  The line indices are also kept in order of F0, so that the
+ * lines can be matched to a sorted frequency grid in one sweep.
+ * 
+ * The copy does not follow changes of the band.  Lines::Compiled() keeps
+ * one with the band and builds a new one after the band has changed.
+ */
+class CompiledLines {
+private:
+  /** Number of lines */
+  Index mnlines;
+  
+  /** Number of broadening species */
+  Index mnspec;
+  
+  /** Line center frequencies */
+  std::vector<Numeric> mf0;
+  
+  /** Reference line strengths */
+  std::vector<Numeric> mi0;
+  
+  /** Lower level energies */
+  std::vector<Numeric> me0;
+  
+  /** Lower level statistical weights */
+  std::vector<Numeric> mglow;
+  
+  /** Upper level statistical weights */
+  std::vector<Numeric> mgupp;
+  
+  /** Line shape model parameters by variable, then by broadening species
+   * and line as [species * NumLines() + line]
+   */
+  std::array<std::vector<LineShape::ModelParameters>, LineShape::nVars> mshape;
+  
+  /** Line indices in order of increasing F0 */
+  std::vector<Index> mbyfrequency;
+  
+public:
+  /** Empty, for no lines */
+  CompiledLines() noexcept : mnlines(0), mnspec(0) {}
+  
+  /** Copies the line shape data of the band
+   * 
+   * @param[in] band The absorption band
+   */
+  explicit CompiledLines(const Lines& band);
+  
+  /** Number of lines */
+  Index NumLines() const noexcept {return mnlines;}
+  
+  /** Line indices in order of increasing F0 */
+  const std::vector<Index>& ByFrequency() const noexcept {return mbyfrequency;}
+  
+  /** Line center frequencies */
+  const std::vector<Numeric>& F0() const noexcept {return mf0;}
+  
+  /** Reference line strengths */
+  const std::vector<Numeric>& I0() const noexcept {return mi0;}
+  
+  /** Lower level energies */
+  const std::vector<Numeric>& E0() const noexcept {return me0;}
+  
+  /** Lower level statistical weights */
+  const std::vector<Numeric>& g_low() const noexcept {return mglow;}
+  
+  /** Upper level statistical weights */
+  const std::vector<Numeric>& g_upp() const noexcept {return mgupp;}
+  
+  /** LTE line strengths of all lines
+   * 
+   * Gives the same values as the scaling of
+   * Linefunctions::apply_linestrength_scaling_by_lte for each line
+   * 
+   * @param[out] S Line strengths, resized to NumLines()
+   * @param[in] T Atmospheric temperature
+   * @param[in] T0 Reference temperature of the band
+   * @param[in] isotopic_ratio The band isotopic ratio
+   * @param[in] QT The partition function at the temperature
+   * @param[in] QT0 The partition function at the reference temperature
+   */
+  void LineStrengths(std::vector<Numeric>& S,
+                     Numeric T,
+                     Numeric T0,
+                     Numeric isotopic_ratio,
+                     Numeric QT,
+                     Numeric QT0) const;
+  
+  /** Line shape parameters of all lines
+   * 
+   * Gives the same values as Lines::ShapeParameters for each line
+   * 
+   * @param[out] X Line shape parameters, resized to NumLines()
+   * @param[in] band The band this was compiled from
+   * @param[in] T Atmospheric temperature
+   * @param[in] P Atmospheric pressure
+   * @param[in] vmrs Line broadener species's volume mixing ratio
+   */
+  void ShapeParameters(std::vector<LineShape::Output>& X,
+                       const Lines& band,
+                       Numeric T,
+                       Numeric P,
+                       const Vector& vmrs) const;
+};  // CompiledLines
+
 /** Read from ARTSCAT-3
  * 
  * @param[in] is Input stream
@@ -1755,11 +1890,13 @@ SingleLineExternal ReadFromJplStream(istream& is);
  * @param[in] lines A list of lines
  * @param[in] localquantas List of quantum numbers to be presumed local
  * @param[in] globalquantas List of quantum numbers to be presumed global
+ * @param[out] last_lines If not nullptr, the index in lines of the last line of each band
  * @return A list of properly ordered Lines
  */
 std::vector<Lines> split_list_of_external_lines(std::vector<SingleLineExternal>& external_lines,
                                                 const std::vector<QuantumNumberType>& localquantas={},
-                                                const std::vector<QuantumNumberType>& globalquantas={});
+                                                const std::vector<QuantumNumberType>& globalquantas={},
+                                                std::vector<std::size_t>* last_lines=nullptr);
 
 /** Creates a copy of the input lines structure
  * 
@@ -37,6 +37,7 @@
 #include "global_data.h"
 #include "messages.h"
 #include "methods.h"
+#include "profiling.h"
 #include "workspace_ng.h"
 
 //! Appends methods to an agenda
@@ -183,6 +184,8 @@ void Agenda::execute(Workspace& ws) const {
 
   averbosity.set_main_agenda(is_main_agenda());
 
+  Profiling::Scope profile_agenda(mname, Profiling::Kind::Agenda);
+
   ArtsOut1 aout1(averbosity);
   {
     //    ostringstream os;  // disabled for performance reasons
@@ -232,7 +235,14 @@ void Agenda::execute(Workspace& ws) const {
                                 Workspace::wsv_data[mrr.Out()[v[s]]].Name());
       }
 
+      {  // Output variables that are still shared with an outer scope
+        // get their own copy before the method writes to them.
+        const ArrayOfIndex& v = mrr.Out();
+        for (Index s = 0; s < v.nelem(); ++s) ws.unshare(v[s]);
+      }
+
       // Call the getaway function:
+      Profiling::Scope profile_method(mdd.Name(), Profiling::Kind::Method);
       getaways[mrr.Id()](ws, mrr);
 
     } catch (const std::bad_alloc& x) {
@@ -28,8 +28,10 @@
 */
 
 #include "bifstream.h"
+#include <cstdint>
 #include <fstream>
 #include <stdexcept>
+#include <vector>
 
 void bifstream::seek(long spos, Offset offs) {
   if (!in) {
@@ -71,6 +73,51 @@ bifstream::Byte bifstream::getByte() {
   }
 }
 
+bool bifstream::native_byte_order() {
+  return getFlag(BigEndian) == bool(system_flags & BigEndian);
+}
+
+bool bifstream::native_ieee_double() {
+  return getFlag(FloatIEEE) && (system_flags & FloatIEEE) &&
+         native_byte_order();
+}
+
+//! Reads a block of doubles.
+/*!
+  If the file has the byte order and float format of the system, the
+  whole block is read with a single call. Otherwise the values are
+  converted one by one.
+
+  \param pd Where to put the values.
+  \param n  Number of values to read.
+*/
+void bifstream::readBlock(double* pd, const streamsize n) {
+  if (native_ieee_double()) {
+    getRaw(reinterpret_cast<char*>(pd), n * sizeof(double));
+  } else {
+    for (streamsize i = 0; i < n; i++)
+      pd[i] = (double)readFloat(binio::Double);
+  }
+}
+
+//! Reads a block of integers.
+/*!
+  Integers are stored with 4 bytes in the file, like for operator>>.
+
+  \param pl Where to put the values.
+  \param n  Number of values to read.
+*/
+void bifstream::readBlock(long* pl, const streamsize n) {
+  if (native_byte_order()) {
+    std::vector<std::int32_t> buf(n);
+    getRaw(reinterpret_cast<char*>(buf.data()), n * sizeof(std::int32_t));
+    for (streamsize i = 0; i < n; i++) pl[i] = buf[i];
+  } else {
+    for (streamsize i = 0; i < n; i++)
+      pl[i] = (std::int32_t)readInt(4);
+  }
+}
+
 /* Overloaded input operators */
 bifstream& operator>>(bifstream& bif, double& n) {
   n = (double)bif.readFloat(binio::Double);
@@ -83,7 +130,7 @@ bifstream& operator>>(bifstream& bif, float& n) {
 }
 
 bifstream& operator>>(bifstream& bif, long& n) {
-  n = (long)bif.readInt(4);
+  n = (long)(std::int32_t)bif.readInt(4);
   return (bif);
 }
 
@@ -57,6 +57,13 @@ class bifstream : public binistream, public ifstream {
 
   bifstream::Byte getByte() override final;
   void getRaw(char* c, streamsize n) override final { this->read(c, n); }
+
+  void readBlock(double* pd, streamsize n);
+  void readBlock(long* pl, streamsize n);
+
+ private:
+  bool native_ieee_double();
+  bool native_byte_order();
 };
 
 /* Overloaded input operators */
@@ -28,8 +28,10 @@
 */
 
 #include "bofstream.h"
+#include <cstdint>
 #include <fstream>
 #include <stdexcept>
+#include <vector>
 
 void bofstream::seek(long spos, Offset offs) {
   if (!in) {
@@ -72,6 +74,59 @@ void bofstream::putByte(bofstream::Byte b) {
   }
 }
 
+bool bofstream::native_byte_order() {
+  return getFlag(BigEndian) == bool(system_flags & BigEndian);
+}
+
+bool bofstream::native_ieee_double() {
+  return getFlag(FloatIEEE) && (system_flags & FloatIEEE) &&
+         native_byte_order();
+}
+
+//! Writes a block of doubles.
+/*!
+  If the file has the byte order and float format of the system, the
+  whole block is written with a single call. Otherwise the values are
+  converted one by one.
+
+  \param pd The values.
+  \param n  Number of values to write.
+*/
+void bofstream::writeBlock(const double* pd, const streamsize n) {
+  if (native_ieee_double()) {
+    putRaw(reinterpret_cast<const char*>(pd), n * sizeof(double));
+  } else {
+    for (streamsize i = 0; i < n; i++) writeFloat(pd[i], binio::Double);
+  }
+
+  if (this->bad()) {
+    err |= Fatal;
+    throw runtime_error("Writing to binary file failed");
+  }
+}
+
+//! Writes a block of integers.
+/*!
+  Integers are stored with 4 bytes in the file, like for operator<<.
+
+  \param pl The values.
+  \param n  Number of values to write.
+*/
+void bofstream::writeBlock(const long* pl, const streamsize n) {
+  if (native_byte_order()) {
+    std::vector<std::int32_t> buf(pl, pl + n);
+    putRaw(reinterpret_cast<const char*>(buf.data()),
+           n * sizeof(std::int32_t));
+  } else {
+    for (streamsize i = 0; i < n; i++) writeInt(pl[i], 4);
+  }
+
+  if (this->bad()) {
+    err |= Fatal;
+    throw runtime_error("Writing to binary file failed");
+  }
+}
+
 /* Overloaded output operators */
 bofstream& operator<<(bofstream& bof, double n) {
   bof.writeFloat(n, binio::Double);
@@ -57,6 +57,13 @@ class bofstream : public binostream, public ofstream {
 
   void putByte(bofstream::Byte b) override final;
   void putRaw(const char* c, streamsize n) override final { this->write(c, n); }
+
+  void writeBlock(const double* pd, streamsize n);
+  void writeBlock(const long* pl, streamsize n);
+
+ private:
+  bool native_ieee_double();
+  bool native_byte_order();
 };
 
 /* Overloaded output operators */
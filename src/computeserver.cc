@@ -0,0 +1,592 @@
+/*!
+  \file   computeserver.cc
+  \date   2026-10-15
+
+  \brief  Implementation of the arts compute server.
+  */
+
+#include "computeserver.h"
+
+#ifdef ENABLE_DOCSERVER
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdint.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "agenda_class.h"
+#include "global_data.h"
+#include "libmicrohttpd/microhttpd.h"
+#include "libmicrohttpd/platform.h"
+#include "methods.h"
+#include "workspace_ng.h"
+
+extern void (*getaways[])(Workspace&, const MRecord&);
+
+static int computeserver_answer(void* cls,
+                                struct MHD_Connection* connection,
+                                const char* url,
+                                const char* method,
+                                const char* version,
+                                const char* upload_data,
+                                size_t* upload_data_size,
+                                void** con_cls);
+
+static void computeserver_completed(void* cls,
+                                    struct MHD_Connection* connection,
+                                    void** con_cls,
+                                    enum MHD_RequestTerminationCode toe);
+
+//! Write end and read end of the pipe that wakes launch on a signal.
+static int computeserver_signal_pipe[2] = {-1, -1};
+
+//! Signal handler that wakes launch.
+/**
+  The handler runs in whichever thread receives the signal, including the
+  threads of OpenMP and libmicrohttpd, and only writes to the pipe, which
+  is async-signal-safe.
+  */
+static void computeserver_signal(int) {
+  const int saved_errno = errno;
+  const char c = 0;
+  const ssize_t n = write(computeserver_signal_pipe[1], &c, 1);
+  (void)n;
+  errno = saved_errno;
+}
+
+//! Error in a request that is the fault of the client.
+/**
+  Reported as 400 Bad Request, all other errors as 500 Internal Server
+  Error.
+  */
+class ComputeserverRequestError : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+//! Read a whole file into a string.
+static String read_file(const String& filename) {
+  std::ifstream is(filename.c_str(), std::ios::binary);
+  if (!is) throw std::runtime_error("Cannot read " + filename);
+  std::ostringstream os;
+  os << is.rdbuf();
+  return os.str();
+}
+
+//! Write a string to a file.
+static void write_file(const String& filename, const char* data, size_t n) {
+  std::ofstream os(filename.c_str(), std::ios::binary);
+  os.write(data, (std::streamsize)n);
+  if (!os) throw std::runtime_error("Cannot write " + filename);
+}
+
+//! Check that a Host or Origin names the local host.
+/**
+  \param[in]  host    Host name with optional port, e.g. localhost:9001.
+
+  \returns True for localhost, 127.0.0.1 and [::1].
+  */
+static bool is_local_host(const String& host) {
+  String name = host;
+  const size_t colon = name.rfind(':');
+  if (colon != std::string::npos && name.find(']', colon) == std::string::npos)
+    name.erase(colon);
+  return name == "localhost" || name == "127.0.0.1" || name == "[::1]";
+}
+
+//! Construct compute server.
+/**
+  Creates a private temporary directory for the transfer of variables and
+  adds the variables that hold the arguments of ReadXML and WriteXML to the
+  workspace. The access token is taken from the environment variable
+  ARTS_COMPUTESERVER_TOKEN, or created randomly, and written to a file in
+  the temporary directory that only the user can read.
+
+  \param[in,out]  ws         Workspace of the executed controlfile.
+  \param[in]      port       Port to listen on, -1 for the default.
+  \param[in]      verbosity  Verbosity setting.
+  */
+Computeserver::Computeserver(Workspace& ws,
+                             const Index port,
+                             const Verbosity& verbosity)
+    : mws(ws), mport(port == -1 ? 9001 : port), mverbosity(verbosity) {
+  const char* tmp = std::getenv("TMPDIR");
+  String dirname = String(tmp && *tmp ? tmp : "/tmp") +
+                   "/arts-computeserver-XXXXXX";
+  std::vector<char> buf(dirname.begin(), dirname.end());
+  buf.push_back('\0');
+  if (!mkdtemp(buf.data())) {
+    std::ostringstream os;
+    os << "Cannot create temporary directory " << dirname
+       << " for the compute server.";
+    throw std::runtime_error(os.str());
+  }
+  mtmpdir = buf.data();
+
+  const char* token = std::getenv("ARTS_COMPUTESERVER_TOKEN");
+  if (token && *token) {
+    mtoken = token;
+  } else {
+    std::random_device random;
+    std::ostringstream os;
+    os << std::hex << std::setfill('0');
+    for (int i = 0; i < 4; i++) os << std::setw(8) << (uint32_t)random();
+    mtoken = os.str();
+  }
+
+  const int fd = open(token_file_name().c_str(),
+                      O_WRONLY | O_CREAT | O_EXCL,
+                      S_IRUSR | S_IWUSR);
+  if (fd < 0 || write(fd, mtoken.data(), mtoken.size()) !=
+                    (ssize_t)mtoken.size()) {
+    if (fd >= 0) close(fd);
+    std::remove(token_file_name().c_str());
+    rmdir(mtmpdir.c_str());
+    throw std::runtime_error("Cannot write the compute server token file " +
+                             token_file_name() + ".");
+  }
+  close(fd);
+
+  mfilename_id = Workspace::add_wsv(WsvRecord(
+      "computeserver_filename", "File name used by the compute server.", "String"));
+  mformat_id = Workspace::add_wsv(WsvRecord(
+      "computeserver_format", "File format used by the compute server.", "String"));
+  mno_clobber_id = Workspace::add_wsv(WsvRecord(
+      "computeserver_no_clobber", "No clobber flag of the compute server.", "Index"));
+  mws.initialize();
+
+  *(String*)mws[mfilename_id] = file_name();
+  *(String*)mws[mformat_id] = "ascii";
+  *(Index*)mws[mno_clobber_id] = 0;
+}
+
+Computeserver::~Computeserver() {
+  std::remove(file_name().c_str());
+  std::remove((file_name() + ".bin").c_str());
+  std::remove(token_file_name().c_str());
+  rmdir(mtmpdir.c_str());
+}
+
+//! Index of a workspace variable, -1 if it does not exist.
+Index Computeserver::find_variable(const String& name) const {
+  auto it = Workspace::WsvMap.find(name);
+  return it == Workspace::WsvMap.end() ? -1 : it->second;
+}
+
+//! Name of the XML file for the transfer of variables.
+String Computeserver::file_name() const { return mtmpdir + "/variable.xml"; }
+
+//! Name of the file with the access token.
+String Computeserver::token_file_name() const { return mtmpdir + "/token"; }
+
+//! Set a workspace variable from an XML document.
+/**
+  \param[in]  id          Index of the variable.
+  \param[in]  body        XML document, followed by the binary data for
+                          binary XML.
+  \param[in]  xml_length  Length of the XML part for binary XML, or -1.
+  */
+void Computeserver::read_variable(Index id,
+                                  const String& body,
+                                  Index xml_length) {
+  using global_data::MdMap;
+  using global_data::wsv_group_names;
+
+  const String& group = wsv_group_names[Workspace::wsv_data[id].Group()];
+  auto md = MdMap.find("ReadXML_sg_" + group);
+  if (md == MdMap.end()) {
+    std::ostringstream os;
+    os << "Variables of group " << group << " can not be read from XML.";
+    throw ComputeserverRequestError(os.str());
+  }
+
+  const String filename = file_name();
+  if (xml_length < 0) {
+    write_file(filename, body.data(), body.size());
+  } else {
+    write_file(filename, body.data(), (size_t)xml_length);
+    write_file(filename + ".bin",
+               body.data() + xml_length,
+               body.size() - (size_t)xml_length);
+  }
+
+  *(String*)mws[mfilename_id] = filename;
+  try {
+    getaways[md->second](
+        mws, MRecord(md->second, {id}, {mfilename_id}, TokVal(), Agenda()));
+  } catch (const std::exception& x) {
+    throw ComputeserverRequestError(x.what());
+  }
+}
+
+//! Get a workspace variable as an XML document.
+/**
+  \param[in]  id          Index of the variable.
+  \param[in]  binary      Flag to write binary XML.
+  \param[out] xml_length  Length of the XML part for binary XML, or -1.
+
+  \returns XML document, followed by the binary data for binary XML.
+  */
+String Computeserver::write_variable(Index id, bool binary, Index& xml_length) {
+  using global_data::MdMap;
+  using global_data::wsv_group_names;
+
+  if (!mws.is_initialized(id)) {
+    std::ostringstream os;
+    os << "Variable " << Workspace::wsv_data[id].Name()
+       << " is uninitialized.";
+    throw ComputeserverRequestError(os.str());
+  }
+
+  const String& group = wsv_group_names[Workspace::wsv_data[id].Group()];
+  auto md = MdMap.find("WriteXML_sg_" + group);
+  if (md == MdMap.end()) {
+    std::ostringstream os;
+    os << "Variables of group " << group << " can not be written to XML.";
+    throw ComputeserverRequestError(os.str());
+  }
+
+  const String filename = file_name();
+  *(String*)mws[mfilename_id] = filename;
+  *(String*)mws[mformat_id] = binary ? "binary" : "ascii";
+  getaways[md->second](
+      mws,
+      MRecord(md->second,
+              {},
+              {mformat_id, id, mfilename_id, mno_clobber_id},
+              TokVal(),
+              Agenda()));
+
+  String xml = read_file(filename);
+  if (!binary) {
+    xml_length = -1;
+    return xml;
+  }
+
+  xml_length = (Index)xml.size();
+  return xml + read_file(filename + ".bin");
+}
+
+//! Execute the agenda stored in a workspace variable.
+void Computeserver::execute_agenda(Index id) {
+  if (Workspace::wsv_data[id].Group() != get_wsv_group_id("Agenda")) {
+    std::ostringstream os;
+    os << "Variable " << Workspace::wsv_data[id].Name()
+       << " is not an agenda.";
+    throw ComputeserverRequestError(os.str());
+  }
+
+  if (!mws.is_initialized(id)) {
+    std::ostringstream os;
+    os << "Agenda " << Workspace::wsv_data[id].Name() << " is uninitialized.";
+    throw ComputeserverRequestError(os.str());
+  }
+
+  const Agenda& agenda = *(Agenda*)mws[id];
+  agenda.execute(mws);
+}
+
+unsigned int Computeserver::check_access(const char* token,
+                                         const char* host,
+                                         const char* origin,
+                                         String& response) const {
+  if (host && !is_local_host(host)) {
+    response = "Requests must be made to localhost, not " + String(host) +
+               ".\n";
+    return MHD_HTTP_FORBIDDEN;
+  }
+
+  if (origin) {
+    const String prefix = "http://";
+    const String o = origin;
+    if (o.compare(0, prefix.size(), prefix) != 0 ||
+        !is_local_host(o.substr(prefix.size()))) {
+      response = "Requests from origin " + o + " are not allowed.\n";
+      return MHD_HTTP_FORBIDDEN;
+    }
+  }
+
+  // Compare all characters, so that the time does not depend on where the
+  // first difference is
+  const String given = token ? token : "";
+  unsigned char diff = given.size() != mtoken.size();
+  for (size_t i = 0; i < given.size(); i++)
+    diff |= (unsigned char)(given[i] ^ mtoken[i % mtoken.size()]);
+  if (diff) {
+    response = "Missing or wrong X-ARTS-Token header.\n";
+    return MHD_HTTP_FORBIDDEN;
+  }
+
+  return MHD_HTTP_OK;
+}
+
+unsigned int Computeserver::handle(const String& method,
+                                   const String& url,
+                                   const String& format,
+                                   const String& body,
+                                   const Index xml_length,
+                                   String& response,
+                                   Index& response_length) {
+  const Verbosity& verbosity = mverbosity;
+  CREATE_OUT1;
+  CREATE_OUT2;
+
+  response.clear();
+  response_length = -1;
+
+  ArrayOfString tokens;
+  url.split(tokens, "/");
+  while (tokens.nelem() && tokens[0] == "") tokens.erase(tokens.begin());
+  if (tokens.nelem() != 2 ||
+      (tokens[0] != "variables" && tokens[0] != "agendas")) {
+    response = "Unknown URL " + url + "\n";
+    return MHD_HTTP_NOT_FOUND;
+  }
+
+  const Index id = find_variable(tokens[1]);
+  if (id < 0) {
+    response = "Unknown workspace variable " + tokens[1] + "\n";
+    return MHD_HTTP_NOT_FOUND;
+  }
+
+  if (format != "ascii" && format != "binary") {
+    response = "Format must be ascii or binary, not " + format + "\n";
+    return MHD_HTTP_BAD_REQUEST;
+  }
+
+  // One request at a time, they share the workspace
+  std::lock_guard<std::mutex> lock(mmutex);
+  out2 << "  Compute server: " << method << " " << url << "\n";
+
+  try {
+    if (tokens[0] == "variables" && method == "GET")
+      response = write_variable(id, format == "binary", response_length);
+    else if (tokens[0] == "variables" && method == "PUT")
+      read_variable(id, body, xml_length);
+    else if (tokens[0] == "agendas" && method == "POST")
+      execute_agenda(id);
+    else {
+      response = "Method " + method + " is not allowed for " + url + "\n";
+      return MHD_HTTP_METHOD_NOT_ALLOWED;
+    }
+  } catch (const ComputeserverRequestError& x) {
+    out1 << "Compute server error in " << method << " " << url << ":\n"
+         << x.what() << "\n";
+    response = String(x.what()) + "\n";
+    response_length = -1;
+    return MHD_HTTP_BAD_REQUEST;
+  } catch (const std::exception& x) {
+    out1 << "Compute server error in " << method << " " << url << ":\n"
+         << x.what() << "\n";
+    response = String(x.what()) + "\n";
+    response_length = -1;
+    return MHD_HTTP_INTERNAL_SERVER_ERROR;
+  }
+
+  return MHD_HTTP_OK;
+}
+
+//! Starts compute server.
+/**
+  Serves requests on the loopback interface until the process receives
+  SIGINT or SIGTERM.
+  */
+void Computeserver::launch() {
+  const Verbosity& verbosity = mverbosity;
+  CREATE_OUT1;
+
+  // SIGINT and SIGTERM can be delivered to any thread, the handler wakes
+  // the wait below through a pipe, so that the server is stopped and the
+  // temporary files are removed
+  if (pipe(computeserver_signal_pipe) != 0)
+    throw std::runtime_error("Cannot create the compute server signal pipe.");
+  struct sigaction action {}, old_int, old_term;
+  action.sa_handler = &computeserver_signal;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGINT, &action, &old_int);
+  sigaction(SIGTERM, &action, &old_term);
+
+  // Restores the signal handlers and closes the pipe
+  auto restore_signals = [&]() {
+    sigaction(SIGINT, &old_int, NULL);
+    sigaction(SIGTERM, &old_term, NULL);
+    close(computeserver_signal_pipe[0]);
+    close(computeserver_signal_pipe[1]);
+    computeserver_signal_pipe[0] = computeserver_signal_pipe[1] = -1;
+  };
+
+  struct sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons((uint16_t)mport);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  struct MHD_Daemon* d =
+      MHD_start_daemon(MHD_USE_THREAD_PER_CONNECTION | MHD_USE_DEBUG,
+                       (uint16_t)mport,
+                       NULL,
+                       NULL,
+                       &computeserver_answer,
+                       (void*)this,
+                       MHD_OPTION_SOCK_ADDR,
+                       (struct sockaddr*)&addr,
+                       MHD_OPTION_NOTIFY_COMPLETED,
+                       &computeserver_completed,
+                       NULL,
+                       MHD_OPTION_END);
+
+  if (d == NULL) {
+    restore_signals();
+    std::ostringstream os;
+    os << "Cannot start compute server. Maybe port " << mport
+       << " is already in use?";
+    throw std::runtime_error(os.str());
+  }
+
+  cerr << "ARTS compute server listening at http://localhost:" << mport
+       << "\n"
+       << "Access token (header X-ARTS-Token): " << mtoken << "\n"
+       << "The token is also in " << token_file_name() << "\n";
+
+  char c;
+  ssize_t n;
+  do {
+    n = read(computeserver_signal_pipe[0], &c, 1);
+  } while (n < 0 && errno == EINTR);
+
+  MHD_stop_daemon(d);
+  restore_signals();
+  out1 << "Stopped compute server.\n";
+}
+
+//! HTTP request responder.
+/**
+  Collects the request body and passes the request to the compute server.
+
+  \param[in,out]   cls               Computeserver object.
+  \param[in,out]   connection        Connection info.
+  \param[in]       url               Requested URL.
+  \param[in]       method            Request method.
+  \param[in]       version           Unused parameter.
+  \param[in]       upload_data       Part of the request body.
+  \param[in,out]   upload_data_size  Size of upload_data.
+  \param[in,out]   con_cls           Request body collected so far.
+
+  \returns Status code.
+  */
+static int computeserver_answer(void* cls,
+                                struct MHD_Connection* connection,
+                                const char* url,
+                                const char* method,
+                                const char* version _U_,
+                                const char* upload_data,
+                                size_t* upload_data_size,
+                                void** con_cls) {
+  if (!cls) {
+    cerr << "Compute server error: Computeserver object reference is NULL.\n";
+    return MHD_NO;
+  }
+
+  // Check the access before the body is received
+  if (!*con_cls) {
+    String denied;
+    const unsigned int access = ((Computeserver*)cls)->check_access(
+        MHD_lookup_connection_value(
+            connection, MHD_HEADER_KIND, "X-ARTS-Token"),
+        MHD_lookup_connection_value(connection, MHD_HEADER_KIND, "Host"),
+        MHD_lookup_connection_value(connection, MHD_HEADER_KIND, "Origin"),
+        denied);
+    if (access != MHD_HTTP_OK) {
+      struct MHD_Response* r = MHD_create_response_from_buffer(
+          denied.size(), (void*)denied.data(), MHD_RESPMEM_MUST_COPY);
+      if (r == NULL) return MHD_NO;
+      MHD_add_response_header(r, "Content-type", "text/plain; charset=utf-8");
+      int ret = MHD_queue_response(connection, access, r);
+      MHD_destroy_response(r);
+      return ret;
+    }
+
+    *con_cls = new String;
+    return MHD_YES;
+  }
+
+  String& body = *(String*)*con_cls;
+  if (*upload_data_size) {
+    body.append(upload_data, *upload_data_size);
+    *upload_data_size = 0;
+    return MHD_YES;
+  }
+
+  const char* format =
+      MHD_lookup_connection_value(connection, MHD_GET_ARGUMENT_KIND, "format");
+  const char* length = MHD_lookup_connection_value(
+      connection, MHD_HEADER_KIND, "X-ARTS-XML-Length");
+
+  String response;
+  Index response_length = -1;
+  unsigned int status;
+
+  Index xml_length = -1;
+  if (length) {
+    std::istringstream is(length);
+    is >> xml_length;
+    if (!is || xml_length < 0 || (size_t)xml_length > body.size())
+      xml_length = -2;
+  }
+
+  if (xml_length == -2) {
+    response = "Invalid X-ARTS-XML-Length header.\n";
+    status = MHD_HTTP_BAD_REQUEST;
+  } else {
+    status = ((Computeserver*)cls)
+                 ->handle(method,
+                          url,
+                          format ? format : "ascii",
+                          body,
+                          xml_length,
+                          response,
+                          response_length);
+  }
+
+  struct MHD_Response* r = MHD_create_response_from_buffer(
+      response.size(), (void*)response.data(), MHD_RESPMEM_MUST_COPY);
+  if (r == NULL) {
+    cerr << "Compute server error: response = 0\n";
+    return MHD_NO;
+  }
+
+  if (status != MHD_HTTP_OK)
+    MHD_add_response_header(r, "Content-type", "text/plain; charset=utf-8");
+  else if (response_length >= 0) {
+    std::ostringstream os;
+    os << response_length;
+    MHD_add_response_header(r, "Content-type", "application/octet-stream");
+    MHD_add_response_header(r, "X-ARTS-XML-Length", os.str().c_str());
+  } else if (response.size())
+    MHD_add_response_header(r, "Content-type", "application/xml");
+
+  int ret = MHD_queue_response(connection, status, r);
+  MHD_destroy_response(r);
+
+  return ret;
+}
+
+//! Frees the request body when a request is done.
+static void computeserver_completed(void* cls _U_,
+                                    struct MHD_Connection* connection _U_,
+                                    void** con_cls,
+                                    enum MHD_RequestTerminationCode toe _U_) {
+  delete (String*)*con_cls;
+  *con_cls = NULL;
+}
+
+#endif /* ENABLE_DOCSERVER */
@@ -0,0 +1,116 @@
+/*!
+  \file   computeserver.h
+  \date   2026-10-15
+
+  \brief  Declarations for the arts compute server.
+
+  The compute server keeps the workspace of a controlfile in memory after
+  the controlfile has been executed and serves requests on the loopback
+  interface. Requests set workspace variables, execute agendas and return
+  workspace variables in ARTS XML format:
+
+  - PUT /variables/<name>: Sets the variable from the XML document in the
+    request body.
+  - GET /variables/<name>[?format=binary]: Returns the variable as XML.
+  - POST /agendas/<name>: Executes the agenda stored in the variable.
+
+  Binary XML is transferred in a single body, the XML part followed by the
+  content of the binary file. The header X-ARTS-XML-Length gives the number
+  of bytes of the XML part. Requests are served one at a time, and variables
+  keep their values between requests.
+
+  Every request must carry the access token of the server in the header
+  X-ARTS-Token. The token is random, or taken from the environment variable
+  ARTS_COMPUTESERVER_TOKEN, and is printed at startup and written to a file
+  that only the user can read. Requests with a Host or Origin header that
+  does not name the local host are rejected, so that web pages can not
+  reach the server.
+*/
+
+#ifndef computeserver_h
+#define computeserver_h
+
+#include "arts.h"
+
+#ifdef ENABLE_DOCSERVER
+
+#include <mutex>
+#include "messages.h"
+#include "mystring.h"
+
+class Workspace;
+
+class Computeserver {
+ private:
+  Workspace& mws;
+  Index mport;
+  Verbosity mverbosity;
+  String mtmpdir;
+  String mtoken;
+  Index mfilename_id;
+  Index mformat_id;
+  Index mno_clobber_id;
+  std::mutex mmutex;
+
+  Index find_variable(const String& name) const;
+  String file_name() const;
+  String token_file_name() const;
+
+  void read_variable(Index id, const String& body, Index xml_length);
+  String write_variable(Index id, bool binary, Index& xml_length);
+  void execute_agenda(Index id);
+
+ public:
+  Computeserver(Workspace& ws, const Index port, const Verbosity& verbosity);
+
+  Computeserver(const Computeserver&) = delete;
+  Computeserver& operator=(const Computeserver&) = delete;
+
+  ~Computeserver();
+
+  //! Handle a request
+  /**
+    \param[in]  method           HTTP method.
+    \param[in]  url              Requested URL.
+    \param[in]  format           Requested output format, "ascii" or
+                                 "binary".
+    \param[in]  body             Request body.
+    \param[in]  xml_length       Length of the XML part of a binary body,
+                                 or -1 for ASCII XML.
+    \param[out] response         Response body.
+    \param[out] response_length  Length of the XML part of a binary
+                                 response, or -1 for ASCII XML.
+
+    \returns HTTP status code.
+    */
+  unsigned int handle(const String& method,
+                      const String& url,
+                      const String& format,
+                      const String& body,
+                      const Index xml_length,
+                      String& response,
+                      Index& response_length);
+
+  //! Check the access to the server
+  /**
+    \param[in]  token     Value of the X-ARTS-Token header, or NULL.
+    \param[in]  host      Value of the Host header, or NULL.
+    \param[in]  origin    Value of the Origin header, or NULL.
+    \param[out] response  Reason for a denied request.
+
+    \returns MHD_HTTP_OK, or MHD_HTTP_FORBIDDEN if the request is denied.
+    */
+  unsigned int check_access(const char* token,
+                            const char* host,
+                            const char* origin,
+                            String& response) const;
+
+  //! Access token of the server
+  const String& token() const { return mtoken; }
+
+  void launch();
+};
+
+#endif /* ENABLE_DOCSERVER */
+
+#endif /* computeserver_h */
@@ -29,8 +29,11 @@
 #include <utility>
 #include <vector>
 
+#include "Eigen/SparseCholesky"
+#include "arts_omp.h"
 #include "covariance_matrix.h"
 #include "lapack.h"
+#include "lin_alg.h"
 
 //------------------------------------------------------------------------------
 // Correlations
@@ -388,11 +391,138 @@ void CovarianceMatrix::generate_blocks(
   }
 }
 
+//------------------------------------------------------------------------------
+// Inversion of Blocks
+//------------------------------------------------------------------------------
+namespace {
+
+/** Invert a symmetric, positive definite matrix in place.
+ *
+ * Uses the Cholesky decomposition. Only the upper triangle of A is read.
+ *
+ * @param A The matrix to invert.
+ * @return false if A is not positive definite, A is then undefined.
+ */
+bool inv_spd(Matrix &A) {
+  // The lower triangle in column-major order is the upper in row-major order.
+  char uplo = 'L';
+  int n = static_cast<int>(A.nrows());
+  int info = 0;
+
+  lapack::dpotrf_(&uplo, &n, A.get_raw_data(), &n, &info);
+  if (info != 0) return false;
+  lapack::dpotri_(&uplo, &n, A.get_raw_data(), &n, &info);
+  if (info != 0) return false;
+
+  for (Index i = 0; i < A.nrows(); ++i) {
+    for (Index j = i + 1; j < A.ncols(); ++j) {
+      A(j, i) = A(i, j);
+    }
+  }
+  return true;
+}
+
+/** Inverse of a diagonal sparse matrix.
+ *
+ * @param A The matrix to invert.
+ * @return The inverse or nullptr if A is not diagonal.
+ */
+std::shared_ptr<Sparse> inv_diagonal(const Sparse &A) {
+  if (A.nnz() != A.nrows()) return nullptr;
+
+  Vector values;
+  ArrayOfIndex row_indices, column_indices;
+  A.list_elements(values, row_indices, column_indices);
+
+  Vector d(A.nrows());
+  for (Index i = 0; i < values.nelem(); ++i) {
+    if (row_indices[i] != column_indices[i]) return nullptr;
+    if (values[i] == 0.0) {
+      throw std::runtime_error(
+          "Error inverting matrix: Matrix not of full rank.");
+    }
+    d[row_indices[i]] = 1.0 / values[i];
+  }
+  return std::make_shared<Sparse>(Sparse::diagonal(d));
+}
+
+/** Invert a symmetric, positive definite sparse matrix.
+ *
+ * Uses a sparse Cholesky decomposition of the upper triangle of A, so that
+ * the cost for banded matrices grows with the band width and not with the
+ * size of the matrix. The inverse itself is dense.
+ *
+ * @param Ainv The inverse of A.
+ * @param A The matrix to invert.
+ * @return false if A is not positive definite, Ainv is then undefined.
+ */
+bool inv_sparse_spd(Matrix &Ainv, const Sparse &A) {
+  const Index n = A.nrows();
+
+  Vector values;
+  ArrayOfIndex row_indices, column_indices;
+  A.list_elements(values, row_indices, column_indices);
+
+  std::vector<Eigen::Triplet<Numeric>> elements;
+  elements.reserve(values.nelem());
+  for (Index i = 0; i < values.nelem(); ++i) {
+    if (row_indices[i] <= column_indices[i]) {
+      elements.emplace_back(row_indices[i], column_indices[i], values[i]);
+    }
+  }
+
+  Eigen::SparseMatrix<Numeric> S(n, n);
+  S.setFromTriplets(elements.begin(), elements.end());
+
+  Eigen::SimplicialLLT<Eigen::SparseMatrix<Numeric>, Eigen::Upper> llt(S);
+  if (llt.info() != Eigen::Success) return false;
+
+  // The inverse is symmetric, so each solution is a row of the inverse.
+  Ainv.resize(n, n);
+  Eigen::VectorXd e = Eigen::VectorXd::Zero(n);
+  Eigen::VectorXd x(n);
+  for (Index i = 0; i < n; ++i) {
+    e[i] = 1.0;
+    x = llt.solve(e);
+    e[i] = 0.0;
+    for (Index j = 0; j < n; ++j) {
+      Ainv(i, j) = x[j];
+    }
+  }
+  return llt.info() == Eigen::Success;
+}
+
+}  // namespace
+
 void CovarianceMatrix::compute_inverse() const {
   std::vector<std::vector<const Block *>> correlation_blocks{};
   generate_blocks(correlation_blocks);
-  for (std::vector<const Block *> &cb : correlation_blocks) {
-    invert_correlation_block(inverses_, cb);
+
+  // Groups of correlated retrieval quantities are independent of each other.
+  std::vector<std::vector<Block>> group_inverses(correlation_blocks.size());
+  bool failed = false;
+  String fail_msg;
+#pragma omp parallel for if (!arts_omp_in_parallel() && \
+                             correlation_blocks.size() > 1) schedule(dynamic, 1)
+  for (size_t i = 0; i < correlation_blocks.size(); ++i) {
+    if (failed) continue;
+    try {
+      invert_correlation_block(group_inverses[i], correlation_blocks[i]);
+    } catch (const std::exception &e) {
+#pragma omp critical(covariance_matrix_compute_inverse)
+      {
+        failed = true;
+        fail_msg = e.what();
+      }
+    }
+  }
+
+  if (failed) throw std::runtime_error(fail_msg);
+
+  for (std::vector<Block> &gi : group_inverses) {
+    for (Block &b : gi) {
+      inverses_.push_back(std::move(b));
+    }
   }
 }
 
@@ -416,6 +546,25 @@ void CovarianceMatrix::invert_correlation_block(
   };
   if (std::all_of(blocks.begin(), blocks.end(), block_has_inverse)) return;
 
+  // A single sparse block is inverted without densifying it: Diagonal
+  // blocks have a sparse inverse and other sparse blocks, e.g. banded ones,
+  // are decomposed with a sparse Cholesky decomposition.
+  if (blocks.size() == 1 &&
+      blocks[0]->get_matrix_type() == Block::MatrixType::sparse) {
+    const Block &b = *blocks[0];
+    if (std::shared_ptr<Sparse> d = inv_diagonal(b.get_sparse())) {
+      inverses.push_back(
+          Block(b.get_row_range(), b.get_column_range(), b.get_indices(), d));
+      return;
+    }
+    std::shared_ptr<Matrix> Ainv = std::make_shared<Matrix>();
+    if (inv_sparse_spd(*Ainv, b.get_sparse())) {
+      inverses.push_back(Block(
+          b.get_row_range(), b.get_column_range(), b.get_indices(), Ainv));
+      return;
+    }
+  }
+
   // Otherwise go on to precompute the inverse of a block consisting
   // of correlations between multiple retrieval quantities.
 
@@ -449,42 +598,46 @@ void CovarianceMatrix::invert_correlation_block(
     }
   }
 
-  // Copy blocks into a single dense matrix.
+  // Copy blocks into a single dense matrix. Sparse blocks are copied
+  // element-wise.
   Matrix A(n, n);
-  A = 0.0;
+  auto assemble = [&]() {
+    A = 0.0;
 
-  for (size_t i = 0; i < blocks.size(); ++i) {
-    Index ci, cj;
-    std::tie(ci, cj) = blocks[i]->get_indices();
-    Range row_range(block_start_cont[ci], block_extent_cont[ci]);
-    Range column_range(block_start_cont[cj], block_extent_cont[cj]);
-    MatrixView A_view = A(row_range, column_range);
+    Vector values;
+    ArrayOfIndex row_indices, column_indices;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+      Index ci, cj;
+      std::tie(ci, cj) = blocks[i]->get_indices();
+      Range row_range(block_start_cont[ci], block_extent_cont[ci]);
+      Range column_range(block_start_cont[cj], block_extent_cont[cj]);
+      MatrixView A_view = A(row_range, column_range);
 
-    if (blocks[i]->get_matrix_type() == Block::MatrixType::dense) {
-      A_view = blocks[i]->get_dense();
-    } else {
-      A_view = static_cast<const Matrix>(blocks[i]->get_sparse());
+      if (blocks[i]->get_matrix_type() == Block::MatrixType::dense) {
+        A_view = blocks[i]->get_dense();
+      } else {
+        blocks[i]->get_sparse().list_elements(
+            values, row_indices, column_indices);
+        for (Index k = 0; k < values.nelem(); ++k) {
+          A_view(row_indices[k], column_indices[k]) = values[k];
+        }
+      }
     }
-  }
 
-  for (Index i = 0; i < n; ++i) {
-    for (Index j = i + 1; j < n; ++j) {
-      A(j, i) = A(i, j);
+    for (Index i = 0; i < n; ++i) {
+      for (Index j = i + 1; j < n; ++j) {
+        A(j, i) = A(i, j);
+      }
     }
-  }
-  inv(A, A);
+  };
 
-  // // Invert matrix using LAPACK.
-  // char uplo = 'L';
-  // int  ni, info1(0), info2(0);
-  // ni = static_cast<int>(n);
-  // lapack::dpotrf_(&uplo, &ni, A.get_raw_data(), &ni, &info1);
-  // lapack::dpotri_(&uplo, &ni, A.get_raw_data(), &ni, &info2);
-  // if ((info1 != 0) || info2 !=0) {
-  //     throw std::runtime_error("Error inverting block of covariance matrix."
-  //                              "Make sure that it is symmetric, positive definite"
-  //                              "or provide the inverse manually.");
-  // }
+  // Covariance matrices are positive definite, which allows the Cholesky
+  // decomposition. LU decomposition is kept as fallback for other matrices.
+  assemble();
+  if (!inv_spd(A)) {
+    assemble();
+    inv(A, A);
+  }
 
   // Now we need to disassemble the matrix inverse bach to the separate block in the
   // covariance matrix. Note, however, that blocks that previously were implicitly
@@ -497,11 +650,14 @@ void CovarianceMatrix::invert_correlation_block(
         Range column_range_A(block_start_cont[bj], block_extent_cont[bj]);
         Range row_range(block_start[bi], block_extent[bi]);
         Range column_range(block_start[bj], block_extent[bj]);
-        MatrixView A_view = A(row_range_A, column_range_A);
-        inverses.push_back(Block(row_range,
-                                 column_range,
-                                 std::make_pair(bi, bj),
-                                 std::make_shared<Matrix>(A_view)));
+        std::shared_ptr<Matrix> A_block;
+        if (block_indices.size() == 1) {
+          A_block = std::make_shared<Matrix>(std::move(A));
+        } else {
+          A_block = std::make_shared<Matrix>(A(row_range_A, column_range_A));
+        }
+        inverses.push_back(Block(
+            row_range, column_range, std::make_pair(bi, bj), A_block));
       }
     }
   }
@@ -37,6 +37,7 @@
 #include <stdexcept>
 #include "agenda_class.h"
 #include "array.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "cloudbox.h"
@@ -56,6 +57,7 @@
 
 extern const Numeric PI;
 extern const Numeric RAD2DEG;
+extern const Numeric DEG2RAD;
 
 //FIXME function name of 'rte_step_doit_replacement' should be replaced by
 //proper name
@@ -1692,6 +1694,74 @@ void cloudbox_field_ngAcceleration(Tensor6& cloudbox_field_mono,
   }
 }
 
+void DoitAndersonMixing::update(Tensor6& cloudbox_field_mono,
+                                const Tensor6& cloudbox_field_mono_old) {
+  const Index n = cloudbox_field_mono.nvitrines() *
+                  cloudbox_field_mono.nshelves() *
+                  cloudbox_field_mono.nbooks() *
+                  cloudbox_field_mono.npages() * cloudbox_field_mono.nrows() *
+                  cloudbox_field_mono.ncols();
+
+  // Mapped field g = G(x_k) and residual f = G(x_k) - x_k
+  const Numeric* x_new = cloudbox_field_mono.get_c_array();
+  const Numeric* x_old = cloudbox_field_mono_old.get_c_array();
+  Vector g(n), f(n);
+  for (Index i = 0; i < n; i++) {
+    g[i] = x_new[i];
+    f[i] = x_new[i] - x_old[i];
+  }
+
+  if (mf_prev.nelem() == n) {
+    Vector df = f, dg = g;
+    df -= mf_prev;
+    dg -= mg_prev;
+    mdf.push_back(df);
+    mdg.push_back(dg);
+    if (mdf.nelem() > mdepth) {
+      mdf.erase(mdf.begin());
+      mdg.erase(mdg.begin());
+    }
+  } else {
+    mdf.clear();
+    mdg.clear();
+  }
+  mf_prev = f;
+  mg_prev = g;
+
+  const Index m = mdf.nelem();
+  if (!m) return;
+
+  // Least squares solution of min |f - df * gamma| from the normal
+  // equations, with a small regularisation for nearly parallel residuals
+  Matrix A(m, m);
+  Vector b(m), gamma(m);
+  for (Index i = 0; i < m; i++) {
+    b[i] = mdf[i] * f;
+    for (Index j = 0; j <= i; j++) A(i, j) = A(j, i) = mdf[i] * mdf[j];
+  }
+  Numeric trace = 0;
+  for (Index i = 0; i < m; i++) trace += A(i, i);
+  if (!(trace > 0)) return;
+  for (Index i = 0; i < m; i++) A(i, i) += 1e-12 * trace;
+
+  solve(gamma, A, b);
+  for (Index i = 0; i < m; i++) {
+    if (!std::isfinite(gamma[i])) {
+      // Start over with plain iterations
+      mdf.clear();
+      mdg.clear();
+      return;
+    }
+  }
+
+  Numeric* x = cloudbox_field_mono.get_c_array();
+  for (Index i = 0; i < n; i++) {
+    Numeric xi = g[i];
+    for (Index j = 0; j < m; j++) xi -= gamma[j] * mdg[j][i];
+    x[i] = xi;
+  }
+}
+
 void interp_cloud_coeff1D(  //Output
     Tensor3View ext_mat_int,
     MatrixView abs_vec_int,
@@ -1956,6 +2026,142 @@ void za_gridOpt(  //Output:
   }
 }
 
+void doit_scat_integral_weights(Matrix& weights,
+                                ConstVectorView za_grid,
+                                ConstVectorView aa_grid) {
+  const Index nza = za_grid.nelem();
+  const Index naa = aa_grid.nelem();
+  weights.resize(nza, naa);
+
+  // Trapezoidal weight of each grid point: half the width of the two
+  // neighbouring intervals. This holds for non-equidistant grids as well.
+  auto trapz_weight = [](ConstVectorView grid, Index i) {
+    Numeric d = 0;
+    if (i > 0) d += grid[i] - grid[i - 1];
+    if (i < grid.nelem() - 1) d += grid[i + 1] - grid[i];
+    return 0.5 * DEG2RAD * d;
+  };
+
+  for (Index i = 0; i < nza; i++) {
+    const Numeric wza = trapz_weight(za_grid, i) * sin(za_grid[i] * DEG2RAD);
+    if (naa == 1)
+      weights(i, 0) = wza;
+    else
+      for (Index j = 0; j < naa; j++)
+        weights(i, j) = wza * trapz_weight(aa_grid, j);
+  }
+}
+
+void doit_scat_operator(Matrix& scat_operator,
+                        ConstTensor5View pha_mat,
+                        ConstMatrixView weights) {
+  const Index nza_out = pha_mat.nshelves();
+  const Index nza_in = pha_mat.nbooks();
+  const Index naa_in = pha_mat.npages();
+  const Index stokes_dim = pha_mat.ncols();
+  assert(is_size(weights, nza_in, naa_in));
+
+  scat_operator.resize(nza_out * stokes_dim, nza_in * stokes_dim);
+  scat_operator = 0;
+
+  for (Index za_out = 0; za_out < nza_out; za_out++) {
+    for (Index za_in = 0; za_in < nza_in; za_in++) {
+      MatrixView block =
+          scat_operator(Range(za_out * stokes_dim, stokes_dim),
+                        Range(za_in * stokes_dim, stokes_dim));
+      for (Index aa_in = 0; aa_in < naa_in; aa_in++) {
+        const Numeric w = weights(za_in, aa_in);
+        for (Index i = 0; i < stokes_dim; i++)
+          for (Index j = 0; j < stokes_dim; j++)
+            block(i, j) += w * pha_mat(za_out, za_in, aa_in, i, j);
+      }
+    }
+  }
+}
+
+void doit_scat_pha_integral(MatrixView pha_int,
+                            ConstTensor4View pha_mat,
+                            ConstMatrixView weights) {
+  const Index stokes_dim = pha_mat.ncols();
+  assert(is_size(weights, pha_mat.nbooks(), pha_mat.npages()));
+  assert(is_size(pha_int, stokes_dim, stokes_dim));
+
+  pha_int = 0;
+  for (Index za_in = 0; za_in < pha_mat.nbooks(); za_in++) {
+    for (Index aa_in = 0; aa_in < pha_mat.npages(); aa_in++) {
+      const Numeric w = weights(za_in, aa_in);
+      for (Index i = 0; i < stokes_dim; i++)
+        for (Index j = 0; j < stokes_dim; j++)
+          pha_int(i, j) += w * pha_mat(za_in, aa_in, i, j);
+    }
+  }
+}
+
+namespace {
+//! Operator cache of the calling thread, see DoitScatOperators
+thread_local DoitScatOperators* doit_scat_operators_current = nullptr;
+}  // namespace
+
+DoitScatOperators::DoitScatOperators()
+    : mprevious(doit_scat_operators_current) {
+  doit_scat_operators_current = this;
+}
+
+DoitScatOperators::~DoitScatOperators() {
+  doit_scat_operators_current = mprevious;
+}
+
+void DoitScatOperators::build(Tensor3& operators,
+                              const Tensor7& pha_mat_doit,
+                              ConstMatrixView weights) {
+  const Index np = pha_mat_doit.nlibraries();
+  const Index stokes_dim = pha_mat_doit.ncols();
+  operators.resize(np,
+                   pha_mat_doit.nvitrines() * stokes_dim,
+                   pha_mat_doit.nbooks() * stokes_dim);
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && np > 1)
+  for (Index p_index = 0; p_index < np; p_index++) {
+    Matrix scat_operator;
+    doit_scat_operator(
+        scat_operator,
+        pha_mat_doit(p_index, joker, 0, joker, joker, joker, joker),
+        weights);
+    operators(p_index, joker, joker) = scat_operator;
+  }
+}
+
+const Tensor3& DoitScatOperators::Get(Tensor3& local,
+                                      const Tensor7& pha_mat_doit,
+                                      ConstMatrixView weights) {
+  DoitScatOperators* cache = doit_scat_operators_current;
+  if (not cache) {
+    build(local, pha_mat_doit, weights);
+    return local;
+  }
+
+  const ArrayOfIndex shape{pha_mat_doit.nlibraries(),
+                           pha_mat_doit.nvitrines(),
+                           pha_mat_doit.nshelves(),
+                           pha_mat_doit.nbooks(),
+                           pha_mat_doit.npages(),
+                           pha_mat_doit.nrows(),
+                           pha_mat_doit.ncols()};
+  bool same_weights = cache->mweights.nrows() == weights.nrows() and
+                      cache->mweights.ncols() == weights.ncols();
+  for (Index i = 0; same_weights and i < weights.nrows(); i++)
+    for (Index j = 0; same_weights and j < weights.ncols(); j++)
+      same_weights = cache->mweights(i, j) == weights(i, j);
+  if (cache->mpha_mat != pha_mat_doit.get_c_array() or
+      cache->mpha_mat_shape != shape or not same_weights) {
+    build(cache->moperators, pha_mat_doit, weights);
+    cache->mpha_mat = pha_mat_doit.get_c_array();
+    cache->mpha_mat_shape = shape;
+    cache->mweights = weights;
+  }
+  return cache->moperators;
+}
+
 void doit_scat_fieldNormalize(Workspace& ws,
                               Tensor6& doit_scat_field,
                               const Tensor6& cloudbox_field_mono,
@@ -35,6 +35,7 @@
 
 #include "agenda_class.h"
 #include "matpackVI.h"
+#include "matpackVII.h"
 #include "ppath.h"
 #include "propagationmatrix.h"
 
@@ -532,6 +533,98 @@ void cloudbox_field_ngAcceleration(  //Output
     const Index& accelerated,
     const Verbosity& verbosity);
 
+//! Anderson acceleration of the DOIT iteration
+/*!
+  One DOIT iteration is a fixed-point map G: the radiation field x_k is
+  mapped to x_k+1 = G(x_k) by calculating the scattered field and doing
+  the radiative transfer. Anderson mixing replaces G(x_k) by the
+  combination of the last depth + 1 mapped fields whose residuals
+  G(x) - x have the smallest norm (Walker and Ni, SIAM J. Numer. Anal.
+  49, 1715-1735, 2011).
+
+  The object keeps the differences of the residuals and of the mapped
+  fields of the previous iterations. Call update after every iteration
+  that has not converged.
+
+  \date 2026-10-15
+*/
+class DoitAndersonMixing {
+ public:
+  /** Constructor
+   *
+   * @param[in] depth Number of previous iterations used for the mixing.
+   */
+  explicit DoitAndersonMixing(Index depth) : mdepth(depth) {}
+
+  /** Mix the newest iterate with the previous ones
+   *
+   * @param[in,out] cloudbox_field_mono On input G(x_k), on output x_k+1.
+   * @param[in] cloudbox_field_mono_old The field x_k before the iteration.
+   */
+  void update(Tensor6& cloudbox_field_mono,
+              const Tensor6& cloudbox_field_mono_old);
+
+ private:
+  Index mdepth;
+  Vector mf_prev;
+  Vector mg_prev;
+  ArrayOfVector mdf;
+  ArrayOfVector mdg;
+};
+
+//! Scattering operators of all pressure levels of a 1D DOIT iteration
+/*!
+  cloudbox_field_monoIterate keeps an object of this class while it
+  iterates one frequency. doit_scat_fieldCalc and doit_scat_fieldCalcLimb
+  then build the operators of doit_scat_operator for all pressure levels
+  in the first iteration and reuse them in the following ones, as
+  pha_mat_doit and the angular grids do not change during the iteration.
+  Outside of such a scope the operators are built on each call.
+
+  The object is only seen by the thread that created it, so frequencies
+  iterated in parallel keep their own operators.
+
+  \date 2026-10-16
+*/
+class DoitScatOperators {
+ public:
+  /** Make this the operator cache of the calling thread */
+  DoitScatOperators();
+
+  /** Restore the previous operator cache of the calling thread */
+  ~DoitScatOperators();
+
+  DoitScatOperators(const DoitScatOperators&) = delete;
+  DoitScatOperators& operator=(const DoitScatOperators&) = delete;
+
+  /** Scattering operators of all pressure levels
+   *
+   * Returns the cached operators if the cache of the calling thread was
+   * built for the same pha_mat_doit and weights. Otherwise the operators
+   * are built, into the cache if there is one and into local if not.
+   *
+   * @param[out] local Storage used when there is no cache.
+   * @param[in] pha_mat_doit Phase matrices of a 1D atmosphere, size [p,
+   * za_out, 1, za_in, aa_in, stokes_dim, stokes_dim].
+   * @param[in] weights Integration weights from doit_scat_integral_weights.
+   * @return Operators, size [p, za_out * stokes_dim, za_in * stokes_dim].
+   */
+  static const Tensor3& Get(Tensor3& local,
+                            const Tensor7& pha_mat_doit,
+                            ConstMatrixView weights);
+
+ private:
+  static void build(Tensor3& operators,
+                    const Tensor7& pha_mat_doit,
+                    ConstMatrixView weights);
+
+  Tensor3 moperators;
+  const Numeric* mpha_mat{nullptr};
+  ArrayOfIndex mpha_mat_shape;
+  Matrix mweights;
+  DoitScatOperators* mprevious;
+};
+
 //! Interpolate all inputs of the VRTE on a propagation path step
 /*!
   Used in the WSM cloud_ppath_update1D.
@@ -615,6 +708,60 @@ void za_gridOpt(  //Output:
     const Numeric& acc,
     const Index& scat_za_interp);
 
+//! Quadrature weights of the scattering integral
+/*!
+  Sets up the weights of the trapezoidal integration over all incoming
+  directions used by *doit_scat_fieldCalc* and *doit_scat_fieldCalcLimb*,
+  including the sin(za) factor of the solid angle. The weights are taken
+  from the spacing of the grids, which do not need to be equidistant.
+  Summing weights(za, aa) times an integrand gives the same result as
+  AngIntegrate_trapezoid, or AngIntegrate_trapezoid divided by 2 pi for a
+  single azimuth angle.
+
+  \param[out] weights Weights, size [za_grid, aa_grid].
+  \param[in]  za_grid Zenith angle grid of incoming directions.
+  \param[in]  aa_grid Azimuth angle grid of incoming directions.
+
+  \date 2026-10-15
+*/
+void doit_scat_integral_weights(Matrix& weights,
+                                ConstVectorView za_grid,
+                                ConstVectorView aa_grid);
+
+//! Scattering integral operator of one atmospheric position
+/*!
+  Contracts the phase matrices of all pairs of scattered and incoming
+  zenith angles with the integration weights over the incoming azimuth
+  angles. The scattered field of a position is then the matrix-vector
+  product of the operator and the radiation field flattened as
+  [za_in * stokes_dim + j].
+
+  \param[out] scat_operator Operator, size [za_out * stokes_dim,
+                            za_in * stokes_dim].
+  \param[in]  pha_mat Phase matrices, size [za_out, za_in, aa_in,
+                      stokes_dim, stokes_dim].
+  \param[in]  weights Integration weights from doit_scat_integral_weights.
+
+  \date 2026-10-15
+*/
+void doit_scat_operator(Matrix& scat_operator,
+                        ConstTensor5View pha_mat,
+                        ConstMatrixView weights);
+
+//! Integrated phase matrix of one scattered direction
+/*!
+  \param[out] pha_int Phase matrix integrated over all incoming directions,
+                      size [stokes_dim, stokes_dim].
+  \param[in]  pha_mat Phase matrices, size [za_in, aa_in, stokes_dim,
+                      stokes_dim].
+  \param[in]  weights Integration weights from doit_scat_integral_weights.
+
+  \date 2026-10-15
+*/
+void doit_scat_pha_integral(MatrixView pha_int,
+                            ConstTensor4View pha_mat,
+                            ConstMatrixView weights);
+
 //! Normalization of scattered field
 /*!
   Calculate the scattered extinction field and apply the
@@ -24,14 +24,29 @@
 */
 
 #include "gas_abs_lookup.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
 #include <cfloat>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include "arts_omp.h"
 #include "check_input.h"
 #include "interpolation.h"
 #include "interpolation_poly.h"
 #include "logic.h"
 #include "messages.h"
 #include "physics_funcs.h"
+#include "xml_io_types.h"
 
 //! Find positions of new grid points in old grid.
 /*! 
@@ -121,6 +136,10 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   CREATE_OUT2;
   CREATE_OUT3;
 
+  // The table may be owned or memory mapped. Only the selected species and
+  // frequencies are copied into the new table below.
+  const ConstTensor4View xsec_table = GetXsec();
+
   // Some constants we will need:
   const Index n_current_species = current_species.nelem();
   const Index n_current_f_grid = current_f_grid.nelem();
@@ -226,7 +245,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
       //     b = n_species
       //     c = n_f_grid
       //     d = n_p_grid
-      chk_size("xsec", xsec, 1, n_species, n_f_grid, n_p_grid);
+      chk_size("xsec", xsec_table, 1, n_species, n_f_grid, n_p_grid);
     } else {
       //     Standard case (temperature perturbations,
       //     but no vmr perturbations):
@@ -234,7 +253,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
       //     b = n_species
       //     c = n_f_grid
       //     d = n_p_grid
-      chk_size("xsec", xsec, t_pert.nelem(), n_species, n_f_grid, n_p_grid);
+      chk_size("xsec", xsec_table, t_pert.nelem(), n_species, n_f_grid, n_p_grid);
     }
   } else {
     //     Full case (with temperature perturbations and
@@ -248,7 +267,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
     Index c = n_f_grid;
     Index d = n_p_grid;
 
-    chk_size("xsec", xsec, a, b, c, d);
+    chk_size("xsec", xsec_table, a, b, c, d);
   }
 
   // We also need indices to the positions of the original species
@@ -401,11 +420,12 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   }
 
   // Absorption coefficients:
-  new_table.xsec.resize(
-      xsec.nbooks(),
+  Tensor4& new_xsec = new_table.Xsec();
+  new_xsec.resize(
+      xsec_table.nbooks(),
       n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
       n_current_f_grid,
-      xsec.ncols());
+      xsec_table.ncols());
 
   // We have to copy the right species and frequencies from the old to
   // the new table. Temperature perturbations and pressure grid remain
@@ -426,15 +446,16 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
     // Do frequencies:
     for (Index i_f = 0; i_f < n_current_f_grid; ++i_f) {
       if (i_current_species[i_s] >= 0) {
-        new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
-            xsec(Range(joker),
-                 Range(original_spec_pos_in_xsec[i_current_species[i_s]], n_v),
-                 i_current_f_grid[i_f],
-                 Range(joker));
+        new_xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
+            xsec_table(
+                Range(joker),
+                Range(original_spec_pos_in_xsec[i_current_species[i_s]], n_v),
+                i_current_f_grid[i_f],
+                Range(joker));
       } else {
         // Here we handle the case of the trivial species, which we simply
         // set to NAN:
-        new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) = NAN;
+        new_xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) = NAN;
       }
 
       //           cout << "result: " << xsec( Range(joker),
@@ -458,70 +479,97 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   gridpos_poly(fgp_default, f_grid, f_grid, 0);
 }
 
-//! Extract scalar gas absorption coefficients from the lookup table.
-/*!  
-  This carries out a simple interpolation in temperature,
-  pressure, and sometimes frequency. The interpolated value is then 
-  scaled by the ratio between
-  actual VMR and reference VMR. In the case of nonlinear species the
-  interpolation goes also over H2O VMR.
+//! Grid positions and species positions of GasAbsLookup::Extract.
+/*!
+  One of these is kept per thread, see GasAbsLookup::ExtractScratch. Since
+  the sizes rarely change between calls, extracting absorption point by
+  point then does not allocate anything.
+*/
+struct GasAbsLookup::ExtractState {
+  //! Frequency grid positions in use, fgp_default or fgp_local.
+  const ArrayOfGridPosPoly* fgp;
 
-  All input parameters 
-  must be in the range covered by the table. Violation will result in a
-  runtime error. Those checks are here, because they are a bit
-  difficult to make outside, due to the irregularity of the
-  grids. Otherwise there are no runtime checks in this function, only
-  assertions. This is, because the function is called many times
-  inside the RT calculation.
+  //! Frequency grid positions for a grid other than the one of the table.
+  ArrayOfGridPosPoly fgp_local;
 
-  In this case pressure is not an altitude coordinate, so we are free
-  to choose the type of interpolation that gives lowest interpolation
-  errors or is easiest. I tested both linear and log p interpolation
-  with the result that log p interpolation is slightly better, so that
-  is used.
+  //! The table frequency grid fgp_local was set up for.
+  Vector fgp_table_f_grid;
 
-  \param[out] sga A Matrix with scalar gas absorption coefficients
-              [1/m]. Dimension is adjusted automatically to [n_species,f_grid].
- 
-  \param[in] p_interp_order Interpolation order for pressure.
+  //! The frequency grid fgp_local was set up for.
+  Vector fgp_new_f_grid;
 
-  \param[in] t_interp_order Interpolation order for temperature.
- 
-  \param[in] h2o_interp_order Interpolation order for water vapor.
- 
-  \param[in] f_interp_order Interpolation order for frequency. This should
-             normally be zero, except for calculations with Doppler shift.
- 
-  \param[in] p The pressures [Pa].
+  //! The interpolation order fgp_local was set up for, -1 if not set up.
+  Index fgp_order = -1;
 
-  \param[in] T The temperature [K].
+  //! Position of the first profile of each species in xsec.
+  /*! Species such as Zeeman and free_electrons are not stored in the
+      lookup table, they are flagged with -1. */
+  ArrayOfIndex xsec_pos;
 
-  \param[in] abs_vmrs The VMRs [absolute number]. Dimension: [species].  
+  //! Flag for the nonlinear species.
+  ArrayOfIndex non_linear;
 
-  \param[in] new_f_grid The frequency grid where absorption should be 
-             extracted. With frequency interpolation order 0, this has
-             to match the lookup table's internal grid, or have exactly
-             1 element. With higher frequency interpolation order it can be
-             an arbitrary grid.
- 
-  \param[in] extpolfac How much extrapolation to allow. Useful for Doppler 
-             calculations. (But there even better to make the lookup table
-             grid wider and denser than the calculation grid.)
- 
-  \date 2002-09-20, 2003-02-22, 2007-05-22, 2013-04-29
+  //! Species index of H2O, or -1 if there are no nonlinear species.
+  Index h2o_index;
 
-  \author Stefan Buehler
+  //! Number of pressure levels used in the pressure interpolation.
+  Index n_pi;
+
+  //! Pressure grid positions, one per point.
+  ArrayOfGridPosPoly pgp;
+
+  //! Temperature grid positions.
+  /*! One per point and pressure level used in the interpolation, empty if
+      the table has no temperature perturbations. */
+  ArrayOfGridPosPoly tgp;
+
+  //! H2O grid positions, as tgp, empty if there are no nonlinear species.
+  ArrayOfGridPosPoly vgp;
+};
+
+//! The ExtractState of the calling thread.
+GasAbsLookup::ExtractState& GasAbsLookup::ExtractScratch() {
+  thread_local ExtractState state;
+  return state;
+}
+
+//! The GridPosPoly that corresponds to "no interpolation at all".
+static const GridPosPoly& trivial_gridpos() {
+  static const GridPosPoly gp_trivial{ArrayOfIndex(1, 0), Vector(1, 1)};
+  return gp_trivial;
+}
+
+//! Whether two grids have the same size and values.
+static bool same_grid(ConstVectorView a, ConstVectorView b) {
+  if (a.nelem() != b.nelem()) return false;
+  for (Index i = 0; i < a.nelem(); ++i)
+    if (a[i] != b[i]) return false;
+  return true;
+}
+
+//! Checks of Extract and the setup that does not depend on the points.
+/*!
+  Checks the table and the interpolation orders, and sets the frequency
+  grid positions and the species positions of state.
+
+  \param[in,out] state The extraction state of the calling thread.
+  \param[in] p_interp_order Interpolation order for pressure.
+  \param[in] t_interp_order Interpolation order for temperature.
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+  \param[in] f_interp_order Interpolation order for frequency.
+  \param[in] n_vmrs Number of species of the VMRs of the points.
+  \param[in] new_f_grid The frequency grid where absorption should be
+             extracted.
+
+  \date 2026-10-16
 */
-void GasAbsLookup::Extract(Matrix& sga,
-                           const Index& p_interp_order,
-                           const Index& t_interp_order,
-                           const Index& h2o_interp_order,
-                           const Index& f_interp_order,
-                           const Numeric& p,
-                           const Numeric& T,
-                           ConstVectorView abs_vmrs,
-                           ConstVectorView new_f_grid,
-                           const Numeric& extpolfac) const {
+void GasAbsLookup::ExtractSetup(ExtractState& state,
+                                const Index& p_interp_order,
+                                const Index& t_interp_order,
+                                const Index& h2o_interp_order,
+                                const Index& f_interp_order,
+                                const Index& n_vmrs,
+                                ConstVectorView new_f_grid) const {
   // 1. Obtain some properties of the lookup table:
 
   // Number of gas species in the table:
@@ -555,16 +603,16 @@ void GasAbsLookup::Extract(Matrix& sga,
   // If there are nonlinear species, then at least one species must be
   // H2O. We will use that to perturb in the case of nonlinear
   // species.
-  Index h2o_index = -1;
+  state.h2o_index = -1;
   if (n_nls > 0) {
-    h2o_index =
+    state.h2o_index =
         find_first_species_tg(species, species_index_from_species_name("H2O"));
 
     // This is a runtime error, even though it would be more logical
     // for it to be an assertion, since it is an internal check on
     // the table. The reason is that it is somewhat awkward to check
     // for this in other places.
-    if (h2o_index == -1) {
+    if (state.h2o_index == -1) {
       ostringstream os;
       os << "With nonlinear species, at least one species must be a H2O species.";
       throw runtime_error(os.str());
@@ -587,17 +635,7 @@ void GasAbsLookup::Extract(Matrix& sga,
     b = n_species + n_nls * (n_nls_pert - 1);
     c = n_f_grid;
     d = n_p_grid;
-    //       cout << "xsec: "
-    //            << xsec.nbooks() << ", "
-    //            << xsec.npages() << ", "
-    //            << xsec.nrows() << ", "
-    //            << xsec.ncols() << "\n";
-    //       cout << "a b c d: "
-    //            << a << ", "
-    //            << b << ", "
-    //            << c << ", "
-    //            << d << "\n";
-    assert(is_size(xsec, a, b, c, d));
+    assert(is_size(GetXsec(), a, b, c, d));
   })
 
   // Make sure that log_p_grid is initialized:
@@ -650,7 +688,7 @@ void GasAbsLookup::Extract(Matrix& sga,
   // 3. Checks on the input variables:
 
   // Check that abs_vmrs has the right dimension:
-  if (!is_size(abs_vmrs, n_species)) {
+  if (n_vmrs != n_species) {
     ostringstream os;
     os << "Number of species in lookup table does not match number\n"
        << "of species for which you want to extract absorption.\n"
@@ -663,117 +701,181 @@ void GasAbsLookup::Extract(Matrix& sga,
 
   // 4.a Frequency grid positions
 
-  // Frequency grid positions. The pointer is used to save copying of the
-  // default from the lookup table.
-  const ArrayOfGridPosPoly* fgp;
-  ArrayOfGridPosPoly fgp_local;
-
-  // With f_interp_order 0 the frequency grid has to have the same size as in the
-  // lookup table, or exactly one element. If it matches the lookup table, we
+  // With f_interp_order 0 the frequency grid has to be the one of the lookup
+  // table, or a subset of its frequencies. If it matches the lookup table, we
   // do no frequency interpolation at all. (We set the frequency grid positions
   // to the predefined ones that come with the lookup table.)
-  if (f_interp_order == 0) {
-
-    // We do some superficial checks below, to make sure that the
-    // frequency grid is the same as in the lookup table (only first
-    // and last element of f_grid are tested). As margin for
-    // agreement, we pick a value that is just slightly smaller than
-    // the perturbation that is used by the wind jacobian, which is 0.1.
-    const Numeric allowed_f_margin = 0.09;
-    
-    if (n_new_f_grid == n_f_grid) {
-      // Use the default fgp that is stored in the lookup table itself
-      // (which effectively means no frequency interpolation)
-      fgp = &fgp_default;
-
-      // Check first f_grid element:
-      if (abs(f_grid[0] - new_f_grid[0]) > allowed_f_margin)
-      {
-        ostringstream os;
-        os << "First frequency in f_grid inconsistent with lookup table.\n"
-           << "f_grid[0]        = " << f_grid[0] << "\n"
-           << "new_f_grid[0] = " << new_f_grid[0] << ".";
-        throw runtime_error(os.str());
-      }
 
-      // Check last f_grid element:
-      if (abs(f_grid[n_f_grid - 1] - new_f_grid[n_new_f_grid - 1]) > allowed_f_margin)
-      {
-        ostringstream os;
-        os << "Last frequency in f_grid inconsistent with lookup table.\n"
-           << "f_grid[n_f_grid-1]              = " << f_grid[n_f_grid - 1]
-           << "\n"
-           << "new_f_grid[n_new_f_grid-1] = " << new_f_grid[n_new_f_grid - 1]
-           << ".";
-        throw runtime_error(os.str());
-      }
-    } else if (n_new_f_grid == 1) {
-      fgp = &fgp_local;
-      fgp_local.resize(1);
-      gridpos_poly(fgp_local, f_grid, new_f_grid, 0);
+  // We do some superficial checks below, to make sure that the
+  // frequency grid is the same as in the lookup table (only first
+  // and last element of f_grid are tested). As margin for
+  // agreement, we pick a value that is just slightly smaller than
+  // the perturbation that is used by the wind jacobian, which is 0.1.
+  const Numeric allowed_f_margin = 0.09;
 
-      // Check that we really are on a frequency grid point, for safety's sake.
-      if (abs(f_grid[fgp_local[0].idx[0]] - new_f_grid[0]) > allowed_f_margin)
-      {
-	ostringstream os;
-	os << "Cannot find a matching lookup table frequency for frequency "
-	   << new_f_grid[0] << ".\n"
-	   << "(This check has not been properly tested, so perhaps this is\n"
-	   << "a false alarm. Check for this in file gas_abs_lookup.cc.)";
-	throw runtime_error(os.str());
-      }
-    } else {
+  if (f_interp_order == 0 && n_new_f_grid == n_f_grid) {
+    // Use the default fgp that is stored in the lookup table itself
+    // (which effectively means no frequency interpolation)
+    state.fgp = &fgp_default;
+
+    // Check first f_grid element:
+    if (abs(f_grid[0] - new_f_grid[0]) > allowed_f_margin)
+    {
       ostringstream os;
-      os << "With f_interp_order 0 the frequency grid has to have the same\n"
-         << "size as in the lookup table, or exactly one element.";
+      os << "First frequency in f_grid inconsistent with lookup table.\n"
+         << "f_grid[0]        = " << f_grid[0] << "\n"
+         << "new_f_grid[0] = " << new_f_grid[0] << ".";
       throw runtime_error(os.str());
     }
-  } else {
-    const Numeric f_min = f_grid[0] - 0.5 * (f_grid[1] - f_grid[0]);
-    const Numeric f_max = f_grid[n_f_grid - 1] +
-                          0.5 * (f_grid[n_f_grid - 1] - f_grid[n_f_grid - 2]);
-    if (new_f_grid[0] < f_min) {
+
+    // Check last f_grid element:
+    if (abs(f_grid[n_f_grid - 1] - new_f_grid[n_new_f_grid - 1]) > allowed_f_margin)
+    {
       ostringstream os;
-      os << "Problem with gas absorption lookup table.\n"
-         << "At least one frequency is outside the range covered by the lookup table.\n"
-         << "Your new frequency value is " << new_f_grid[0] << " Hz.\n"
-         << "The allowed range is " << f_min << " to " << f_max << " Hz.";
+      os << "Last frequency in f_grid inconsistent with lookup table.\n"
+         << "f_grid[n_f_grid-1]              = " << f_grid[n_f_grid - 1]
+         << "\n"
+         << "new_f_grid[n_new_f_grid-1] = " << new_f_grid[n_new_f_grid - 1]
+         << ".";
       throw runtime_error(os.str());
     }
-    if (new_f_grid[n_new_f_grid - 1] > f_max) {
-      ostringstream os;
-      os << "Problem with gas absorption lookup table.\n"
-         << "At least one frequency is outside the range covered by the lookup table.\n"
-         << "Your new frequency value is " << new_f_grid[n_new_f_grid - 1]
-         << " Hz.\n"
-         << "The allowed range is " << f_min << " to " << f_max << " Hz.";
-      throw runtime_error(os.str());
+  } else {
+    // Other grid positions are kept for the next call, which usually is
+    // for the same frequency grid.
+    const bool fgp_local_is_set = state.fgp_order == f_interp_order &&
+                                  same_grid(state.fgp_table_f_grid, f_grid) &&
+                                  same_grid(state.fgp_new_f_grid, new_f_grid);
+
+    if (f_interp_order != 0) {
+      const Numeric f_min = f_grid[0] - 0.5 * (f_grid[1] - f_grid[0]);
+      const Numeric f_max =
+          f_grid[n_f_grid - 1] +
+          0.5 * (f_grid[n_f_grid - 1] - f_grid[n_f_grid - 2]);
+      if (new_f_grid[0] < f_min) {
+        ostringstream os;
+        os << "Problem with gas absorption lookup table.\n"
+           << "At least one frequency is outside the range covered by the lookup table.\n"
+           << "Your new frequency value is " << new_f_grid[0] << " Hz.\n"
+           << "The allowed range is " << f_min << " to " << f_max << " Hz.";
+        throw runtime_error(os.str());
+      }
+      if (new_f_grid[n_new_f_grid - 1] > f_max) {
+        ostringstream os;
+        os << "Problem with gas absorption lookup table.\n"
+           << "At least one frequency is outside the range covered by the lookup table.\n"
+           << "Your new frequency value is " << new_f_grid[n_new_f_grid - 1]
+           << " Hz.\n"
+           << "The allowed range is " << f_min << " to " << f_max << " Hz.";
+        throw runtime_error(os.str());
+      }
     }
 
-    // We do have real frequency interpolation (f_interp_order!=0).
-    fgp = &fgp_local;
-    fgp_local.resize(n_new_f_grid);
-    gridpos_poly(fgp_local, f_grid, new_f_grid, f_interp_order);
+    if (!fgp_local_is_set) {
+      state.fgp_order = -1;
+      state.fgp_local.resize(n_new_f_grid);
+      gridpos_poly(state.fgp_local, f_grid, new_f_grid, f_interp_order);
+
+      // With f_interp_order 0 this is a subset of the table frequencies,
+      // for example a single frequency or a frequency chunk of yCalc. Check
+      // that we really are on frequency grid points, for safety's sake.
+      if (f_interp_order == 0) {
+        for (Index i = 0; i < n_new_f_grid; i++) {
+          if (abs(f_grid[state.fgp_local[i].idx[0]] - new_f_grid[i]) >
+              allowed_f_margin) {
+            ostringstream os;
+            os << "Cannot find a matching lookup table frequency for frequency "
+               << new_f_grid[i] << ".\n"
+               << "With f_interp_order 0 the frequency grid has to be the\n"
+               << "frequency grid of the lookup table, or a subset of it.";
+            throw runtime_error(os.str());
+          }
+        }
+      }
+
+      state.fgp_table_f_grid.resize(n_f_grid);
+      state.fgp_table_f_grid = f_grid;
+      state.fgp_new_f_grid.resize(n_new_f_grid);
+      state.fgp_new_f_grid = new_f_grid;
+      state.fgp_order = f_interp_order;
+    }
+    state.fgp = &state.fgp_local;
   }
 
   // 4.b Other stuff
 
-  // Flag for temperature interpolation, if this is not 0 we want
-  // to do T interpolation:
-  const Index do_T = n_t_pert;
-
   // Set up a logical array for the nonlinear species
-  ArrayOfIndex non_linear(n_species, 0);
+  state.non_linear.resize(n_species);
+  for (Index si = 0; si < n_species; ++si) state.non_linear[si] = 0;
   for (Index s = 0; s < n_nls; ++s) {
-    non_linear[nonlinear_species[s]] = 1;
+    state.non_linear[nonlinear_species[s]] = 1;
   }
 
-  // Calculate the number density for the given pressure and
-  // temperature:
-  // n = n0*T0/p0 * p/T or n = p/kB/t, ideal gas law
-  const Numeric n = number_density(p, T);
+  // Position of the first profile of each species in xsec. This is
+  // needed to find the right subsection of xsec in the presence of
+  // nonlinear species.
+  state.xsec_pos.resize(n_species);
+  {
+    Index fpi = 0;
+    for (Index si = 0; si < n_species; ++si) {
+      if (is_zeeman(species[si]) ||
+          species[si][0].Type() == SpeciesTag::TYPE_FREE_ELECTRONS ||
+          species[si][0].Type() == SpeciesTag::TYPE_PARTICLES) {
+        if (state.non_linear[si]) {
+          ostringstream os;
+          os << "Problem with gas absorption lookup table.\n"
+             << "VMR interpolation is not allowed for species \""
+             << species[si][0].Name() << "\"";
+          throw runtime_error(os.str());
+        }
+        state.xsec_pos[si] = -1;
+        fpi++;
+      } else {
+        state.xsec_pos[si] = fpi;
+        if (state.non_linear[si])
+          fpi += n_nls_pert;
+        else
+          fpi++;
+      }
+    }
+
+    // fpi should have reached the end of that dimension of xsec. Check
+    // this with an assertion:
+    assert(fpi == GetXsec().npages());
+  }
+
+  state.n_pi = p_interp_order + 1;
+}
 
-  // 5. Determine pressure grid position and interpolation weights:
+//! Determine the grid positions of one point for Extract.
+/*!
+  Sets the pressure, temperature, and H2O grid positions of the point with
+  index ip in state, after checking that the point is inside the table.
+
+  \param[in,out] state The extraction state, set up by ExtractSetup.
+  \param[in] ip Index of the point.
+  \param[in] p_interp_order Interpolation order for pressure.
+  \param[in] t_interp_order Interpolation order for temperature.
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+  \param[in] p The pressure [Pa].
+  \param[in] T The temperature [K].
+  \param[in] h2o_vmr The H2O VMR, only used with nonlinear species.
+  \param[in] extpolfac How much extrapolation to allow.
+
+  \date 2026-10-16
+*/
+void GasAbsLookup::ExtractGridPos(ExtractState& state,
+                                  const Index& ip,
+                                  const Index& p_interp_order,
+                                  const Index& t_interp_order,
+                                  const Index& h2o_interp_order,
+                                  const Numeric& p,
+                                  const Numeric& T,
+                                  const Numeric& h2o_vmr,
+                                  const Numeric& extpolfac) const {
+  const Index n_p_grid = p_grid.nelem();
+  const Index n_t_pert = t_pert.nelem();
+  const Index n_nls_pert = nls_pert.nelem();
+  const Index n_pi = state.n_pi;
 
   // Check that p is inside the grid. (p_grid is sorted in decreasing order.)
   {
@@ -796,97 +898,20 @@ void GasAbsLookup::Extract(Matrix& sga,
   // For sure, we need to store the pressure grid position.
   // We do the interpolation in log(p). Test have shown that this
   // gives slightly better accuracy than interpolating in p directly.
-  ArrayOfGridPosPoly pgp(1);
+  GridPosPoly& pgp = state.pgp[ip];
   gridpos_poly(pgp, log_p_grid, log(p), p_interp_order);
 
-  // Pressure interpolation weights:
-  Vector pitw;
-  pitw.resize(p_interp_order + 1);
-  interpweights(pitw, pgp[0]);
-
-  // Define also other grid positions and interpolation weights here, so that
-  // we do not have to allocate them over and over in the loops below.
-
-  // Define the ArrayOfGridPosPoly that corresponds to "no interpolation at all".
-  ArrayOfGridPosPoly gp_trivial(1);
-  gp_trivial[0].idx.resize(1);
-  gp_trivial[0].w.resize(1);
-  gp_trivial[0].idx[0] = 0;
-  gp_trivial[0].w[0] = 1;
-
-  // Temperature grid positions.
-  ArrayOfGridPosPoly tgp_withT(1);  // Only a scalar.
-  ArrayOfGridPosPoly* tgp;  // Pointer to either tgp_withT or gp_trivial.
-
-  // Set this_t_interp_order, depending on whether we do T interpolation or not.
-  Index this_t_interp_order;  // Local T interpolation order
-  if (do_T) {
-    this_t_interp_order = t_interp_order;
-    tgp = &tgp_withT;
-  } else {
-    // For the !do_T case we simply take the single
-    // temperature that is there, so we point tgp accordingly.
-    this_t_interp_order = 0;
-    tgp = &gp_trivial;
-  }
-
-  // H2O(VMR) grid positions. vgp is what will be used in the interpolation.
-  // Depending on species, it is either pointed to gp_trivial, or to vgp_h2o.
-  ArrayOfGridPosPoly* vgp;
-  ArrayOfGridPosPoly vgp_h2o(1);  // only a scalar
-
-  // 6. We do the T and VMR interpolation for the pressure levels
+  // We do the T and VMR grid positions for the pressure levels
   // that are used in the pressure interpolation. (How many depends on
   // p_interp_order.)
-
-  // To store the interpolated result for the p_interp_order+1
-  // pressure levels:
-  // xsec dimensions are:
-  //   Temperature
-  //   H2O
-  //   Frequency
-  //   Pressure
-  // Dimensions of pre_interpolated are:
-  //   Pressure    (interpolation points)
-  //   Species
-  //   Temperature (always 1)
-  //   H2O         (always 1)
-  //   Frequency
-
-  Tensor5 xsec_pre_interpolated;
-  xsec_pre_interpolated.resize(
-      p_interp_order + 1, n_species, 1, 1, n_new_f_grid);
-
-  // Define variables for interpolation weights outside the loops.
-  // We will make itw point to either the weights with H2O interpolation, or
-  // the ones without.
-  Tensor4 itw_withH2O, itw_noH2O, *itw;
-
-  for (Index pi = 0; pi < p_interp_order + 1; ++pi) {
-    // Throw a runtime error if one of the reference VMR profiles is zero, but
-    // abs_vmrs is not. (This means that the lookup table was calculated with a
-    // reference profile of zero for that gas.)
-    //      for (Index si=0; si<n_species; ++si)
-    //        if ( (vmrs_ref(si,pi) == 0) &&
-    //            (abs_vmrs[si]    != 0) )
-    //        {
-    //          ostringstream os;
-    //          os << "Reference VMR profile is zero, you cannot extract\n"
-    //          << "Absorption for this species.\n"
-    //          << "Species: " << si
-    //          << " (" << get_species_name(species[si]) << ")\n"
-    //          << "Lookup table pressure level: " << pi
-    //          << " (" <<  p_grid[pi] << " Pa).";
-    //          throw runtime_error( os.str() );
-    //        }
-
+  for (Index pi = 0; pi < n_pi; ++pi) {
     // Index into p_grid:
-    const Index this_p_grid_index = pgp[0].idx[pi];
+    const Index this_p_grid_index = pgp.idx[pi];
 
     // Determine temperature grid position. This is only done if we
-    // want temperature interpolation, but the variable tgp has to
-    // be visible also outside for later use:
-    if (do_T) {
+    // want temperature interpolation. For the other case Extract simply
+    // takes the single temperature that is there.
+    if (n_t_pert) {
       // Temperature in the atmosphere is altitude
       // dependent. When we do the interpolation for the pressure level
       // below and above our point, we should correct the target value of
@@ -918,8 +943,6 @@ void GasAbsLookup::Extract(Matrix& sga,
       // Convert temperature to offset from t_ref:
       const Numeric T_offset = T - effective_T_ref;
 
-      //          cout << "T_offset = " << T_offset << endl;
-
       // Check that temperature offset is inside the allowed range.
       {
         const Numeric t_min = t_pert[0] - extpolfac * (t_pert[1] - t_pert[0]);
@@ -941,36 +964,24 @@ void GasAbsLookup::Extract(Matrix& sga,
         }
       }
 
-      gridpos_poly(tgp_withT, t_pert, T_offset, t_interp_order, extpolfac);
+      gridpos_poly(state.tgp[ip * n_pi + pi],
+                   t_pert,
+                   T_offset,
+                   t_interp_order,
+                   extpolfac);
     }
 
     // Determine the H2O VMR grid position. We need to do this only
     // once, since the only species who's VMR is interpolated is
-    // H2O. We do this only if there are nonlinear species, but the
-    // variable has to be visible later.
-    if (n_nls > 0) {
-      // Similar to the T case, we first interpolate the reference
-      // VMR to the pressure of extraction, then compare with
-      // the extraction VMR to determine the offset/fractional
-      // difference for the VMR interpolation.
-      //
-      // No! The above approach leads to problems when combined with
-      // higher order pressure interpolation. The problem is that
-      // the reference T and VMR profiles may be very
-      // irregular. (For example the H2O profile often has a big
-      // jump near the bottom.) That sometimes leads to negative
-      // effective reference values when the reference profile is
-      // interpolated. I therefore reverted back to the original
-      // version of using the real temperature and humidity, not
-      // the interpolated one.
-
-      //           const Numeric effective_vmr_ref = interp(pitw,
-      //                                                    vmrs_ref(h2o_index, Range(joker)),
-      //                                                    pgp);
-      const Numeric effective_vmr_ref = vmrs_ref(h2o_index, this_p_grid_index);
+    // H2O. We do this only if there are nonlinear species.
+    if (state.h2o_index >= 0) {
+      // Similar to the T case, we use the real humidity, not the
+      // reference profile interpolated to the pressure of extraction.
+      const Numeric effective_vmr_ref =
+          vmrs_ref(state.h2o_index, this_p_grid_index);
 
       // Fractional VMR:
-      const Numeric VMR_frac = abs_vmrs[h2o_index] / effective_vmr_ref;
+      const Numeric VMR_frac = h2o_vmr / effective_vmr_ref;
 
       // Check that VMR_frac is inside the allowed range.
       {
@@ -984,11 +995,12 @@ void GasAbsLookup::Extract(Matrix& sga,
         if ((VMR_frac > x_max) || (VMR_frac < x_min)) {
           ostringstream os;
           os << "Problem with gas absorption lookup table.\n"
-             << "VMR for H2O (species " << h2o_index
+             << "VMR for H2O (species " << state.h2o_index
              << ") is outside the range covered by the lookup table.\n"
-             << "Your VMR was " << abs_vmrs[h2o_index] << " at a pressure of "
-             << p << " Pa.\n"
-             << "The reference VMR value there is " << effective_vmr_ref << "\n"
+             << "Your VMR was " << h2o_vmr << " at a pressure of " << p
+             << " Pa.\n"
+             << "The reference VMR value there is " << effective_vmr_ref
+             << "\n"
              << "The fractional VMR relative to the reference value is "
              << VMR_frac << ".\n"
              << "The allowed range is " << x_min << " to " << x_max << ".\n"
@@ -1000,143 +1012,767 @@ void GasAbsLookup::Extract(Matrix& sga,
       }
 
       // For now, do linear interpolation in the fractional VMR.
-      gridpos_poly(vgp_h2o, nls_pert, VMR_frac, h2o_interp_order, extpolfac);
+      gridpos_poly(state.vgp[ip * n_pi + pi],
+                   nls_pert,
+                   VMR_frac,
+                   h2o_interp_order,
+                   extpolfac);
     }
+  }
+}
 
-    // Precalculate interpolation weights.
-    if (n_nls < n_species) {
-      // Precalculate weights without H2O interpolation if there are less
-      // nonlinear species than total species. (So at least one species
-      // without H2O interpolation.)
-      itw_noH2O.resize(1,
-                       1,
-                       n_new_f_grid,
-                       (this_t_interp_order + 1) * (1) *  // H2O dimension
-                           (f_interp_order + 1));
-      interpweights(itw_noH2O, *tgp, gp_trivial, *fgp);
-    }
-    if (n_nls > 0) {
-      // Precalculate weights with H2O interpolation if there is at least
-      // one nonlinear species.
-      itw_withH2O.resize(1,
-                         1,
-                         n_new_f_grid,
-                         (this_t_interp_order + 1) * (h2o_interp_order + 1) *
-                             (f_interp_order + 1));
-      interpweights(itw_withH2O, *tgp, vgp_h2o, *fgp);
-    }
+//! Interpolate the absorption of one point for Extract.
+/*!
+  For each species and pressure level used in the pressure interpolation
+  the contributions of the temperature and H2O perturbations are summed
+  up, with frequency as the innermost loop. Nothing is allocated.
+
+  \param[out] sga The absorption of the point. Dimension: [n_species,
+              n_new_f_grid].
+  \param[in] state The extraction state, with the grid positions of the
+             point set by ExtractGridPos.
+  \param[in] ip Index of the point.
+  \param[in] p The pressure [Pa].
+  \param[in] T The temperature [K].
+  \param[in] abs_vmrs The VMRs of the point. Dimension: [species].
 
-    // 7. Loop species:
-    Index fpi = 0;
-    for (Index si = 0; si < n_species; ++si) {
-      // Flag for VMR interpolation, if this is not 0 we want to
-      // do VMR interpolation:
-      const Index do_VMR = non_linear[si];
-
-      // For interpolation result.
-      // Fixed pressure level and species.
-      // Free dimension is T, H2O, and frequency.
-      Tensor3View res(xsec_pre_interpolated(
-          pi, si, Range(joker), Range(joker), Range(joker)));
-
-      // Ignore species such as Zeeman and free_electrons which are not
-      // stored in the lookup table. For those the result is set to 0.
-      if (is_zeeman(species[si]) ||
-          species[si][0].Type() == SpeciesTag::TYPE_FREE_ELECTRONS ||
-          species[si][0].Type() == SpeciesTag::TYPE_PARTICLES) {
-        if (do_VMR) {
-          ostringstream os;
-          os << "Problem with gas absorption lookup table.\n"
-             << "VMR interpolation is not allowed for species \""
-             << species[si][0].Name() << "\"";
-          throw runtime_error(os.str());
+  \date 2026-10-16
+*/
+void GasAbsLookup::ExtractPoint(MatrixView sga,
+                                const ExtractState& state,
+                                const Index& ip,
+                                const Numeric& p,
+                                const Numeric& T,
+                                ConstVectorView abs_vmrs) const {
+  // The table may be owned or memory mapped:
+  const ConstTensor4View xsec_table = GetXsec();
+
+  const Index n_pi = state.n_pi;
+  const ArrayOfGridPosPoly& fgp = *state.fgp;
+  const Index n_new_f_grid = fgp.nelem();
+  const GridPosPoly& gp_trivial = trivial_gridpos();
+  const GridPosPoly& pgp = state.pgp[ip];
+
+  // Calculate the number density for the given pressure and
+  // temperature:
+  // n = n0*T0/p0 * p/T or n = p/kB/t, ideal gas law
+  const Numeric n = number_density(p, T);
+
+  // xsec dimensions are:
+  //   Temperature
+  //   H2O
+  //   Frequency
+  //   Pressure
+  for (Index si = 0; si < species.nelem(); ++si) {
+    VectorView this_sga = sga(si, joker);
+    this_sga = 0;
+
+    // Species that are not in the table give zero absorption:
+    if (state.xsec_pos[si] < 0) continue;
+
+    for (Index pi = 0; pi < n_pi; ++pi) {
+      // Index into p_grid:
+      const Index this_p_grid_index = pgp.idx[pi];
+
+      const GridPosPoly& tgp_this =
+          state.tgp.nelem() ? state.tgp[ip * n_pi + pi] : gp_trivial;
+      const GridPosPoly& vgp_this =
+          state.non_linear[si] ? state.vgp[ip * n_pi + pi] : gp_trivial;
+
+      for (Index it = 0; it < tgp_this.idx.nelem(); ++it) {
+        for (Index iv = 0; iv < vgp_this.idx.nelem(); ++iv) {
+          // Pressure, temperature and H2O interpolation weight:
+          const Numeric w = pgp.w[pi] * tgp_this.w[it] * vgp_this.w[iv];
+
+          // The frequency column of xsec for this T, H2O and pressure:
+          ConstVectorView this_xsec = xsec_table(tgp_this.idx[it],
+                                                 state.xsec_pos[si] +
+                                                     vgp_this.idx[iv],
+                                                 Range(joker),
+                                                 this_p_grid_index);
+
+          for (Index fi = 0; fi < n_new_f_grid; ++fi) {
+            const GridPosPoly& fgp_this = fgp[fi];
+            for (Index k = 0; k < fgp_this.idx.nelem(); ++k)
+              this_sga[fi] += this_xsec[fgp_this.idx[k]] * (w * fgp_this.w[k]);
+          }
         }
-        res = 0.;
-        fpi++;
-        continue;
       }
+    }
 
-      // Set h2o related interpolation parameters:
-      Index this_h2o_extent;  // Range of H2O interpolation
-      if (do_VMR) {
-        vgp = &vgp_h2o;
-        this_h2o_extent = n_nls_pert;
-        itw = &itw_withH2O;
-      } else {
-        vgp = &gp_trivial;
-        this_h2o_extent = 1;
-        itw = &itw_noH2O;
-      }
+    // Watch out, this is not yet the final result, we
+    // need to multiply with the number density of the species, i.e.,
+    // with the total number density n, times the VMR of the
+    // species:
+    this_sga *= (n * abs_vmrs[si]);
+  }
+}
 
-      // Get the right view on xsec.
-      ConstTensor3View this_xsec =
-          xsec(Range(joker),                 // Temperature range
-               Range(fpi, this_h2o_extent),  // VMR profile range
-               Range(joker),                 // Frequency range
-               this_p_grid_index);           // Pressure index
-
-      // Do interpolation.
-      interp(res,        // result
-             *itw,       // weights
-             this_xsec,  // input
-             *tgp,
-             *vgp,
-             *fgp);  // grid positions
-
-      // Increase fpi. fpi marks the position of the first profile
-      // of the current species in xsec. This is needed to find
-      // the right subsection of xsec in the presence of nonlinear species.
-      if (do_VMR)
-        fpi += n_nls_pert;
-      else
-        fpi++;
+//! Extract scalar gas absorption coefficients from the lookup table.
+/*!
+  This carries out a simple interpolation in temperature,
+  pressure, and sometimes frequency. The interpolated value is then
+  scaled by the ratio between
+  actual VMR and reference VMR. In the case of nonlinear species the
+  interpolation goes also over H2O VMR.
+
+  All input parameters
+  must be in the range covered by the table. Violation will result in a
+  runtime error. Those checks are here, because they are a bit
+  difficult to make outside, due to the irregularity of the
+  grids. Otherwise there are no runtime checks in this function, only
+  assertions. This is, because the function is called many times
+  inside the RT calculation.
+
+  In this case pressure is not an altitude coordinate, so we are free
+  to choose the type of interpolation that gives lowest interpolation
+  errors or is easiest. I tested both linear and log p interpolation
+  with the result that log p interpolation is slightly better, so that
+  is used.
 
-    }  // End of species loop
+  This version handles a whole set of atmospheric points, for example
+  all points of a propagation path or of an atmospheric column. The
+  table checks and the frequency grid positions are set up once, the
+  pressure, temperature and H2O grid positions of all points are
+  determined before any interpolation is done, and the interpolation
+  itself runs with frequency as the innermost loop. The result for each
+  point is identical to the single point version below.
 
-    // fpi should have reached the end of that dimension of xsec. Check
-    // this with an assertion:
-    assert(fpi == xsec.npages());
-
-  }  // End of pressure index loop (below and above gp)
-
-  // Now we have to interpolate between the p_interp_order+1 pressure levels
-
-  // It is a "red" 1D interpolation case we are talking about here.
-  // (But for a matrix in frequency and species.) Doing a loop over
-  // frequency and species with an interp call inside would be
-  // unefficient, so we do this by hand here.
-  sga.resize(n_species, n_new_f_grid);
-  sga = 0;
-  for (Index pi = 0; pi < p_interp_order + 1; ++pi) {
-    // Multiply pre interpolated quantities with pressure interpolation weights.
-    // Dimensions of pre_interpolated are:
-    //   Pressure    (interpolation points)
-    //   Species
-    //   Temperature (always 1)
-    //   H2O         (always 1)
-    //   Frequency
-    xsec_pre_interpolated(
-        pi, Range(joker), Range(joker), Range(joker), Range(joker)) *= pitw[pi];
-
-    // Add up in sga.
-    // Dimensions of sga are (species, frequency)
-    sga += xsec_pre_interpolated(pi, Range(joker), 0, 0, Range(joker));
+  \param[out] sga A Tensor3 with scalar gas absorption coefficients
+              [1/m]. Dimension is adjusted automatically to
+              [p.nelem(), n_species, new_f_grid].
+
+  \param[in] p_interp_order Interpolation order for pressure.
+
+  \param[in] t_interp_order Interpolation order for temperature.
+
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+
+  \param[in] f_interp_order Interpolation order for frequency. This should
+             normally be zero, except for calculations with Doppler shift.
+
+  \param[in] p The pressures [Pa]. Dimension: [points].
+
+  \param[in] T The temperatures [K]. Dimension: [points].
+
+  \param[in] abs_vmrs The VMRs [absolute number]. Dimension: [species,
+             points], as for the WSV abs_vmrs.
+
+  \param[in] new_f_grid The frequency grid where absorption should be
+             extracted. With frequency interpolation order 0, every
+             frequency has to be one of the frequencies of the lookup
+             table's internal grid, so this can be the complete grid or
+             any subset of it, for example a chunk of f_grid or a single
+             frequency. With higher frequency interpolation order it can
+             be an arbitrary grid.
+
+  \param[in] extpolfac How much extrapolation to allow. Useful for Doppler
+             calculations. (But there even better to make the lookup table
+             grid wider and denser than the calculation grid.)
+
+  \date 2002-09-20, 2003-02-22, 2007-05-22, 2013-04-29, 2026-10-15
+
+  \author Stefan Buehler
+*/
+void GasAbsLookup::Extract(Tensor3& sga,
+                           const Index& p_interp_order,
+                           const Index& t_interp_order,
+                           const Index& h2o_interp_order,
+                           const Index& f_interp_order,
+                           ConstVectorView p,
+                           ConstVectorView T,
+                           ConstMatrixView abs_vmrs,
+                           ConstVectorView new_f_grid,
+                           const Numeric& extpolfac) const {
+  // Number of atmospheric points to extract for:
+  const Index n_points = p.nelem();
+
+  ExtractState& state = ExtractScratch();
+  ExtractSetup(state,
+               p_interp_order,
+               t_interp_order,
+               h2o_interp_order,
+               f_interp_order,
+               abs_vmrs.nrows(),
+               new_f_grid);
+
+  // Check that all point descriptions have the same length:
+  if (T.nelem() != n_points || abs_vmrs.ncols() != n_points) {
+    ostringstream os;
+    os << "Inconsistent number of points for extraction from the lookup table.\n"
+       << "There are " << n_points << " pressures, " << T.nelem()
+       << " temperatures, and " << abs_vmrs.ncols() << " VMR columns.";
+    throw runtime_error(os.str());
   }
 
-  // Watch out, this is not yet the final result, we
-  // need to multiply with the number density of the species, i.e.,
-  // with the total number density n, times the VMR of the
-  // species:
-  for (Index si = 0; si < n_species; ++si)
-    sga(si, Range(joker)) *= (n * abs_vmrs[si]);
+  // Determine pressure, temperature, and H2O grid positions and
+  // interpolation weights for all points. This is done before any
+  // interpolation, so that all range checks have passed before we start
+  // to work on xsec.
+  const Index n_pi = state.n_pi;
+  state.pgp.resize(n_points);
+  state.tgp.resize(t_pert.nelem() ? n_points * n_pi : 0);
+  state.vgp.resize(state.h2o_index >= 0 ? n_points * n_pi : 0);
+  for (Index ip = 0; ip < n_points; ++ip)
+    ExtractGridPos(state,
+                   ip,
+                   p_interp_order,
+                   t_interp_order,
+                   h2o_interp_order,
+                   p[ip],
+                   T[ip],
+                   state.h2o_index >= 0 ? abs_vmrs(state.h2o_index, ip) : 0,
+                   extpolfac);
+
+  // Interpolate. The threads share the state of the calling thread, which
+  // is only read from here on.
+  sga.resize(n_points, species.nelem(), new_f_grid.nelem());
+
+#pragma omp parallel for if (!arts_omp_in_parallel() &&   \
+                             n_points >= arts_omp_get_max_threads())
+  for (Index ip = 0; ip < n_points; ++ip)
+    ExtractPoint(sga(ip, joker, joker),
+                 state,
+                 ip,
+                 p[ip],
+                 T[ip],
+                 abs_vmrs(joker, ip));
 
   // That's it, we're done!
 }
 
+//! Extract scalar gas absorption coefficients from the lookup table.
+/*!
+  Single point version of the function above. It gives the same result
+  as the function above for a single point. The grid positions are kept
+  in a state of the calling thread, so if sga already has the right size,
+  nothing is allocated.
+
+  \param[out] sga A Matrix with scalar gas absorption coefficients
+              [1/m]. Dimension is adjusted automatically to [n_species,f_grid].
+
+  \param[in] p_interp_order Interpolation order for pressure.
+
+  \param[in] t_interp_order Interpolation order for temperature.
+
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+
+  \param[in] f_interp_order Interpolation order for frequency.
+
+  \param[in] p The pressure [Pa].
+
+  \param[in] T The temperature [K].
+
+  \param[in] abs_vmrs The VMRs [absolute number]. Dimension: [species].
+
+  \param[in] new_f_grid The frequency grid where absorption should be
+             extracted.
+
+  \param[in] extpolfac How much extrapolation to allow.
+
+  \date 2002-09-20, 2003-02-22, 2007-05-22, 2013-04-29, 2026-10-16
+
+  \author Stefan Buehler
+*/
+void GasAbsLookup::Extract(Matrix& sga,
+                           const Index& p_interp_order,
+                           const Index& t_interp_order,
+                           const Index& h2o_interp_order,
+                           const Index& f_interp_order,
+                           const Numeric& p,
+                           const Numeric& T,
+                           ConstVectorView abs_vmrs,
+                           ConstVectorView new_f_grid,
+                           const Numeric& extpolfac) const {
+  ExtractState& state = ExtractScratch();
+  ExtractSetup(state,
+               p_interp_order,
+               t_interp_order,
+               h2o_interp_order,
+               f_interp_order,
+               abs_vmrs.nelem(),
+               new_f_grid);
+
+  const Index n_pi = state.n_pi;
+  state.pgp.resize(1);
+  state.tgp.resize(t_pert.nelem() ? n_pi : 0);
+  state.vgp.resize(state.h2o_index >= 0 ? n_pi : 0);
+  ExtractGridPos(state,
+                 0,
+                 p_interp_order,
+                 t_interp_order,
+                 h2o_interp_order,
+                 p,
+                 T,
+                 state.h2o_index >= 0 ? abs_vmrs[state.h2o_index] : 0,
+                 extpolfac);
+
+  sga.resize(species.nelem(), new_f_grid.nelem());
+  ExtractPoint(sga, state, 0, p, T, abs_vmrs);
+}
+
+//! The prefetched points that currently exist, see GasAbsLookupPrefetch.
+static std::vector<const GasAbsLookupPrefetch*> prefetches;
+
+//! Guards prefetches. Find takes it shared, so lookups from threads do not
+//! wait for each other.
+static std::shared_mutex prefetches_mutex;
+
+//! Extract absorption for a set of points and make it available to Find.
+/*!
+  The absorption of all points is extracted by one call of the batched
+  GasAbsLookup::Extract. Errors of the extraction are thrown from here, the
+  object is only registered when the extraction succeeded.
+
+  The arguments are as for the batched GasAbsLookup::Extract. The table
+  must outlive the object.
+
+  \date 2026-10-16
+*/
+GasAbsLookupPrefetch::GasAbsLookupPrefetch(const GasAbsLookup& gal,
+                                           const Index& p_interp_order,
+                                           const Index& t_interp_order,
+                                           const Index& h2o_interp_order,
+                                           const Index& f_interp_order,
+                                           ConstVectorView p,
+                                           ConstVectorView T,
+                                           ConstMatrixView abs_vmrs,
+                                           ConstVectorView new_f_grid,
+                                           const Numeric& extpolfac_)
+    : table(&gal),
+      interp_orders{
+          p_interp_order, t_interp_order, h2o_interp_order, f_interp_order},
+      extpolfac(extpolfac_),
+      f_grid(new_f_grid),
+      vmrs(abs_vmrs) {
+  gal.Extract(sga,
+              p_interp_order,
+              t_interp_order,
+              h2o_interp_order,
+              f_interp_order,
+              p,
+              T,
+              abs_vmrs,
+              new_f_grid,
+              extpolfac);
+
+  for (Index ip = 0; ip < p.nelem(); ++ip)
+    points.emplace(std::make_pair(p[ip], T[ip]), ip);
+
+  std::unique_lock<std::shared_mutex> lock(prefetches_mutex);
+  prefetches.push_back(this);
+}
+
+GasAbsLookupPrefetch::~GasAbsLookupPrefetch() {
+  std::unique_lock<std::shared_mutex> lock(prefetches_mutex);
+  prefetches.erase(std::find(prefetches.begin(), prefetches.end(), this));
+}
+
+//! Look for a point in the existing prefetches.
+/*!
+  The arguments are as for the single point GasAbsLookup::Extract. If one
+  of the existing GasAbsLookupPrefetch objects holds this point, its
+  absorption is copied to sga, which gives the same result as the single
+  point GasAbsLookup::Extract.
+
+  eturn True if the point was found. If not, sga is not touched.
+
+  \date 2026-10-16
+*/
+bool GasAbsLookupPrefetch::Find(Matrix& sga,
+                                const GasAbsLookup& gal,
+                                const Index& p_interp_order,
+                                const Index& t_interp_order,
+                                const Index& h2o_interp_order,
+                                const Index& f_interp_order,
+                                const Numeric& p,
+                                const Numeric& T,
+                                ConstVectorView abs_vmrs,
+                                ConstVectorView new_f_grid,
+                                const Numeric& extpolfac) {
+  std::shared_lock<std::shared_mutex> lock(prefetches_mutex);
+  for (const GasAbsLookupPrefetch* pf : prefetches) {
+    if (pf->table != &gal || pf->interp_orders[0] != p_interp_order ||
+        pf->interp_orders[1] != t_interp_order ||
+        pf->interp_orders[2] != h2o_interp_order ||
+        pf->interp_orders[3] != f_interp_order ||
+        pf->extpolfac != extpolfac || pf->vmrs.nrows() != abs_vmrs.nelem() ||
+        !same_grid(pf->f_grid, new_f_grid))
+      continue;
+
+    const auto range = pf->points.equal_range(std::make_pair(p, T));
+    for (auto it = range.first; it != range.second; ++it) {
+      const Index ip = it->second;
+      bool same_vmrs = true;
+      for (Index si = 0; same_vmrs && si < abs_vmrs.nelem(); ++si)
+        same_vmrs = pf->vmrs(si, ip) == abs_vmrs[si];
+      if (!same_vmrs) continue;
+
+      sga.resize(pf->sga.nrows(), pf->sga.ncols());
+      sga = pf->sga(ip, joker, joker);
+      return true;
+    }
+  }
+  return false;
+}
+
 const Vector& GasAbsLookup::GetFgrid() const { return f_grid; }
 
 const Vector& GasAbsLookup::GetPgrid() const { return p_grid; }
 
+//! Returns the absorption cross-sections of the table.
+/*!
+  This is the memory map of a table read with ReadMapped, or else the
+  owned xsec.
+
+  \return A view of the mapped cross-sections or of xsec.
+*/
+ConstTensor4View GasAbsLookup::GetXsec() const {
+  if (xsec_map) return *xsec_map;
+  return xsec;
+}
+
+//! Returns the absorption cross-sections of the table as a Tensor4.
+/*!
+  For the output functions, which take a Tensor4. The owned xsec is
+  returned directly, the mapped cross-sections are copied to copy.
+
+  \param[out] copy Storage of the copy of mapped cross-sections.
+
+  \return xsec or copy.
+*/
+const Tensor4& GasAbsLookup::XsecForOutput(Tensor4& copy) const {
+  if (not xsec_map) return xsec;
+  copy = GetXsec();
+  return copy;
+}
+
+//! Header of the native lookup table format.
+/*!
+  The header is followed by meta_length bytes of ASCII XML with the
+  species of the table, then by the grids and reference profiles as raw
+  Numerics with their sizes in front, and at xsec_offset (a multiple of
+  the page size) by the raw xsec data. All binary data is in native byte
+  order. The grids are not stored as ASCII, as abs_lookupAdapt needs the
+  frequencies to match exactly.
+*/
+struct MappedTableHeader {
+  char magic[8];
+  std::uint64_t version;
+  std::uint64_t byte_order;
+  std::uint64_t meta_length;
+  std::uint64_t xsec_offset;
+  std::int64_t xsec_shape[4];
+};
+
+static const char mapped_table_magic[8] = {
+    'A', 'R', 'T', 'S', 'L', 'U', 'T', '\0'};
+static const std::uint64_t mapped_table_version = 1;
+static const std::uint64_t mapped_table_byte_order = 0x0102030405060708ULL;
+static const std::uint64_t mapped_table_alignment = 4096;
+
+//! Writes a Vector or Matrix as its sizes followed by the raw data.
+static void write_mapped_grid(std::ostream& os, ConstMatrixView m) {
+  const std::int64_t shape[2] = {m.nrows(), m.ncols()};
+  os.write(reinterpret_cast<const char*>(shape), sizeof(shape));
+  for (Index r = 0; r < m.nrows(); r++)
+    for (Index c = 0; c < m.ncols(); c++) {
+      const Numeric x = m(r, c);
+      os.write(reinterpret_cast<const char*>(&x), sizeof(Numeric));
+    }
+}
+
+//! Reads a Matrix written by write_mapped_grid.
+static void read_mapped_grid(std::istream& is, Matrix& m) {
+  std::int64_t shape[2];
+  is.read(reinterpret_cast<char*>(shape), sizeof(shape));
+  if (!is or shape[0] < 0 or shape[1] < 0)
+    throw runtime_error("Corrupt grid in native lookup table file.");
+  m.resize(shape[0], shape[1]);
+  if (m.nrows() and m.ncols())
+    is.read(reinterpret_cast<char*>(m.get_c_array()),
+            m.nrows() * m.ncols() * sizeof(Numeric));
+}
+
+//! Reads a Vector written by write_mapped_grid.
+static void read_mapped_grid(std::istream& is, Vector& v) {
+  Matrix m;
+  read_mapped_grid(is, m);
+  if (m.ncols() != 1 and m.nrows() * m.ncols() != 0)
+    throw runtime_error("Corrupt grid in native lookup table file.");
+  v = m(joker, 0);
+}
+
+//! Maps length bytes of filename read-only into memory.
+static std::pair<void*, std::size_t> map_file(const String& filename,
+                                              const std::size_t length) {
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    ostringstream os;
+    os << "Cannot open lookup table file " << filename << ": "
+       << strerror(errno);
+    throw runtime_error(os.str());
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 or std::size_t(st.st_size) < length) {
+    close(fd);
+    ostringstream os;
+    os << "The lookup table file " << filename << " is truncated.\n"
+       << "Expected at least " << length << " bytes.";
+    throw runtime_error(os.str());
+  }
+
+  void* addr = length ? mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0)
+                      : nullptr;
+  const int map_errno = errno;
+  close(fd);
+
+  if (addr == MAP_FAILED) {
+    ostringstream os;
+    os << "Cannot memory map lookup table file " << filename << ": "
+       << strerror(map_errno);
+    throw runtime_error(os.str());
+  }
+
+  return {addr, length};
+}
+
+MappedXsec::MappedXsec(const String& filename,
+                       std::size_t offset,
+                       Index b,
+                       Index p,
+                       Index r,
+                       Index c)
+    : MappedXsec(map_file(filename, offset + b * p * r * c * sizeof(Numeric)),
+                 offset,
+                 b,
+                 p,
+                 r,
+                 c) {}
+
+MappedXsec::MappedXsec(std::pair<void*, std::size_t> map,
+                       std::size_t offset,
+                       Index b,
+                       Index p,
+                       Index r,
+                       Index c)
+    : ConstTensor4View(
+          map.first ? reinterpret_cast<Numeric*>(
+                          static_cast<char*>(map.first) + offset)
+                    : nullptr,
+          Range(0, b, p * r * c),
+          Range(0, p, r * c),
+          Range(0, r, c),
+          Range(0, c)),
+      map_addr(map.first),
+      map_length(map.second) {}
+
+MappedXsec::~MappedXsec() {
+  if (map_addr) munmap(map_addr, map_length);
+}
+
+//! Read a table in the native format, memory mapping the cross-sections.
+/*!
+  Only the grids and species are read into memory. The cross-sections
+  stay in the file and are paged in on demand by Extract and Adapt. As
+  the file is mapped shared and read-only, processes on the same node
+  reading the same table use a single copy of it.
+
+  The format stores the data in native byte order, so it is only readable
+  on machines with the same byte order as the one that wrote it.
+
+  \param[in] filename  Name of a file written by WriteMapped.
+  \param[in] verbosity Verbosity settings.
+
+  \date 2026-10-15
+*/
+void GasAbsLookup::ReadMapped(const String& filename,
+                              const Verbosity& verbosity) {
+  std::ifstream is(filename.c_str(), std::ios::binary);
+  if (!is) {
+    ostringstream os;
+    os << "Cannot open lookup table file " << filename;
+    throw runtime_error(os.str());
+  }
+
+  MappedTableHeader header;
+  is.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!is or memcmp(header.magic, mapped_table_magic, 8) != 0) {
+    ostringstream os;
+    os << filename << " is not a native lookup table file.";
+    throw runtime_error(os.str());
+  }
+  if (header.version != mapped_table_version) {
+    ostringstream os;
+    os << "Unsupported native lookup table version " << header.version
+       << " in " << filename << ".";
+    throw runtime_error(os.str());
+  }
+  if (header.byte_order != mapped_table_byte_order) {
+    ostringstream os;
+    os << "The lookup table " << filename << " was written on a machine\n"
+       << "with a different byte order and cannot be mapped on this one.";
+    throw runtime_error(os.str());
+  }
+
+  String meta(header.meta_length, ' ');
+  is.read(&meta[0], header.meta_length);
+  if (!is) {
+    ostringstream os;
+    os << "The lookup table file " << filename << " is truncated.";
+    throw runtime_error(os.str());
+  }
+
+  GasAbsLookup gal;
+  istringstream is_meta(meta);
+  xml_read_from_stream(is_meta, gal.species, nullptr, verbosity);
+  xml_read_from_stream(is_meta, gal.nonlinear_species, nullptr, verbosity);
+
+  read_mapped_grid(is, gal.f_grid);
+  read_mapped_grid(is, gal.p_grid);
+  read_mapped_grid(is, gal.vmrs_ref);
+  read_mapped_grid(is, gal.t_ref);
+  read_mapped_grid(is, gal.t_pert);
+  read_mapped_grid(is, gal.nls_pert);
+  if (!is) {
+    ostringstream os;
+    os << "The lookup table file " << filename << " is truncated.";
+    throw runtime_error(os.str());
+  }
+
+  // Check the shape against the grids and the size of the file before
+  // mapping, a corrupt header would otherwise map past the end of the file
+  struct stat st;
+  if (stat(filename.c_str(), &st) != 0) {
+    ostringstream os;
+    os << "Cannot open lookup table file " << filename << ": "
+       << strerror(errno);
+    throw runtime_error(os.str());
+  }
+  const std::uint64_t file_size = st.st_size;
+  std::uint64_t xsec_length = sizeof(Numeric);
+  bool valid_shape = header.xsec_offset % mapped_table_alignment == 0 and
+                     header.xsec_offset <= file_size;
+  for (const std::int64_t n : header.xsec_shape) {
+    if (n < 0 or (n and xsec_length > file_size / std::uint64_t(n)))
+      valid_shape = false;
+    else
+      xsec_length *= n;
+  }
+  valid_shape = valid_shape and
+                xsec_length == file_size - header.xsec_offset and
+                (xsec_length == 0 or
+                 (header.xsec_shape[2] == gal.f_grid.nelem() and
+                  header.xsec_shape[3] == gal.p_grid.nelem()));
+  if (!valid_shape) {
+    ostringstream os;
+    os << "The cross-section shape in lookup table file " << filename
+       << "\ndoes not match the grids or the size of the file.";
+    throw runtime_error(os.str());
+  }
+
+  gal.xsec_map = std::make_shared<const MappedXsec>(filename,
+                                                    header.xsec_offset,
+                                                    header.xsec_shape[0],
+                                                    header.xsec_shape[1],
+                                                    header.xsec_shape[2],
+                                                    header.xsec_shape[3]);
+
+  *this = std::move(gal);
+}
+
+//! Write the table in the native format read by ReadMapped.
+/*!
+  \param[in] filename  Name of the file to write.
+  \param[in] verbosity Verbosity settings.
+
+  \date 2026-10-15
+*/
+void GasAbsLookup::WriteMapped(const String& filename,
+                               const Verbosity& verbosity) const {
+  ostringstream os_meta;
+  xml_write_to_stream(os_meta, species, nullptr, "", verbosity);
+  xml_write_to_stream(
+      os_meta, nonlinear_species, nullptr, "NonlinearSpecies", verbosity);
+  const String meta = os_meta.str();
+
+  ostringstream os_grids;
+  write_mapped_grid(os_grids, f_grid);
+  write_mapped_grid(os_grids, p_grid);
+  write_mapped_grid(os_grids, vmrs_ref);
+  write_mapped_grid(os_grids, t_ref);
+  write_mapped_grid(os_grids, t_pert);
+  write_mapped_grid(os_grids, nls_pert);
+  const String grids = os_grids.str();
+
+  const ConstTensor4View xsec_table = GetXsec();
+
+  MappedTableHeader header;
+  memcpy(header.magic, mapped_table_magic, 8);
+  header.version = mapped_table_version;
+  header.byte_order = mapped_table_byte_order;
+  header.meta_length = meta.length();
+  header.xsec_offset =
+      (sizeof(header) + meta.length() + grids.length() +
+       mapped_table_alignment - 1) /
+      mapped_table_alignment * mapped_table_alignment;
+  header.xsec_shape[0] = xsec_table.nbooks();
+  header.xsec_shape[1] = xsec_table.npages();
+  header.xsec_shape[2] = xsec_table.nrows();
+  header.xsec_shape[3] = xsec_table.ncols();
+
+  // Write to a name unique to this process and rename when complete. The
+  // table may be mapped from the file being replaced, by this or another
+  // process, and truncating the file would pull the data from under the
+  // mapping
+  std::ostringstream tmpname;
+  tmpname << filename << ".tmp" << getpid();
+
+  {
+    std::ofstream os(tmpname.str(), std::ios::binary | std::ios::trunc);
+    if (!os) {
+      ostringstream os_err;
+      os_err << "Cannot open lookup table file " << tmpname.str()
+             << " for writing.";
+      throw runtime_error(os_err.str());
+    }
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(meta.data(), meta.length());
+    os.write(grids.data(), grids.length());
+    const String padding(
+        header.xsec_offset - sizeof(header) - meta.length() - grids.length(),
+        '\0');
+    os.write(padding.data(), padding.length());
+
+    // Write contiguous rows of the last dimension
+    Vector row(xsec_table.ncols());
+    for (Index b = 0; b < xsec_table.nbooks(); b++)
+      for (Index p = 0; p < xsec_table.npages(); p++)
+        for (Index r = 0; r < xsec_table.nrows(); r++) {
+          row = xsec_table(b, p, r, Range(joker));
+          os.write(reinterpret_cast<const char*>(row.get_c_array()),
+                   row.nelem() * sizeof(Numeric));
+        }
+
+    os.close();
+    if (!os) {
+      std::remove(tmpname.str().c_str());
+      ostringstream os_err;
+      os_err << "Error writing lookup table file " << tmpname.str() << ".";
+      throw runtime_error(os_err.str());
+    }
+  }
+
+  if (std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    std::remove(tmpname.str().c_str());
+    ostringstream os_err;
+    os_err << "Cannot move lookup table file into place: " << filename;
+    throw runtime_error(os_err.str());
+  }
+}
+
 /** Output operatior for GasAbsLookup. */
 ostream& operator<<(ostream& os, const GasAbsLookup& /* gal */) {
   os << "GasAbsLookup: Output operator not implemented";
@@ -26,6 +26,8 @@
 #ifndef gas_abs_lookup_h
 #define gas_abs_lookup_h
 
+#include <map>
+#include <memory>
 #include "abs_species_tags.h"
 #include "absorption.h"
 #include "interpolation_poly.h"
@@ -38,6 +40,36 @@ class bofstream;
 class Agenda;
 class Workspace;
 
+//! Read-only memory map of the cross-sections of a native lookup table file.
+/*! The file is mapped with MAP_SHARED, so all processes on a node that map
+    the same table share one copy of it in the page cache. The mapping is
+    released when the object is destroyed. */
+class MappedXsec : public ConstTensor4View {
+ public:
+  MappedXsec(const String& filename,
+             std::size_t offset,
+             Index b,
+             Index p,
+             Index r,
+             Index c);
+
+  MappedXsec(const MappedXsec&) = delete;
+  MappedXsec& operator=(const MappedXsec&) = delete;
+
+  ~MappedXsec();
+
+ private:
+  MappedXsec(std::pair<void*, std::size_t> map,
+             std::size_t offset,
+             Index b,
+             Index p,
+             Index r,
+             Index c);
+
+  void* map_addr;
+  std::size_t map_length;
+};
+
 //! An absorption lookup table.
 /*! This class holds an absorption lookup table, as well as all
     information that is necessary to use the table to extract
@@ -61,6 +93,18 @@ class GasAbsLookup {
              ConstVectorView current_f_grid,
              const Verbosity& verbosity);
 
+  // Documentation is with the implementation!
+  void Extract(Tensor3& sga,
+               const Index& p_interp_order,
+               const Index& t_interp_order,
+               const Index& h2o_interp_order,
+               const Index& f_interp_order,
+               ConstVectorView p,
+               ConstVectorView T,
+               ConstMatrixView abs_vmrs,
+               ConstVectorView new_f_grid,
+               const Numeric& extpolfac) const;
+
   // Documentation is with the implementation!
   void Extract(Matrix& sga,
                const Index& p_interp_order,
@@ -77,6 +121,15 @@ class GasAbsLookup {
 
   const Vector& GetPgrid() const;
 
+  // Documentation is with the implementation!
+  ConstTensor4View GetXsec() const;
+
+  // Documentation is with the implementation!
+  void ReadMapped(const String& filename, const Verbosity& verbosity);
+
+  // Documentation is with the implementation!
+  void WriteMapped(const String& filename, const Verbosity& verbosity) const;
+
   Index GetSpeciesIndex(const Index& isp) const {
     return species[isp][0].Species();
   }
@@ -188,10 +241,50 @@ class GasAbsLookup {
   /** The vector of perturbations for the VMRs of the nonlinear species */
   Vector& NLSPert() {return nls_pert;}
   
-  /** Absorption cross sections */
-  Tensor4& Xsec() {return xsec;}
+  /** Absorption cross sections, for writing them.
+   *
+   * Drops the memory map of a table read by ReadMapped, since the table
+   * then holds its own cross-sections.
+   */
+  Tensor4& Xsec() {
+    xsec_map.reset();
+    return xsec;
+  }
+
+  // Documentation is with the implementation!
+  const Tensor4& XsecForOutput(Tensor4& copy) const;
   
  private:
+  // Helpers of Extract, documentation is with the implementation!
+  struct ExtractState;
+
+  static ExtractState& ExtractScratch();
+
+  void ExtractSetup(ExtractState& state,
+                    const Index& p_interp_order,
+                    const Index& t_interp_order,
+                    const Index& h2o_interp_order,
+                    const Index& f_interp_order,
+                    const Index& n_vmrs,
+                    ConstVectorView new_f_grid) const;
+
+  void ExtractGridPos(ExtractState& state,
+                      const Index& ip,
+                      const Index& p_interp_order,
+                      const Index& t_interp_order,
+                      const Index& h2o_interp_order,
+                      const Numeric& p,
+                      const Numeric& T,
+                      const Numeric& h2o_vmr,
+                      const Numeric& extpolfac) const;
+
+  void ExtractPoint(MatrixView sga,
+                    const ExtractState& state,
+                    const Index& ip,
+                    const Numeric& p,
+                    const Numeric& T,
+                    ConstVectorView abs_vmrs) const;
+
   //! The species tags for which the table is valid.
   ArrayOfArrayOfSpeciesTag species;
 
@@ -307,6 +400,63 @@ class GasAbsLookup {
     dimensions of abs_per_tg in ARTS-1-0. This should simplify
     computation of the lookup table with the old ARTS version.  */
   Tensor4 xsec;
+
+  //! The memory mapped xsec of a table read by ReadMapped.
+  /*! Takes the place of xsec while set. It is dropped by Xsec(), which
+      all code that assigns the cross-sections goes through. Copies of the
+      table share the map. */
+  std::shared_ptr<const MappedXsec> xsec_map;
+};
+
+//! Lookup table absorption extracted in advance for a set of points.
+/*! Made by callers that run the propagation matrix agenda for all points of
+    a column or a propagation path, see abs_lookup_prefetch. While the
+    object exists, propmat_clearskyAddFromLookup takes the absorption of
+    these points from it instead of extracting them one by one. Points are
+    matched on exactly the same table, interpolation orders, frequency grid,
+    pressure, temperature and VMRs, anything else is extracted as usual. */
+class GasAbsLookupPrefetch {
+ public:
+  // Documentation is with the implementation!
+  GasAbsLookupPrefetch(const GasAbsLookup& gal,
+                       const Index& p_interp_order,
+                       const Index& t_interp_order,
+                       const Index& h2o_interp_order,
+                       const Index& f_interp_order,
+                       ConstVectorView p,
+                       ConstVectorView T,
+                       ConstMatrixView abs_vmrs,
+                       ConstVectorView new_f_grid,
+                       const Numeric& extpolfac);
+
+  GasAbsLookupPrefetch(const GasAbsLookupPrefetch&) = delete;
+  GasAbsLookupPrefetch& operator=(const GasAbsLookupPrefetch&) = delete;
+
+  ~GasAbsLookupPrefetch();
+
+  // Documentation is with the implementation!
+  static bool Find(Matrix& sga,
+                   const GasAbsLookup& gal,
+                   const Index& p_interp_order,
+                   const Index& t_interp_order,
+                   const Index& h2o_interp_order,
+                   const Index& f_interp_order,
+                   const Numeric& p,
+                   const Numeric& T,
+                   ConstVectorView abs_vmrs,
+                   ConstVectorView new_f_grid,
+                   const Numeric& extpolfac);
+
+ private:
+  const GasAbsLookup* table;
+  Index interp_orders[4];
+  Numeric extpolfac;
+  Vector f_grid;
+  Matrix vmrs;
+  Tensor3 sga;
+
+  //! Point indices by pressure and temperature.
+  std::multimap<std::pair<Numeric, Numeric>, Index> points;
 };
 
 ostream& operator<<(ostream& os, const GasAbsLookup& gal);
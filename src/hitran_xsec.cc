@@ -30,6 +30,8 @@
 
 #include <complex.h>
 #include <fftw3.h>
+#include <cstring>
+#include <map>
 
 #endif /* ENABLE_FFTW */
 
@@ -77,77 +79,176 @@ void convolve(Vector& result,
 
 #ifdef ENABLE_FFTW
 
-void fftconvolve(VectorView& result,
-                 const Vector& xsec,
-                 const Vector& lorentz) {
-  int n_p = (int)(xsec.nelem() + lorentz.nelem() - 1);
-  int n_p_2 = n_p / 2 + 1;
+namespace {
 
-  double* xsec_in = fftw_alloc_real((size_t)n_p);
-  fftw_complex* xsec_out = fftw_alloc_complex((size_t)n_p_2);
-  memcpy(xsec_in, xsec.get_c_array(), sizeof(double) * xsec.nelem());
-  memset(&xsec_in[xsec.nelem()], 0, sizeof(double) * (n_p - xsec.nelem()));
+/** FFTW plans of the convolution for one transform length */
+struct FftwPlans {
+  fftw_plan r2c;
+  fftw_plan c2r;
+};
 
-  fftw_plan plan;
-#pragma omp critical(fftw_call)
-  plan = fftw_plan_dft_r2c_1d(n_p, xsec_in, xsec_out, FFTW_ESTIMATE);
+/** FFTW plans by transform length, shared by all threads
 
-  fftw_execute(plan);
+  Executing a plan is thread-safe, creating one is not. Plans are therefore
+  only created inside the fftw_call critical section, once per transform
+  length, and kept until the program exits.
+ */
+class FftwPlanCache {
+ public:
+  FftwPlanCache() = default;
+  FftwPlanCache(const FftwPlanCache&) = delete;
+  FftwPlanCache& operator=(const FftwPlanCache&) = delete;
+
+  ~FftwPlanCache() {
+    for (auto& p : mplans) {
+      fftw_destroy_plan(p.second.r2c);
+      fftw_destroy_plan(p.second.c2r);
+    }
+  }
 
+  /** Return the plans for length n_p, creating them if needed */
+  const FftwPlans& get(const int n_p) {
+    const FftwPlans* plans = nullptr;
 #pragma omp critical(fftw_call)
-  fftw_destroy_plan(plan);
+    {
+      auto it = mplans.find(n_p);
+      if (it == mplans.end()) it = mplans.emplace(n_p, create(n_p)).first;
+      plans = &it->second;
+    }
+    return *plans;
+  }
 
-  fftw_free(xsec_in);
+  /** Use FFTW wisdom from and to the given file */
+  void set_wisdom_file(const String& filename) {
+#pragma omp critical(fftw_call)
+    {
+      mwisdom_file = filename;
+      if (mwisdom_file.nelem())
+        fftw_import_wisdom_from_filename(mwisdom_file.c_str());
+    }
+  }
 
-  double* lorentz_in = fftw_alloc_real((size_t)n_p);
-  fftw_complex* lorentz_out = fftw_alloc_complex((size_t)n_p_2);
-  memcpy(lorentz_in, lorentz.get_c_array(), sizeof(double) * lorentz.nelem());
-  memset(&lorentz_in[lorentz.nelem()],
-         0,
-         sizeof(double) * (n_p - lorentz.nelem()));
+ private:
+  /** Create the plans, must be called inside the fftw_call section
+
+    The arrays used for planning are only needed for their alignment, all
+    plans are executed with the new-array execute functions.
+   */
+  FftwPlans create(const int n_p) {
+    const int n_p_2 = n_p / 2 + 1;
+    const unsigned flags =
+        mwisdom_file.nelem() ? FFTW_MEASURE : FFTW_ESTIMATE;
+
+    double* in = fftw_alloc_real((size_t)n_p);
+    fftw_complex* out = fftw_alloc_complex((size_t)n_p_2);
+    FftwPlans plans;
+    plans.r2c = fftw_plan_dft_r2c_1d(n_p, in, out, flags);
+    plans.c2r = fftw_plan_dft_c2r_1d(n_p, out, in, flags);
+    fftw_free(in);
+    fftw_free(out);
+
+    if (mwisdom_file.nelem())
+      fftw_export_wisdom_to_filename(mwisdom_file.c_str());
+
+    return plans;
+  }
 
-#pragma omp critical(fftw_call)
-  plan = fftw_plan_dft_r2c_1d(n_p, lorentz_in, lorentz_out, FFTW_ESTIMATE);
+  std::map<int, FftwPlans> mplans;
+  String mwisdom_file;
+};
+
+FftwPlanCache fftw_plan_cache;
+
+/** Aligned scratch buffers of one thread, grown as needed */
+class FftwBuffers {
+ public:
+  FftwBuffers() = default;
+  FftwBuffers(const FftwBuffers&) = delete;
+  FftwBuffers& operator=(const FftwBuffers&) = delete;
+
+  ~FftwBuffers() { release(); }
+
+  /** Make the buffers large enough for transforms of length n_p */
+  void reserve(const int n_p) {
+    if (n_p <= mn) return;
+    release();
+    mn = n_p;
+    real = fftw_alloc_real((size_t)n_p);
+    xsec_out = fftw_alloc_complex((size_t)(n_p / 2 + 1));
+    lorentz_out = fftw_alloc_complex((size_t)(n_p / 2 + 1));
+  }
 
-  fftw_execute(plan);
+  double* real{nullptr};
+  fftw_complex* xsec_out{nullptr};
+  fftw_complex* lorentz_out{nullptr};
+
+ private:
+  void release() {
+    fftw_free(real);
+    fftw_free(xsec_out);
+    fftw_free(lorentz_out);
+    real = nullptr;
+    xsec_out = lorentz_out = nullptr;
+    mn = 0;
+  }
 
-#pragma omp critical(fftw_call)
-  fftw_destroy_plan(plan);
+  int mn{0};
+};
 
-  fftw_free(lorentz_in);
+thread_local FftwBuffers fftw_buffers;
 
-  fftw_complex* fft_in = fftw_alloc_complex((size_t)n_p_2);
-  double* fft_out = fftw_alloc_real((size_t)n_p);
-  memcpy(fft_in, xsec_out, sizeof(fftw_complex) * n_p_2);
+}  // namespace
 
+void fftconvolve(VectorView& result,
+                 const Vector& xsec,
+                 const Vector& lorentz) {
+  int n_p = (int)(xsec.nelem() + lorentz.nelem() - 1);
+  int n_p_2 = n_p / 2 + 1;
+
+  const FftwPlans& plans = fftw_plan_cache.get(n_p);
+  FftwBuffers& buf = fftw_buffers;
+  buf.reserve(n_p);
+
+  memcpy(buf.real, xsec.get_c_array(), sizeof(double) * xsec.nelem());
+  memset(&buf.real[xsec.nelem()], 0, sizeof(double) * (n_p - xsec.nelem()));
+  fftw_execute_dft_r2c(plans.r2c, buf.real, buf.xsec_out);
+
+  memcpy(buf.real, lorentz.get_c_array(), sizeof(double) * lorentz.nelem());
+  memset(&buf.real[lorentz.nelem()],
+         0,
+         sizeof(double) * (n_p - lorentz.nelem()));
+  fftw_execute_dft_r2c(plans.r2c, buf.real, buf.lorentz_out);
+
+  fftw_complex* xsec_out = buf.xsec_out;
+  const fftw_complex* lorentz_out = buf.lorentz_out;
   for (Index i = 0; i < n_p_2; i++) {
-    fft_in[i][0] =
+    const double re =
         xsec_out[i][0] * lorentz_out[i][0] - xsec_out[i][1] * lorentz_out[i][1];
-    fft_in[i][1] =
+    const double im =
         xsec_out[i][0] * lorentz_out[i][1] + xsec_out[i][1] * lorentz_out[i][0];
+    xsec_out[i][0] = re;
+    xsec_out[i][1] = im;
   }
 
-#pragma omp critical(fftw_call)
-  plan = fftw_plan_dft_c2r_1d(n_p, fft_in, fft_out, FFTW_ESTIMATE);
-
-  fftw_execute(plan);
-
-#pragma omp critical(fftw_call)
-  fftw_destroy_plan(plan);
-
-  fftw_free(fft_in);
+  fftw_execute_dft_c2r(plans.c2r, buf.xsec_out, buf.real);
 
   for (Index i = 0; i < xsec.nelem(); i++) {
-    result[i] = fft_out[i + (int)lorentz.nelem() / 2] / n_p;
+    result[i] = buf.real[i + (int)lorentz.nelem() / 2] / n_p;
   }
-
-  fftw_free(xsec_out);
-  fftw_free(lorentz_out);
-  fftw_free(fft_out);
 }
 
 #endif /* ENABLE_FFTW */
 
+void hitran_xsec_set_fftw_wisdom_file(const String& filename) {
+#ifdef ENABLE_FFTW
+  fftw_plan_cache.set_wisdom_file(filename);
+#else
+  if (filename.nelem())
+    throw std::runtime_error(
+        "FFTW wisdom can not be used, ARTS was compiled without FFTW.");
+#endif /* ENABLE_FFTW */
+}
+
 void XsecRecord::Extract(VectorView result,
                          ConstVectorView f_grid,
                          const Numeric& pressure,
@@ -130,4 +130,44 @@ Index hitran_xsec_get_index(const ArrayOfXsecRecord& xsec_data,
 
 std::ostream& operator<<(std::ostream& os, const XsecRecord& xd);
 
+/** Convolve a cross section with a line shape.
+
+   Direct summation. The result is the part of the full convolution that is
+   centered on xsec.
+
+   \param[out] result   The convolved cross section, same size as xsec.
+   \param[in] xsec      Cross section.
+   \param[in] lorentz   Line shape.
+   */
+void convolve(Vector& result,
+              const ConstVectorView& xsec,
+              const ConstVectorView& lorentz);
+
+#ifdef ENABLE_FFTW
+/** Convolve a cross section with a line shape by FFT.
+
+   Gives the same result as convolve, up to rounding. Uses the cached FFTW
+   plans of the transform length.
+
+   \param[out] result   The convolved cross section, same size as xsec.
+   \param[in] xsec      Cross section.
+   \param[in] lorentz   Line shape.
+   */
+void fftconvolve(VectorView& result,
+                 const Vector& xsec,
+                 const Vector& lorentz);
+#endif /* ENABLE_FFTW */
+
+/** Use FFTW wisdom for the convolution of cross sections.
+
+   The FFTW plans of the convolution are cached per transform length. If a
+   wisdom file is set, wisdom is imported from it, new plans are measured
+   instead of estimated, and the wisdom is written back to the file after
+   each new plan. Plans that were already created are kept.
+
+   \param[in] filename  Name of the wisdom file, or empty to estimate new
+                        plans without wisdom.
+   */
+void hitran_xsec_set_fftw_wisdom_file(const String& filename);
+
 #endif  // HITRAN_XSEC_H
@@ -403,8 +403,9 @@ void gridpos(ArrayOfGridPos& gp,
 /*!
    Creates a grid position structure.
   
-   This is a gateway to the function for arrays of grid positions, to be
-   used for e.g. "red interpolation".
+   This is the function for arrays of grid positions, for a single point.
+   It is used for e.g. "red interpolation". The result is the same as for
+   a new grid with only this point, but no temporary arrays are needed.
 
    \retval  gp         The GridPos structure. 
    \param   old_grid   The original grid.
@@ -425,10 +426,60 @@ void gridpos(GridPos& gp,
              ConstVectorView old_grid,
              const Numeric& new_grid,
              const Numeric& extpolfac) {
-  ArrayOfGridPos agp(1);
-  Vector v(1, new_grid);
-  gridpos(agp, old_grid, v, extpolfac);
-  gridpos_copy(gp, agp[0]);
+  const Index n_old = old_grid.nelem();
+
+  // Assert, that the old grid has more than one element
+  assert(1 < n_old);
+
+  // The steps are those of the array version for its first point. A
+  // descending grid is handled by flipping the sign of all comparisons.
+  const bool ascending = (old_grid[0] <= old_grid[1]);
+  assert(ascending ? is_increasing(old_grid) : is_decreasing(old_grid));
+  const Numeric sign = ascending ? 1 : -1;
+
+  // Limits of extrapolation, at the first and the last grid point:
+  const Numeric og_first =
+      old_grid[0] - extpolfac * (old_grid[1] - old_grid[0]);
+  const Numeric og_last =
+      old_grid[n_old - 1] +
+      extpolfac * (old_grid[n_old - 1] - old_grid[n_old - 2]);
+  const Numeric og_min = ascending ? og_first : og_last;
+  const Numeric og_max = ascending ? og_last : og_first;
+  assert(og_min <= new_grid);
+  assert(new_grid <= og_max);
+
+  // First guess of the position, from linear interpolation between the
+  // ends of the grid:
+  Numeric frac = (new_grid - og_min) / (og_max - og_min);
+  if (!ascending) frac = 1 - frac;
+  Index current_position = (Index)rint(frac * (Numeric)(n_old - 2));
+  assert(0 <= current_position);
+  assert(current_position <= n_old - 2);
+
+  Numeric lower = old_grid[current_position];
+  Numeric upper = old_grid[current_position + 1];
+
+  if (sign * new_grid < sign * lower && current_position > 0) {
+    do {
+      --current_position;
+      lower = old_grid[current_position];
+    } while (sign * new_grid < sign * lower && current_position > 0);
+
+    upper = old_grid[current_position + 1];
+  } else if (sign * new_grid >= sign * upper &&
+             current_position < n_old - 2) {
+    do {
+      ++current_position;
+      upper = old_grid[current_position + 1];
+    } while (sign * new_grid >= sign * upper &&
+             current_position < n_old - 2);
+
+    lower = old_grid[current_position];
+  }
+
+  gp.idx = current_position;
+  gp.fd[0] = (new_grid - lower) / (upper - lower);
+  gp.fd[1] = 1.0 - gp.fd[0];
 }
 
 //! gridpos_1to1
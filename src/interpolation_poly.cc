@@ -98,6 +98,85 @@ Index IMIN(Index a, Index b) { return a < b ? a : b; }
 */
 DEBUG_ONLY(const Numeric sum_check_epsilon = 1e-6;)
 
+//! Set up the grid position of one point for higher order interpolation.
+/*!
+  Helper of the gridpos_poly functions, starting from the grid position for
+  linear interpolation.
+
+  The formula for calculating the weights w is taken from Numerical
+  Recipes, 2nd edition, section 3.1, eq. 3.1.1.
+
+  \param gp Output: The grid position.
+  \param old_grid Original grid.
+  \param new_grid The position of the point.
+  \param gp_trad The grid position of the point for linear interpolation.
+  \param m Number of points used in the interpolation (order + 1).
+*/
+static void gridpos_poly_from_trad(GridPosPoly& gp,
+                                   ConstVectorView old_grid,
+                                   const Numeric new_grid,
+                                   const GridPos& gp_trad,
+                                   const Index m) {
+  const Index n_old = old_grid.nelem();
+
+  // Here we calculate the index of the first of the range of
+  // points used for interpolation. For linear interpolation this
+  // is identical to j. The idea for this expression is from
+  // Numerical Receipes (Chapter 3, section "after the hunt"), but
+  // there it is for 1-based arrays.
+  Index k;
+  if (m != 1) {
+    k = IMIN(IMAX(gp_trad.idx - (m - 1) / 2, 0), n_old - m);
+  } else {
+    // The above formula for k is not valid for m==1
+    // (nearest neighbour interpolation).
+    if (gp_trad.fd[0] <= 0.5)
+      k = gp_trad.idx;
+    else
+      k = gp_trad.idx + 1;
+
+    // It is a matter of definition what we do with the exact fd==0.5 case.
+    // Here I arbitrarily decided to stick with the "left" point (smaller
+    // index). I believe this is consistent with the behaviour for m=3,
+    // where 2 points on the left and 1 point on the right is used. (So,
+    // we always prefer the left side.)
+  }
+
+  //      cout << "m: "<< m << ", k: " << k << endl;
+
+  // Make gp.idx and gp.w the right size:
+  gp.idx.resize(m);
+  gp.w.resize(m);
+
+  // Calculate w for each interpolation point. In the linear case
+  // these are just the fractional distances to each interpolation
+  // point. The w here correspond exactly to the terms in front of
+  // the yi in Numerical Recipes, 2nd edition, section 3.1,
+  // eq. 3.1.1.
+  for (Index i = 0; i < m; ++i) {
+    gp.idx[i] = k + i;
+
+    //  Numerical Recipes, 2nd edition, section 3.1, eq. 3.1.1.
+
+    // Numerator:
+    Numeric num = 1;
+    for (Index j = 0; j < m; ++j)
+      if (j != i) num *= new_grid - old_grid[k + j];
+
+    // Denominator:
+    Numeric denom = 1;
+    for (Index j = 0; j < m; ++j)
+      if (j != i) denom *= old_grid[k + i] - old_grid[k + j];
+
+    gp.w[i] = num / denom;
+  }
+
+  // Debugging: Test if sum of all w is 1, as it should be:
+  //       Numeric testsum = 0;
+  //       for (Index i=0; i<m; ++i) testsum += gp.w[i];
+  //       cout << "Testsum = " << testsum << endl;
+}
+
 //! Set up grid positions for higher order interpolation.
 /*!
   This function performs the same task as gridpos, but for arbitrary
@@ -155,72 +234,18 @@ void gridpos_poly(ArrayOfGridPosPoly& gp,
     assert(false);
   }
 
-  for (Index s = 0; s < n_new; ++s) {
-    // Here we calculate the index of the first of the range of
-    // points used for interpolation. For linear interpolation this
-    // is identical to j. The idea for this expression is from
-    // Numerical Receipes (Chapter 3, section "after the hunt"), but
-    // there it is for 1-based arrays.
-    Index k;
-    if (m != 1) {
-      k = IMIN(IMAX(gp_trad[s].idx - (m - 1) / 2, 0), n_old - m);
-    } else {
-      // The above formula for k is not valid for m==1
-      // (nearest neighbour interpolation).
-      if (gp_trad[s].fd[0] <= 0.5)
-        k = gp_trad[s].idx;
-      else
-        k = gp_trad[s].idx + 1;
-
-      // It is a matter of definition what we do with the exact fd==0.5 case.
-      // Here I arbitrarily decided to stick with the "left" point (smaller
-      // index). I believe this is consistent with the behaviour for m=3,
-      // where 2 points on the left and 1 point on the right is used. (So,
-      // we always prefer the left side.)
-    }
-
-    //      cout << "m: "<< m << ", k: " << k << endl;
-
-    // Make gp[s].idx and gp[s].w the right size:
-    gp[s].idx.resize(m);
-    gp[s].w.resize(m);
-
-    // Calculate w for each interpolation point. In the linear case
-    // these are just the fractional distances to each interpolation
-    // point. The w here correspond exactly to the terms in front of
-    // the yi in Numerical Recipes, 2nd edition, section 3.1,
-    // eq. 3.1.1.
-    for (Index i = 0; i < m; ++i) {
-      gp[s].idx[i] = k + i;
-
-      //  Numerical Recipes, 2nd edition, section 3.1, eq. 3.1.1.
-
-      // Numerator:
-      Numeric num = 1;
-      for (Index j = 0; j < m; ++j)
-        if (j != i) num *= new_grid[s] - old_grid[k + j];
-
-      // Denominator:
-      Numeric denom = 1;
-      for (Index j = 0; j < m; ++j)
-        if (j != i) denom *= old_grid[k + i] - old_grid[k + j];
-
-      gp[s].w[i] = num / denom;
-    }
-
-    // Debugging: Test if sum of all w is 1, as it should be:
-    //       Numeric testsum = 0;
-    //       for (Index i=0; i<m; ++i) testsum += gp[s].w[i];
-    //       cout << "Testsum = " << testsum << endl;
-  }
+  for (Index s = 0; s < n_new; ++s)
+    gridpos_poly_from_trad(gp[s], old_grid, new_grid[s], gp_trad[s], m);
 }
 
 //! gridpos_poly
 /*!
    Creates a grid position structure for higher order interpolation.
   
-   This is a gateway to the function for arrays of GridPosPoly, to be
-   used for e.g. "red interpolation".
+   This is the function for arrays of GridPosPoly, for a single point.
+   It is used for e.g. "red interpolation". No temporary arrays are
+   needed, so nothing is allocated if gp already has the size for the
+   order.
 
    \retval  gp         The GridPos structure. 
    \param   old_grid   The original grid.
@@ -243,9 +268,23 @@ void gridpos_poly(GridPosPoly& gp,
                   const Numeric& new_grid,
                   const Index order,
                   const Numeric& extpolfac) {
-  ArrayOfGridPosPoly agp(1);
-  gridpos_poly(agp, old_grid, new_grid, order, extpolfac);
-  gp = agp[0];
+  // Number of points used in the interpolation (order + 1):
+  const Index m = order + 1;
+
+  const Index n_old = old_grid.nelem();
+  assert(n_old >= m);
+
+  GridPos gp_trad;
+  if (n_old > 1) {
+    gridpos(gp_trad, old_grid, new_grid, extpolfac);
+  } else {
+    // As in the array version, a single point is nearest neighbour to all.
+    gp_trad.idx = 0;
+    gp_trad.fd[0] = 0;
+    gp_trad.fd[1] = 1;
+  }
+
+  gridpos_poly_from_trad(gp, old_grid, new_grid, gp_trad, m);
 }
 
 //! Set up grid positions for higher order interpolation on longitudes.
@@ -132,6 +132,36 @@ extern "C" void zgetri_(int *n,
                         int *lwork,
                         int *info);
 
+//! Cholesky decomposition.
+/*!
+  Computes the Cholesky factorization of a symmetric positive definite
+  matrix. See LAPACK reference.
+
+  \param[in] uplo 'U' if the upper triangle of A is stored, 'L' if the lower
+  triangle is stored.
+  \param[in] n The number of rows and columns of the matrix A.
+  \param[in,out] A The matrix A, on output the factor U or L.
+  \param[in] lda The leading dimension of A.
+  \param[out] info Integer indicating if operation was successful: 0 if
+  success, > 0 if A is not positive definite.
+*/
+extern "C" void dpotrf_(char *uplo, int *n, double *A, int *lda, int *info);
+
+//! Matrix inversion from Cholesky decomposition.
+/*!
+  Inverts a symmetric positive definite matrix using its Cholesky
+  factorization computed by dpotrf_. Only the triangle given by uplo
+  is set. See LAPACK reference.
+
+  \param[in] uplo 'U' or 'L' as passed to dpotrf_.
+  \param[in] n The number of rows and columns of the matrix A.
+  \param[in,out] A The factor from dpotrf_, on output the inverse.
+  \param[in] lda The leading dimension of A.
+  \param[out] info Integer indicating if operation was successful: 0 if
+  success, otherwise failure.
+*/
+extern "C" void dpotri_(char *uplo, int *n, double *A, int *lda, int *info);
+
 //! Optimal parameters for computation.
 /*!
   This function returns problem-dependent parameters for the computing
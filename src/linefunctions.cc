@@ -34,9 +34,12 @@
 
 #include "linefunctions.h"
 #include <Eigen/Core>
+#include <algorithm>
+#include <atomic>
 #include <Faddeeva/Faddeeva.hh>
 #include "constants.h"
 #include "linescaling.h"
+#include "voigt_kernel.h"
 
 /** The Faddeeva function */
 inline Complex w(Complex z) noexcept { return Faddeeva::w(z); }
@@ -334,7 +337,12 @@ void Linefunctions::set_voigt(
   z.noalias() = invGD * (Complex(-F0, lso.G0) + f_grid.array()).matrix();
 
   // Line shape
-  F.noalias() = fac * z.unaryExpr(&w);
+  if (voigt_kernel() == VoigtKernel::Weideman) {
+    faddeeva_weideman(F.data(), z.data(), F.size());
+    F *= fac;
+  } else {
+    F.noalias() = fac * z.unaryExpr(&w);
+  }
 
   if (nppd) {
     dw.noalias() = 2 * (Complex(0, fac * Constant::inv_sqrt_pi) -
@@ -1288,6 +1296,92 @@ void Linefunctions::set_htp(Eigen::Ref<Eigen::VectorXcd> F,
   }
 }
 
+namespace {
+std::atomic<Numeric> pruning_tolerance{0};
+}  // namespace
+
+void Linefunctions::set_line_pruning_tolerance(Numeric tolerance) noexcept {
+  pruning_tolerance = tolerance;
+}
+
+Numeric Linefunctions::line_pruning_tolerance() noexcept {
+  return pruning_tolerance;
+}
+
+std::vector<Numeric> Linefunctions::sorted_frequency_grid(
+    const ConstVectorView f_grid) {
+  if (line_pruning_tolerance() <= 0) return {};
+
+  std::vector<Numeric> f_sorted(f_grid.nelem());
+  for (Index iv = 0; iv < f_grid.nelem(); iv++) f_sorted[iv] = f_grid[iv];
+  std::sort(f_sorted.begin(), f_sorted.end());
+  return f_sorted;
+}
+
+std::vector<bool> Linefunctions::find_negligible_lines(
+    const std::vector<Numeric>& f_grid_sorted,
+    const AbsorptionLines& band,
+    const std::vector<LineShape::Output>& X,
+    const std::vector<Numeric>& S,
+    const ArrayOfRetrievalQuantity& derivatives_data,
+    const ArrayOfIndex& derivatives_data_active,
+    const Numeric& DC,
+    const Numeric& tolerance) {
+  const Index nl = band.NumLines();
+  if (tolerance <= 0 or nl < 2 or f_grid_sorted.empty() or
+      band.Population() == Absorption::PopulationType::ByNLTEVibrationalTemperatures or
+      band.Population() == Absorption::PopulationType::ByNLTEPopulationDistribution)
+    return {};
+
+  const bool lorentz = band.LineShapeType() != LineShape::Type::DP;
+  const bool doppler = band.LineShapeType() != LineShape::Type::LP;
+
+  const auto compiled = band.Compiled();
+  std::vector<Numeric> estimate(nl);
+  auto it = f_grid_sorted.cbegin();
+  for (const Index i : compiled->ByFrequency()) {
+    const Numeric F0 = compiled->F0()[i];
+
+    // Distance from the line center to the closest grid point.  The lines
+    // come in order of F0, so the first grid point at or above the line
+    // center is found by walking on from that of the previous line.
+    while (it != f_grid_sorted.cend() and *it < F0) ++it;
+    Numeric d = std::numeric_limits<Numeric>::max();
+    if (it != f_grid_sorted.cend()) d = *it - F0;
+    if (it != f_grid_sorted.cbegin()) d = std::min(d, F0 - *(it - 1));
+
+    Numeric shape = 0;
+    if (lorentz) {
+      const Numeric G0 = X[i].G0;
+      shape = G0 / (Constant::pi * (d * d + G0 * G0));
+    }
+    if (doppler) {
+      const Numeric GD = DC * F0;
+      shape = std::max(
+          shape, Constant::inv_sqrt_pi / GD * std::exp(-Constant::pow2(d / GD)));
+    }
+
+    estimate[i] = std::abs(S[i]) * shape;
+  }
+
+  const Numeric limit =
+      tolerance * *std::max_element(estimate.cbegin(), estimate.cend());
+  std::vector<bool> negligible(nl);
+  for (Index i = 0; i < nl; i++) negligible[i] = estimate[i] < limit;
+
+  // Keep lines that are part of the derivatives
+  for (auto& j : derivatives_data_active) {
+    const auto& deriv = derivatives_data[j];
+    if (deriv.Target().needQuantumIdentity())
+      for (Index i = 0; i < nl; i++)
+        if (negligible[i] and
+            Absorption::id_in_line(band, deriv.QuantumIdentity(), i))
+          negligible[i] = false;
+  }
+
+  return negligible;
+}
+
 void Linefunctions::set_cross_section_of_band(
     InternalData& scratch,
     InternalData& sum,
@@ -1308,7 +1402,8 @@ void Linefunctions::set_cross_section_of_band(
     const Numeric& QT0,
     const bool no_negatives,
     const bool zeeman,
-    const Zeeman::Polarization zeeman_polarization)
+    const Zeeman::Polarization zeeman_polarization,
+    const std::vector<Numeric>& f_grid_sorted)
 {
   const Index nj = derivatives_data_active.nelem();
   const bool do_temperature = do_temperature_jacobian(derivatives_data);
@@ -1346,8 +1441,29 @@ void Linefunctions::set_cross_section_of_band(
   // Placeholder nothingness
   constexpr LineShape::Output empty_output = {0, 0, 0, 0, 0, 0, 0, 0, 0};
   
+  // Line shape parameters and LTE line strengths of all lines in one pass
+  const auto compiled = band.Compiled();
+  compiled->ShapeParameters(scratch.X, band, T, P, vmrs);
+  const bool lte_strength =
+    band.Population() not_eq Absorption::PopulationType::ByNLTEVibrationalTemperatures and
+    band.Population() not_eq Absorption::PopulationType::ByNLTEPopulationDistribution;
+  if (lte_strength)
+    compiled->LineStrengths(scratch.strength, T, band.T0(), isot_ratio, QT, QT0);
+  
+  // Lines that are too weak to matter on this grid
+  std::vector<bool> negligible;
+  if (const Numeric tolerance = line_pruning_tolerance(); tolerance > 0) {
+    if (f_grid_sorted.empty())
+      negligible = find_negligible_lines(sorted_frequency_grid(f_grid), band, scratch.X, scratch.strength, derivatives_data, derivatives_data_active, DC, tolerance);
+    else
+      negligible = find_negligible_lines(f_grid_sorted, band, scratch.X, scratch.strength, derivatives_data, derivatives_data_active, DC, tolerance);
+  }
+  
   for (Index i=0; i<band.NumLines(); i++) {
     
+    if (negligible.size() and negligible[i])
+      continue;
+    
     // Select the range of cutoff if different for each line
     if (band.Cutoff() == Absorption::CutoffType::LineByLineOffset and i>0) {
       fcut_upp = band.CutoffFreq(i);
@@ -1365,7 +1481,7 @@ void Linefunctions::set_cross_section_of_band(
     const auto f = f_full.middleRows(start, nelem);
     
     // Pressure broadening and line mixing terms
-    const auto X = band.ShapeParameters(i, T, P, vmrs);
+    const auto X = scratch.X[i];
     
     // Partial derivatives for temperature
     const auto dXdT = do_temperature ?
@@ -1498,7 +1614,14 @@ void Linefunctions::set_cross_section_of_band(
         case Absorption::PopulationType::ByMakarovFullRelmat:
         case Absorption::PopulationType::ByHITRANRosenkranzRelmat:
         case Absorption::PopulationType::ByLTE:
-          apply_linestrength_scaling_by_lte(F, dF, N, dN, band.Line(i), T, band.T0(), isot_ratio, QT, QT0, band, i, derivatives_data, derivatives_data_active, dQTdT);
+          if (nj == 0) {
+            // Without derivatives the strength from the pass above is all
+            // that apply_linestrength_scaling_by_lte would do
+            F *= scratch.strength[i];
+            N.setZero();
+          } else {
+            apply_linestrength_scaling_by_lte(F, dF, N, dN, band.Line(i), T, band.T0(), isot_ratio, QT, QT0, band, i, derivatives_data, derivatives_data_active, dQTdT);
+          }
           break;
         case Absorption::PopulationType::ByNLTEVibrationalTemperatures: {
           auto nlte_data = nlte.get_vibtemp_params(band, i, T);
@@ -1506,7 +1629,7 @@ void Linefunctions::set_cross_section_of_band(
         } break;
         case Absorption::PopulationType::ByNLTEPopulationDistribution: {
           auto nlte_data = nlte.get_ratio_params(band, i);
-          apply_linestrength_from_nlte_level_distributions(F, dF, N, dN, nlte_data.r_low, nlte_data.r_upp, band.g_low(i), band.g_upp(i), band.A(i), band.F0(i), T, band, i, derivatives_data, derivatives_data_active);
+          apply_linestrength_from_nlte_level_distributions(F, dF, N, dN, nlte_data.r_low, nlte_data.r_upp, compiled->g_low()[i], compiled->g_upp()[i], band.A(i), band.F0(i), T, band, i, derivatives_data, derivatives_data_active);
         } break;
       }
       
@@ -530,6 +530,12 @@ public:
   Eigen::Matrix<Complex, Eigen::Dynamic, Linefunctions::ExpectedDataSize()> data;
   Eigen::Matrix<Complex, 1, Linefunctions::ExpectedDataSize()> datac;
   
+  /** Line shape parameters of all lines of the band */
+  std::vector<LineShape::Output> X;
+  
+  /** LTE line strengths of all lines of the band */
+  std::vector<Numeric> strength;
+  
   InternalData(Index nf, Index nj) {
     F.setZero(nf);
     N.setZero(nf);
@@ -552,7 +558,66 @@ public:
   }
 };  // InternalData
 
+/** Sets the tolerance of line pruning in set_cross_section_of_band
+ *
+ * The setting is global to the process.  See find_negligible_lines.
+ *
+ * @param[in] tolerance Relative tolerance, 0 switches pruning off
+ */
+void set_line_pruning_tolerance(Numeric tolerance) noexcept;
+
+/** Returns the tolerance of line pruning */
+Numeric line_pruning_tolerance() noexcept;
+
+/** The frequency grid in increasing order, as find_negligible_lines wants it
+ * 
+ * Callers that compute many bands or levels on the same grid sort it once
+ * with this and pass it on to set_cross_section_of_band.
+ * 
+ * @param[in] f_grid As WSV
+ * @return f_grid sorted, or empty if line pruning is off
+ */
+std::vector<Numeric> sorted_frequency_grid(const ConstVectorView f_grid);
+
+/** Finds lines that contribute negligibly to the band on a frequency grid
+ * 
+ * The contribution of each line is estimated as its LTE line strength
+ * times an upper estimate of its line shape at the grid point closest to
+ * its line center.  The line shape is estimated as the larger of the
+ * Lorentz and the Doppler profile at that distance.  Lines whose estimate
+ * is below tolerance times the largest estimate of the band are flagged.
+ * The lines are matched to the grid in one sweep in the frequency order
+ * kept by the band's CompiledLines.
+ * 
+ * Nothing is flagged if the tolerance is not positive, if the band is not
+ * in LTE, or for lines that have line parameter derivatives.
+ * 
+ * @param[in] f_grid_sorted The frequency grid in increasing order
+ * @param[in] band The absorption band
+ * @param[in] X The line shape parameters of all lines, as from CompiledLines::ShapeParameters
+ * @param[in] S The LTE line strengths of all lines, as from CompiledLines::LineStrengths
+ * @param[in] derivatives_data Derivatives
+ * @param[in] derivatives_data_active Derivatives that are active
+ * @param[in] DC As per DopplerConstant
+ * @param[in] tolerance The relative tolerance
+ * @return Flags for all lines of the band, or empty if nothing is flagged
+ */
+std::vector<bool> find_negligible_lines(
+  const std::vector<Numeric>& f_grid_sorted,
+  const AbsorptionLines& band,
+  const std::vector<LineShape::Output>& X,
+  const std::vector<Numeric>& S,
+  const ArrayOfRetrievalQuantity& derivatives_data,
+  const ArrayOfIndex& derivatives_data_active,
+  const Numeric& DC,
+  const Numeric& tolerance);
+
 /** Computes the cross-section of an absorption band
+ * 
+ * Lines flagged by find_negligible_lines for the current
+ * line_pruning_tolerance are skipped.  The line shape parameters and the
+ * LTE line strengths of all lines are computed in one pass each from the
+ * band's CompiledLines, and shared by the pruning test and the line loop.
  * 
  * @param[in,out] scratch Data that is overwritten by every line
  * @param[in,out] sun Data that is set to zero then added onto by every line
@@ -574,6 +639,7 @@ public:
  * @param[in] no_negatives Check sum.F before output of any real negative values, and removes them if present
  * @param[in] zeeman Attempts adding up the fine Zeeman lines
  * @param[in] zeeman_polarization The polarization of Zeeman model (to know how many Zeeman lines there will be)
+ * @param[in] f_grid_sorted f_grid in increasing order, from sorted_frequency_grid.  If empty, f_grid is sorted here when line pruning needs it
  */
 void set_cross_section_of_band(
   InternalData& scratch,
@@ -595,7 +661,8 @@ void set_cross_section_of_band(
   const Numeric& QT0,
   const bool no_negatives=false,
   const bool zeeman=false,
-  const Zeeman::Polarization zeeman_polarization=Zeeman::Polarization::Pi);
+  const Zeeman::Polarization zeeman_polarization=Zeeman::Polarization::Pi,
+  const std::vector<Numeric>& f_grid_sorted={});
 };  // namespace Linefunctions
 
 #endif  //linefunctions_h
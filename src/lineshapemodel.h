@@ -395,7 +395,7 @@ class SingleSpeciesModel {
    * 
    * @return The broadening parameter at temperature
    */
-  constexpr Numeric special_linemixing_aer(Numeric T, ModelParameters mp) const noexcept {
+  static constexpr Numeric special_linemixing_aer(Numeric T, ModelParameters mp) noexcept {
     if (T < 250)
       return mp.X0 + (T - 200) * (mp.X1 - mp.X0) / (250 - 200);
     else if (T > 296)
@@ -439,42 +439,54 @@ class SingleSpeciesModel {
 #define x2 X[Index(var)].X2
 #define x3 X[Index(var)].X3
 
-/** Compute the broadening parameter at the input
+/** Compute a broadening parameter from its model parameters
  * 
+ * @param[in] mp The model parameters
  * @param[in] T The temperature
  * @param[in] T0 The temperature used to derive the coefficients
- * @param[in] var The variable
  * 
  * @return The broadening parameter at temperature
  */
-Numeric compute(Numeric T, Numeric T0, Variable var) const noexcept {
+static Numeric compute(const ModelParameters& mp, Numeric T, Numeric T0) noexcept {
   using std::log;
   using std::pow;
   
   Numeric out=std::numeric_limits<Numeric>::quiet_NaN();
-  switch (X[Index(var)].type) {
+  switch (mp.type) {
     case TemperatureModel::None:
       out = 0; break;
     case TemperatureModel::T0:
-      out = x0; break;
+      out = mp.X0; break;
     case TemperatureModel::T1:
-      out = x0 * pow(T0 / T, x1); break;
+      out = mp.X0 * pow(T0 / T, mp.X1); break;
     case TemperatureModel::T2:
-      out = x0 * pow(T0 / T, x1) * (1 + x2 * log(T / T0)); break;
+      out = mp.X0 * pow(T0 / T, mp.X1) * (1 + mp.X2 * log(T / T0)); break;
     case TemperatureModel::T3:
-      out = x0 + x1 * (T - T0); break;
+      out = mp.X0 + mp.X1 * (T - T0); break;
     case TemperatureModel::T4:
-      out = (x0 + x1 * (T0 / T - 1.)) * pow(T0 / T, x2); break;
+      out = (mp.X0 + mp.X1 * (T0 / T - 1.)) * pow(T0 / T, mp.X2); break;
     case TemperatureModel::T5:
-      out = x0 * pow(T0 / T, 0.25 + 1.5 * x1); break;
+      out = mp.X0 * pow(T0 / T, 0.25 + 1.5 * mp.X1); break;
     case TemperatureModel::LM_AER:
-      out = special_linemixing_aer(T, X[Index(var)]); break;
+      out = special_linemixing_aer(T, mp); break;
     case TemperatureModel::DPL:
-      out = x0 * pow(T0 / T, x1) + x2 * pow(T0 / T, x3); break;
+      out = mp.X0 * pow(T0 / T, mp.X1) + mp.X2 * pow(T0 / T, mp.X3); break;
   }
   return out;
 }
 
+/** Compute the broadening parameter at the input
+ * 
+ * @param[in] T The temperature
+ * @param[in] T0 The temperature used to derive the coefficients
+ * @param[in] var The variable
+ * 
+ * @return The broadening parameter at temperature
+ */
+Numeric compute(Numeric T, Numeric T0, Variable var) const noexcept {
+  return compute(X[Index(var)], T, T0);
+}
+
 /** Derivative of compute(...) wrt x0
  * 
  * @param[in] T The temperature
@@ -35,9 +35,11 @@
 #include "absorption.h"
 #include "array.h"
 #include "arts.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "legacy_continua.h"
+#include "linefunctions.h"
 #include "file.h"
 #include "global_data.h"
 #include "jacobian.h"
@@ -1807,10 +1809,42 @@ void abs_xsec_per_speciesAddLines(
   // Meta variables that explain the calculations required
   const ArrayOfIndex jac_pos = equivalent_propmattype_indexes(jacobian_quantities);
 
+  // With fewer pressure levels than threads, the level-parallel loop inside
+  // xsec_species leaves threads idle, so schedule all bands at once instead
+  if (not arts_omp_in_parallel() and
+      abs_p.nelem() < arts_omp_get_max_threads()) {
+    ArrayOfIndex species;
+    for (const Index i : abs_species_active)
+      if (abs_species[i].nelem() and not is_zeeman(abs_species[i]))
+        species.push_back(i);
+
+    xsec_species_tiled(abs_xsec_per_species,
+                       src_xsec_per_species,
+                       dabs_xsec_per_species_dx,
+                       dsrc_xsec_per_species_dx,
+                       jacobian_quantities,
+                       jac_pos,
+                       f_grid,
+                       abs_p,
+                       abs_t,
+                       abs_nlte,
+                       abs_vmrs,
+                       abs_species,
+                       species,
+                       abs_lines_per_species,
+                       isotopologue_ratios,
+                       partition_functions);
+    return;
+  }
+
   // Skipping uninteresting data
   static Matrix dummy1(0, 0);
   static ArrayOfMatrix dummy2(0);
 
+  // The frequency grid sorted once for all bands
+  const std::vector<Numeric> f_sorted =
+      Linefunctions::sorted_frequency_grid(f_grid);
+
   // Call xsec_species for each tag group.
   for (Index ii = 0; ii < abs_species_active.nelem(); ++ii) {
     const Index i = abs_species_active[ii];
@@ -1837,7 +1871,8 @@ void abs_xsec_per_speciesAddLines(
           lines,
           isotopologue_ratios.getIsotopologueRatio(lines.QuantumIdentity()),
           partition_functions.getParamType(lines.QuantumIdentity()),
-          partition_functions.getParam(lines.QuantumIdentity()));
+          partition_functions.getParam(lines.QuantumIdentity()),
+          f_sorted);
     }
   }  // End of species for loop.
 }
@@ -34,6 +34,7 @@
 #include "auto_md.h"
 #include "check_input.h"
 #include "cloudbox.h"
+#include "file.h"
 #include "gas_abs_lookup.h"
 #include "global_data.h"
 #include "interpolation_poly.h"
@@ -42,6 +43,7 @@
 #include "messages.h"
 #include "physics_funcs.h"
 #include "rng.h"
+#include "rte.h"
 
 extern const Index GFIELD4_FIELD_NAMES;
 extern const Index GFIELD4_P_GRID;
@@ -217,7 +219,9 @@ void abs_lookupCalc(  // Workspace reference:
   abs_lookup.log_p_grid.resize(n_p_grid);
   transform(abs_lookup.log_p_grid, log, abs_lookup.p_grid);
 
-  // 6. Create abs_lookup.xsec with the right dimensions:
+  // 6. Create abs_lookup.xsec with the right dimensions. This drops the
+  // memory map of a table read before.
+  Tensor4& xsec = abs_lookup.Xsec();
   {
     Index a, b, c, d;
 
@@ -232,8 +236,8 @@ void abs_lookupCalc(  // Workspace reference:
 
     d = n_p_grid;
 
-    abs_lookup.xsec.resize(a, b, c, d);
-    abs_lookup.xsec = NAN;
+    xsec.resize(a, b, c, d);
+    xsec = NAN;
   }
 
   // 6.a. Set up these_t_pert. This is done so that we can use the
@@ -405,7 +409,7 @@ void abs_lookupCalc(  // Workspace reference:
           // Store in the right place:
           // Loop through all altitudes
           for (Index p = 0; p < n_p_grid; ++p) {
-            abs_lookup.xsec(j, spec, Range(joker), p) =
+            xsec(j, spec, Range(joker), p) =
                 abs_xsec_per_species[i](Range(joker), p);
 
             // There used to be a division by the number density
@@ -2018,6 +2022,30 @@ void abs_lookupAdapt(GasAbsLookup& abs_lookup,
   abs_lookup_is_adapted = 1;
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupReadMapped(GasAbsLookup& abs_lookup,
+                          Index& abs_lookup_is_adapted,
+                          const String& filename,
+                          const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  const String expanded = expand_path(filename);
+  out2 << "  Mapping lookup table " << expanded << '\n';
+  abs_lookup.ReadMapped(expanded, verbosity);
+  abs_lookup_is_adapted = 0;
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupWriteMapped(const GasAbsLookup& abs_lookup,
+                           const String& filename,
+                           const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  const String expanded = expand_path(filename);
+  out2 << "  Writing native lookup table " << expanded << '\n';
+  abs_lookup.WriteMapped(expanded, verbosity);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propmat_clearskyAddFromLookup(
     ArrayOfPropagationMatrix& propmat_clearsky,
@@ -2066,21 +2094,48 @@ void propmat_clearskyAddFromLookup(
   
   // The function we are going to call here is one of the few helper
   // functions that adjust the size of their output argument
-  // automatically.
-  abs_lookup.Extract(abs_scalar_gas,
-                     abs_p_interp_order,
-                     abs_t_interp_order,
-                     abs_nls_interp_order,
-                     abs_f_interp_order,
-                     a_pressure,
-                     a_temperature,
-                     a_vmr_list,
-                     f_grid,
-                     extpolfac);
-  if (do_freq_jac) {
-    Vector dfreq = f_grid;
-    dfreq += df;
-    abs_lookup.Extract(dabs_scalar_gas_df,
+  // automatically. Points of a column or a propagation path may already
+  // have been extracted together, see abs_lookup_prefetch.
+  auto find_prefetched = [&](Matrix& sga, const Numeric& t) {
+    return GasAbsLookupPrefetch::Find(sga,
+                                      abs_lookup,
+                                      abs_p_interp_order,
+                                      abs_t_interp_order,
+                                      abs_nls_interp_order,
+                                      abs_f_interp_order,
+                                      a_pressure,
+                                      t,
+                                      a_vmr_list,
+                                      f_grid,
+                                      extpolfac);
+  };
+  if (do_temp_jac) {
+    if (!find_prefetched(abs_scalar_gas, a_temperature) ||
+        !find_prefetched(dabs_scalar_gas_dt, a_temperature + dt)) {
+      // Extract the unperturbed and the temperature perturbed point in one
+      // go, they share the table checks and the frequency grid positions.
+      const Vector p_points(2, a_pressure);
+      const Vector t_points{a_temperature, a_temperature + dt};
+      Matrix vmr_points(a_vmr_list.nelem(), 2);
+      vmr_points(joker, 0) = a_vmr_list;
+      vmr_points(joker, 1) = a_vmr_list;
+
+      Tensor3 abs_scalar_gas_points;
+      abs_lookup.Extract(abs_scalar_gas_points,
+                         abs_p_interp_order,
+                         abs_t_interp_order,
+                         abs_nls_interp_order,
+                         abs_f_interp_order,
+                         p_points,
+                         t_points,
+                         vmr_points,
+                         f_grid,
+                         extpolfac);
+      abs_scalar_gas = abs_scalar_gas_points(0, joker, joker);
+      dabs_scalar_gas_dt = abs_scalar_gas_points(1, joker, joker);
+    }
+  } else if (!find_prefetched(abs_scalar_gas, a_temperature)) {
+    abs_lookup.Extract(abs_scalar_gas,
                        abs_p_interp_order,
                        abs_t_interp_order,
                        abs_nls_interp_order,
@@ -2088,20 +2143,21 @@ void propmat_clearskyAddFromLookup(
                        a_pressure,
                        a_temperature,
                        a_vmr_list,
-                       dfreq,
+                       f_grid,
                        extpolfac);
   }
-  if (do_temp_jac) {
-    const Numeric dtemp = a_temperature + dt;
-    abs_lookup.Extract(dabs_scalar_gas_dt,
+  if (do_freq_jac) {
+    Vector dfreq = f_grid;
+    dfreq += df;
+    abs_lookup.Extract(dabs_scalar_gas_df,
                        abs_p_interp_order,
                        abs_t_interp_order,
                        abs_nls_interp_order,
                        abs_f_interp_order,
                        a_pressure,
-                       dtemp,
+                       a_temperature,
                        a_vmr_list,
-                       f_grid,
+                       dfreq,
                        extpolfac);
   }
 
@@ -2262,6 +2318,31 @@ void propmat_clearsky_fieldCalc(Workspace& ws,
   // Make local copy of f_grid, so that we can apply Dopler if we want.
   Vector this_f_grid = f_grid;
 
+  // If the agenda takes the absorption from the lookup table, extract it
+  // for all points at once. Not with Doppler shifts, then the frequency
+  // grids of the pressure levels differ.
+  std::unique_ptr<GasAbsLookupPrefetch> lookup_prefetch;
+  if (0 == doppler.nelem() && n_pressures) {
+    const Index n_points = n_pressures * n_latitudes * n_longitudes;
+    Vector p_points(n_points), t_points(n_points);
+    Matrix vmr_points(n_species, n_points);
+    Index ip = 0;
+    for (Index ipr = 0; ipr < n_pressures; ++ipr)
+      for (Index ila = 0; ila < n_latitudes; ++ila)
+        for (Index ilo = 0; ilo < n_longitudes; ++ilo, ++ip) {
+          p_points[ip] = p_grid[ipr];
+          t_points[ip] = t_field(ipr, ila, ilo);
+          vmr_points(joker, ip) = vmr_field(joker, ipr, ila, ilo);
+        }
+    lookup_prefetch = abs_lookup_prefetch(ws,
+                                          abs_agenda,
+                                          ArrayOfRetrievalQuantity(0),
+                                          f_grid,
+                                          p_points,
+                                          t_points,
+                                          vmr_points);
+  }
+
   // Now we have to loop all points in the atmosphere:
   if (n_pressures)
 #pragma omp parallel for if (!arts_omp_in_parallel() &&                        \
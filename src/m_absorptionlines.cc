@@ -27,12 +27,19 @@
  * @brief  Contains the user interaction with absorption lines
  **/
 
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
 #include "absorptionlines.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "file.h"
 #include "global_data.h"
+#include "linefunctions.h"
 #include "xml_io_private.h"
 #include "m_xml.h"
+#include "voigt_kernel.h"
 
 /////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////// Reading old/external functions
@@ -442,6 +449,155 @@ HitranType string2hitrantype(const String& s) {
   }
 }
 
+/** Number of data records between two entries of a HITRAN index */
+constexpr Index hitran_index_stride = 1024;
+
+/** Quick read of the frequency of a HITRAN record
+ *
+ * All HITRAN formats start with the molecule number (2 characters), the
+ * isotopologue (1 character) and the wavenumber (12 characters).
+ *
+ * @param[in] line A line of a HITRAN file
+ * @return The frequency in Hz, or NaN for comment and short lines
+ */
+Numeric hitran_record_frequency(const String& line) {
+  if (line.nelem() < 15) return NAN;
+
+  const Index mo = std::atol(line.substr(0, 2).c_str());
+  if (mo == 0) return NAN;
+
+  const Numeric w2Hz = Constant::c * 100.;
+  return std::strtod(line.substr(3, 12).c_str(), nullptr) * w2Hz;
+}
+
+/** Position in a HITRAN file to start reading from for a frequency
+ *
+ * Uses the index file written by WriteHITRANIndex.  The position is the
+ * start of a record such that all earlier records have lower frequency
+ * than fmin.
+ *
+ * @param[in] index_file Name of the index file
+ * @param[in] hitran_file Name of the HITRAN file
+ * @param[in] fmin Minimum frequency to read
+ * @return Position in the HITRAN file, or -1 if the index does not match
+ * the HITRAN file
+ */
+std::streamoff hitran_index_start(const String& index_file,
+                                  const String& hitran_file,
+                                  const Numeric& fmin) {
+  std::ifstream is(index_file.c_str());
+  String magic;
+  Index version, stride;
+  std::streamoff file_size;
+  is >> magic >> version >> file_size >> stride;
+  if (!is or magic != "ARTSHITRANINDEX" or version != 1) return -1;
+
+  std::ifstream hitran(hitran_file.c_str(), std::ios::binary | std::ios::ate);
+  if (hitran.tellg() != file_size) return -1;
+
+  std::streamoff start = 0, offset;
+  Numeric f;
+  while (is >> offset >> f) {
+    if (f < fmin)
+      start = offset;
+    else
+      break;
+  }
+  return start;
+}
+
+/** Reads one HITRAN record from a stream
+ *
+ * @param[in] is Stream with the record
+ * @param[in] hitran_version Format of the record
+ * @return The line, flagged bad if the stream holds no valid record
+ */
+Absorption::SingleLineExternal read_hitran_record(istream& is,
+                                                  const HitranType hitran_version) {
+  switch (hitran_version) {
+    case HitranType::Post2004:
+      return Absorption::ReadFromHitran2004Stream(is);
+    case HitranType::Pre2004:
+      return Absorption::ReadFromHitran2001Stream(is);
+    case HitranType::Online:
+      return Absorption::ReadFromHitranOnlineStream(is);
+  }
+  throw std::runtime_error("A bad developer did not throw in time to stop this message.\nThe HitranType enum class has to be fully updated!\n");
+}
+
+/** Splits lines into bands, with the isotopologues in parallel
+ *
+ * Lines of different isotopologues never share a band, so the lines are
+ * first grouped by isotopologue and each group is split by
+ * Absorption::split_list_of_external_lines on its own thread.  The bands
+ * are then merged in the order of their last line in external_lines,
+ * descending, which is the order of a serial split of all lines.
+ *
+ * @param[in,out] external_lines The lines, empty on return
+ * @param[in] localquantas Local quantum numbers
+ * @param[in] globalquantas Global quantum numbers
+ * @return The bands
+ */
+std::vector<Absorption::Lines> split_list_of_external_lines_parallel(
+    std::vector<Absorption::SingleLineExternal>& external_lines,
+    const std::vector<QuantumNumberType>& localquantas,
+    const std::vector<QuantumNumberType>& globalquantas) {
+  std::map<std::pair<Index, Index>, std::size_t> group_of_isotopologue;
+  std::vector<std::vector<Absorption::SingleLineExternal>> groups;
+  std::vector<std::vector<std::size_t>> group_lines;
+  for (std::size_t i = 0; i < external_lines.size(); i++) {
+    const auto key =
+        std::make_pair(external_lines[i].quantumidentity.Species(),
+                       external_lines[i].quantumidentity.Isotopologue());
+    auto it = group_of_isotopologue.find(key);
+    if (it == group_of_isotopologue.end()) {
+      it = group_of_isotopologue.emplace(key, groups.size()).first;
+      groups.emplace_back();
+      group_lines.emplace_back();
+    }
+    groups[it->second].push_back(std::move(external_lines[i]));
+    group_lines[it->second].push_back(i);
+  }
+  external_lines.clear();
+
+  std::vector<std::vector<Absorption::Lines>> bands(groups.size());
+  std::vector<std::vector<std::size_t>> band_last(groups.size());
+  bool failed = false;
+  String fail_msg;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && groups.size() > 1) \
+    schedule(dynamic)
+  for (std::size_t ig = 0; ig < groups.size(); ig++) {
+    if (failed) continue;
+    try {
+      bands[ig] = Absorption::split_list_of_external_lines(
+          groups[ig], localquantas, globalquantas, &band_last[ig]);
+    } catch (const std::exception& e) {
+#pragma omp critical(split_list_of_external_lines_parallel_fail)
+      {
+        failed = true;
+        fail_msg = e.what();
+      }
+    }
+  }
+
+  if (failed) throw std::runtime_error(fail_msg);
+
+  // Order all bands by the position of their last line in external_lines
+  std::vector<std::pair<std::size_t, Absorption::Lines*>> order;
+  for (std::size_t ig = 0; ig < groups.size(); ig++)
+    for (std::size_t ib = 0; ib < bands[ig].size(); ib++)
+      order.emplace_back(group_lines[ig][band_last[ig][ib]], &bands[ig][ib]);
+  std::sort(order.begin(), order.end(), [](const auto& a, const auto& b) {
+    return a.first > b.first;
+  });
+
+  std::vector<Absorption::Lines> lines(0);
+  lines.reserve(order.size());
+  for (auto& band : order) lines.push_back(std::move(*band.second));
+  return lines;
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
                 const String& hitran_file,
@@ -459,6 +615,8 @@ void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
                 const Numeric& linemixinglimit_value,
                 const Verbosity& verbosity)
 {
+  CREATE_OUT2;
+
   // Global numbers
   const std::vector<QuantumNumberType> global_nums = string2vecqn(globalquantumnumbers);
   
@@ -472,39 +630,88 @@ void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
   ifstream is;
   open_input_file(is, hitran_file);
   
+  // Skip to fmin if there is an index of the file
+  const String index_file = hitran_file + ".index";
+  if (file_exists(index_file)) {
+    const std::streamoff start = hitran_index_start(index_file, hitran_file, fmin);
+    if (start < 0) {
+      out2 << "  Ignoring index " << index_file
+           << ", it does not match the HITRAN file.\n";
+    } else {
+      out2 << "  Using index " << index_file << "\n";
+      is.seekg(start);
+    }
+  }
+  
+  // The readers set up their species tables on the first call, let that
+  // happen before the parallel region
+  {
+    istringstream empty;
+    read_hitran_record(empty, hitran_version);
+  }
+  
+  // Read the records in the frequency range chunk-wise, and parse each
+  // chunk in parallel
+  constexpr std::size_t chunk_size = 1 << 16;
+  std::vector<String> chunk;
+  chunk.reserve(chunk_size);
+  std::vector<Absorption::SingleLineExternal> parsed;
   std::vector<Absorption::SingleLineExternal> v(0);
   
   bool go_on = true;
   while (go_on) {
-    switch (hitran_version) {
-      case HitranType::Post2004:
-        v.push_back(Absorption::ReadFromHitran2004Stream(is));
-        break;
-      case HitranType::Pre2004:
-        v.push_back(Absorption::ReadFromHitran2001Stream(is));
+    chunk.resize(0);
+    String line;
+    while (chunk.size() < chunk_size) {
+      if (not getline(is, line)) {
+        go_on = false;
         break;
-      case HitranType::Online:
-        v.push_back(Absorption::ReadFromHitranOnlineStream(is));
+      }
+      
+      // Comment lines are skipped here, as the parser would skip them
+      const Numeric f = hitran_record_frequency(line);
+      if (std::isnan(f) or f < fmin) {
+        continue;
+      } else if (f > fmax) {
+        go_on = false;
         break;
-      default:
-        throw std::runtime_error("A bad developer did not throw in time to stop this message.\nThe HitranType enum class has to be fully updated!\n");
+      }
+      chunk.push_back(std::move(line));
     }
     
-    if (v.back().bad) {
-      v.pop_back();
-      go_on = false;
-    } else if (v.back().line.F0() < fmin) {
-        v.pop_back();
-    } else if (v.back().line.F0() > fmax) {
-      v.pop_back();
-      go_on = false;
+    parsed.resize(chunk.size());
+    std::vector<String> errors(chunk.size());
+    
+#pragma omp parallel for if (!arts_omp_in_parallel() && chunk.size() > 1)
+    for (std::size_t i = 0; i < chunk.size(); i++) {
+      try {
+        istringstream record(chunk[i]);
+        parsed[i] = read_hitran_record(record, hitran_version);
+        if (not parsed[i].bad)
+          parsed[i].line.Zeeman() =
+              Zeeman::GetAdvancedModel(parsed[i].quantumidentity);
+      } catch (const std::exception& e) {
+        errors[i] = e.what();
+      }
+    }
+    
+    // Records are used in file order and reading throws at the first one
+    // that fails.  Each record is parsed on its own, so a bad record is one
+    // the parser skips, e.g., of a molecule unknown to ARTS, and not the
+    // end of the file
+    for (std::size_t i = 0; i < parsed.size(); i++) {
+      auto& x = parsed[i];
+      if (errors[i].size()) {
+        throw std::runtime_error(errors[i]);
+      } else if (x.bad) {
+        continue;
+      } else if (x.line.F0() < fmin or x.line.F0() > fmax)
+        continue;
+      v.push_back(std::move(x));
     }
   }
   
-  for (auto& x: v)
-    x.line.Zeeman() = Zeeman::GetAdvancedModel(x.quantumidentity);
-  
-  auto x = Absorption::split_list_of_external_lines(v, local_nums, global_nums);
+  auto x = split_list_of_external_lines_parallel(v, local_nums, global_nums);
   abs_lines.resize(0);
   abs_lines.reserve(x.size());
   while (x.size()) {
@@ -521,6 +728,50 @@ void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
   abs_linesSetLinemixingLimit(abs_lines, linemixinglimit_value, verbosity);
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void WriteHITRANIndex(const String& hitran_file, const Verbosity& verbosity)
+{
+  CREATE_OUT2;
+
+  ifstream is;
+  open_input_file(is, hitran_file);
+
+  const String index_file = hitran_file + ".index";
+  ofstream os;
+  open_output_file(os, index_file);
+
+  // File size, to detect an outdated index
+  is.seekg(0, std::ios::end);
+  const std::streamoff file_size = is.tellg();
+  is.seekg(0);
+
+  os << "ARTSHITRANINDEX 1 " << file_size << ' ' << hitran_index_stride << '\n';
+  os << std::setprecision(17);
+
+  String line;
+  Index n = 0;
+  Numeric f_last = 0;
+  std::streamoff offset = is.tellg();
+  while (getline(is, line)) {
+    const Numeric f = hitran_record_frequency(line);
+    if (not std::isnan(f)) {
+      if (f < f_last) {
+        std::ostringstream err;
+        err << "The HITRAN file " << hitran_file << " is not sorted by "
+            << "frequency,\nso that it can not be indexed.";
+        throw std::runtime_error(err.str());
+      }
+      f_last = f;
+
+      if (n % hitran_index_stride == 0) os << offset << ' ' << f << '\n';
+      n++;
+    }
+    offset = is.tellg();
+  }
+
+  out2 << "  Wrote index of " << n << " records to " << index_file << "\n";
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ReadLBLRTM(ArrayOfAbsorptionLines& abs_lines,
                 const String& lblrtm_file,
@@ -2530,3 +2781,29 @@ void abs_linesPrintDefinedQuantumNumbers(const ArrayOfAbsorptionLines& abs_lines
     out0 << quantumnumbertype2string(QuantumNumberType(qn.first)) << ':' << ' ' << qn.second << '\n';
   }
 }
+
+/////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////// Line shape evaluation settings
+/////////////////////////////////////////////////////////////////////////////////////
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void SetVoigtKernel(const String& kernel, const Verbosity& verbosity)
+{
+  CREATE_OUT2;
+  
+  Linefunctions::set_voigt_kernel(Linefunctions::toVoigtKernelOrThrow(kernel));
+  out2 << "  Voigt line shapes are evaluated with the " << kernel << " kernel.\n";
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void SetLinePruningTolerance(const Numeric& tolerance, const Verbosity&)
+{
+  if (tolerance < 0 or tolerance >= 1) {
+    ostringstream os;
+    os << "The line pruning tolerance must be in [0, 1), but it is "
+       << tolerance << ".\n";
+    throw std::runtime_error(os.str());
+  }
+  
+  Linefunctions::set_line_pruning_tolerance(tolerance);
+}
@@ -55,8 +55,8 @@ void AgendaExecute(Workspace& ws,
 
   const AgRecord& agr = agenda_data[AgendaMap.find(this_agenda.name())->second];
 
-  // Duplicate input-only arguments of the agenda as they might be
-  // changed inside the agenda.
+  // Share input-only arguments of the agenda as they might be
+  // changed inside the agenda. They are copied when that happens.
   const ArrayOfIndex& ain = agr.In();
   const ArrayOfIndex& aout = agr.Out();
 
@@ -75,9 +75,14 @@ void AgendaExecute(Workspace& ws,
                  insert_iterator<set<Index> >(in_only, in_only.begin()));
   for (set<Index>::const_iterator it = in_only.begin(); it != in_only.end();
        it++) {
-    ws.duplicate(*it);
+    ws.share(*it);
   }
 
+  // The agenda writes its output directly to the variables in the current
+  // scope, so they can not be shared with an outer one.
+  for (ArrayOfIndex::const_iterator it = aout.begin(); it != aout.end(); it++)
+    ws.unshare(*it);
+
   const ArrayOfIndex& outputs_to_push = this_agenda.get_output2push();
   const ArrayOfIndex& outputs_to_dup = this_agenda.get_output2dup();
 
@@ -85,7 +90,7 @@ void AgendaExecute(Workspace& ws,
        it != outputs_to_push.end();
        it++) {
     if (ws.is_initialized(*it))
-      ws.duplicate(*it);
+      ws.share(*it);
     else
       ws.push_uninitialized(*it, NULL);
   }
@@ -118,7 +118,9 @@ void ybatchCalc(Workspace& ws,
   }
 
   // We have to make a local copy of the Workspace and the agendas because
-  // only non-reference types can be declared firstprivate in OpenMP
+  // only non-reference types can be declared firstprivate in OpenMP.
+  // The copies share all variables with ws, only the variables that the
+  // agenda writes get a private copy in each thread.
   Workspace l_ws(ws);
   Agenda l_ybatch_calc_agenda(ybatch_calc_agenda);
 
@@ -685,7 +687,9 @@ void DOBatchCalc(Workspace& ws,
   dobatch_spectral_irradiance_field.resize(ybatch_n);
 
   // We have to make a local copy of the Workspace and the agendas because
-  // only non-reference types can be declared firstprivate in OpenMP
+  // only non-reference types can be declared firstprivate in OpenMP.
+  // The copies share all variables with ws, only the variables that the
+  // agenda writes get a private copy in each thread.
   Workspace l_ws(ws);
   Agenda l_dobatch_calc_agenda(dobatch_calc_agenda);
 
@@ -1341,74 +1341,86 @@ void ScatElementsToabs_speciesAdd(  //WS Output:
   scat_dataCheck(scat_data_raw, "sane", 1e-2, verbosity);
 }
 
-/* Workspace method: Doxygen documentation will be auto-generated */
-void ScatSpeciesScatAndMetaRead(  //WS Output:
-    ArrayOfArrayOfSingleScatteringData& scat_data_raw,
-    ArrayOfArrayOfScatteringMetaData& scat_meta,
-    // Keywords:
-    const ArrayOfString& scat_data_files,
-    const Verbosity& verbosity) {
-  CREATE_OUT2;
-  CREATE_OUT3;
+//! Name of the indexed file of a single scattering data file.
+/*!
+  The ending '.xml*' is replaced by '.ssdi'.
+*/
+static String scat_data_indexed_file(const String& scat_data_file) {
+  ArrayOfString strarr;
+  scat_data_file.split(strarr, ".xml");
+  return strarr[0] + ".ssdi";
+}
 
-  //--- Reading the data ---------------------------------------------------
-  ArrayOfSingleScatteringData arr_ssd;
-  ArrayOfScatteringMetaData arr_smd;
+//! Reads the scattering elements of one scattering species.
+/*!
+  Helper for ScatSpeciesScatAndMetaRead and ScatSpeciesScatAndMetaReadSubset.
+  The naming convention of the meta data files is determined from the first
+  file, then all scattering elements are read in parallel.
+
+  If subset is true, only the frequencies and temperatures selected by
+  ssd_subset_ranges are kept. Scattering elements that have an indexed file
+  are then read from it, which only loads the selected data.
+
+  \param[out] arr_ssd          Single scattering data.
+  \param[out] arr_smd          Scattering meta data.
+  \param[in]  scat_data_files  Names of the single scattering data files.
+  \param[in]  subset           Flag whether to read a subset.
+  \param[in]  f_grid           See ssd_subset_ranges.
+  \param[in]  interp_order     See ssd_subset_ranges.
+  \param[in]  T_range          See ssd_subset_ranges.
+  \param[in]  T_interp_order   See ssd_subset_ranges.
+  \param[in]  verbosity        Verbosity setting.
+
+  \date   2026-10-15
+*/
+static void scat_species_read(ArrayOfSingleScatteringData& arr_ssd,
+                              ArrayOfScatteringMetaData& arr_smd,
+                              const ArrayOfString& scat_data_files,
+                              const bool subset,
+                              const Vector& f_grid,
+                              const Index& interp_order,
+                              const Vector& T_range,
+                              const Index& T_interp_order,
+                              const Verbosity& verbosity) {
+  CREATE_OUT3;
 
   arr_ssd.resize(scat_data_files.nelem());
   arr_smd.resize(scat_data_files.nelem());
 
-  Index meta_naming_conv = 0;
-
-  for (Index i = 0; i < 1 && i < scat_data_files.nelem(); i++) {
-    out3 << "  Read single scattering data file " << scat_data_files[i] << "\n";
-    xml_read_from_file(scat_data_files[i], arr_ssd[i], verbosity);
+  if (!scat_data_files.nelem()) return;
 
-    // make meta data name from scat data name
+  // Naming convention of the meta data, decided from the first file
+  Index meta_naming_conv = 0;
+  {
     ArrayOfString strarr;
     String scat_meta_file;
 
-    if (i == 0) {
-      scat_data_files[i].split(strarr, ".xml");
-      scat_meta_file = strarr[0] + ".meta.xml";
-
-      try {
-        find_xml_file(scat_meta_file, verbosity);
-      } catch (const runtime_error&) {
-      }
+    scat_data_files[0].split(strarr, ".xml");
+    scat_meta_file = strarr[0] + ".meta.xml";
 
-      if (file_exists(scat_meta_file)) {
-        out3 << "  Read scattering meta data\n";
-
-        xml_read_from_file(scat_meta_file, arr_smd[i], verbosity);
+    try {
+      find_xml_file(scat_meta_file, verbosity);
+    } catch (const runtime_error&) {
+    }
 
-        meta_naming_conv = 1;
-      } else {
-        try {
-          scat_data_files[i].split(strarr, "scat_data");
-          if (strarr.nelem() < 2) {
-            throw std::runtime_error(
-                "Splitting scattering data filename up at 'scat_data' also failed.");
-          }
-          scat_meta_file = strarr[0] + "scat_meta" + strarr[1];
-
-          out3 << "  Read scattering meta data\n";
-          xml_read_from_file(scat_meta_file, arr_smd[i], verbosity);
-
-          meta_naming_conv = 2;
-        } catch (const std::runtime_error& e) {
-          ostringstream os;
-          os << "No meta data file following one of the allowed naming "
-             << "conventions was found.\n"
-             << "Allowed are "
-             << "*.meta.xml from *.xml and "
-             << "*scat_meta* from *scat_data*\n"
-             << "Scattering meta data file not found: " << scat_meta_file
-             << "\n"
-             << e.what();
-          throw runtime_error(os.str());
-        }
+    if (file_exists(scat_meta_file)) {
+      meta_naming_conv = 1;
+    } else {
+      scat_data_files[0].split(strarr, "scat_data");
+      if (strarr.nelem() < 2) {
+        ostringstream os;
+        os << "No meta data file following one of the allowed naming "
+           << "conventions was found.\n"
+           << "Allowed are "
+           << "*.meta.xml from *.xml and "
+           << "*scat_meta* from *scat_data*\n"
+           << "Scattering meta data file not found: " << scat_meta_file
+           << "\n"
+           << "Splitting scattering data filename up at 'scat_data' also "
+           << "failed.";
+        throw runtime_error(os.str());
       }
+      meta_naming_conv = 2;
     }
   }
 
@@ -1419,7 +1431,7 @@ void ScatSpeciesScatAndMetaRead(  //WS Output:
     num_threads(arts_omp_get_max_threads() > 16 ? 16                          \
                                                 : arts_omp_get_max_threads()) \
         shared(out3, scat_data_files, arr_ssd, arr_smd)
-  for (Index i = 1; i < scat_data_files.nelem(); i++) {
+  for (Index i = 0; i < scat_data_files.nelem(); i++) {
     // make meta data name from scat data name
     ArrayOfString strarr;
     String scat_meta_file;
@@ -1427,39 +1439,75 @@ void ScatSpeciesScatAndMetaRead(  //WS Output:
     ScatteringMetaData smd;
 
     try {
-      out3 << "  Read single scattering data file " << scat_data_files[i]
-           << "\n";
-      xml_read_from_file(scat_data_files[i], ssd, verbosity);
-
-      scat_data_files[i].split(strarr, ".xml");
-      scat_meta_file = strarr[0] + ".meta.xml";
+      // An indexed file is looked for next to the XML file, wherever that
+      // was found, and only used if it is not older than the XML file
+      String indexed_file;
+      bool use_indexed = false;
+      if (subset) {
+        String source_file = scat_data_files[i];
+        find_xml_file(source_file, verbosity);
+        indexed_file = scat_data_indexed_file(source_file);
+        if (file_exists(indexed_file)) {
+          use_indexed = ssd_indexed_is_current(indexed_file, source_file);
+          if (!use_indexed)
+            out3 << "  Ignoring outdated indexed file " << indexed_file
+                 << "\n";
+        }
+      }
+      if (use_indexed) {
+        out3 << "  Read indexed single scattering data file " << indexed_file
+             << "\n";
+        ssd_read_indexed(ssd,
+                         indexed_file,
+                         f_grid,
+                         interp_order,
+                         T_range,
+                         T_interp_order);
+      } else {
+        out3 << "  Read single scattering data file " << scat_data_files[i]
+             << "\n";
+        xml_read_from_file(scat_data_files[i], ssd, verbosity);
+
+        if (subset) {
+          Index f_start, nf, T_start, nT;
+          ssd_subset_ranges(f_start,
+                            nf,
+                            T_start,
+                            nT,
+                            ssd.f_grid,
+                            ssd.T_grid,
+                            f_grid,
+                            interp_order,
+                            T_range,
+                            T_interp_order);
+          ssd_subset(ssd, f_start, nf, T_start, nT);
+        }
+      }
 
       if (meta_naming_conv == 1) {
         scat_data_files[i].split(strarr, ".xml");
         scat_meta_file = strarr[0] + ".meta.xml";
-
-        out3 << "  Read scattering meta data\n";
-        xml_read_from_file(scat_meta_file, smd, verbosity);
       } else {
         scat_data_files[i].split(strarr, "scat_data");
+        if (strarr.nelem() < 2)
+          throw runtime_error(
+              "Splitting scattering data filename up at 'scat_data' failed.");
         scat_meta_file = strarr[0] + "scat_meta" + strarr[1];
-
-        out3 << "  Read scattering meta data\n";
-        xml_read_from_file(scat_meta_file, smd, verbosity);
       }
+
+      out3 << "  Read scattering meta data\n";
+      xml_read_from_file(scat_meta_file, smd, verbosity);
+
+      //FIXME: currently nothing is done in chk_scattering_meta_data!
+      chk_scattering_meta_data(smd, scat_meta_file, verbosity);
     } catch (const std::exception& e) {
       ostringstream os;
       os << "Run-time error reading scattering data : \n" << e.what();
-#pragma omp critical(ybatchCalc_push_fail_msg)
+#pragma omp critical(ScatSpeciesScatAndMetaRead_push_fail_msg)
       fail_msg.push_back(os.str());
     }
 
-    //FIXME: currently nothing is done in chk_scattering_meta_data!
-    chk_scattering_meta_data(smd, scat_meta_file, verbosity);
-
-#pragma omp critical(ScatSpeciesScatAndMetaRead_assign_ssd)
     arr_ssd[i] = std::move(ssd);
-#pragma omp critical(ScatSpeciesScatAndMetaRead_assign_smd)
     arr_smd[i] = std::move(smd);
   }
 
@@ -1472,12 +1520,105 @@ void ScatSpeciesScatAndMetaRead(  //WS Output:
 
   // check if arrays have same size
   chk_scattering_data(arr_ssd, arr_smd, verbosity);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ScatSpeciesScatAndMetaRead(  //WS Output:
+    ArrayOfArrayOfSingleScatteringData& scat_data_raw,
+    ArrayOfArrayOfScatteringMetaData& scat_meta,
+    // Keywords:
+    const ArrayOfString& scat_data_files,
+    const Verbosity& verbosity) {
+  //--- Reading the data ---------------------------------------------------
+  ArrayOfSingleScatteringData arr_ssd;
+  ArrayOfScatteringMetaData arr_smd;
+
+  scat_species_read(arr_ssd,
+                    arr_smd,
+                    scat_data_files,
+                    false,
+                    Vector(),
+                    1,
+                    Vector(),
+                    1,
+                    verbosity);
 
   // append as new scattering species
   scat_data_raw.push_back(std::move(arr_ssd));
   scat_meta.push_back(std::move(arr_smd));
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ScatSpeciesScatAndMetaReadSubset(  //WS Output:
+    ArrayOfArrayOfSingleScatteringData& scat_data_raw,
+    ArrayOfArrayOfScatteringMetaData& scat_meta,
+    // WS Input:
+    const Vector& f_grid,
+    // Keywords:
+    const ArrayOfString& scat_data_files,
+    const Index& interp_order,
+    const Vector& T_range,
+    const Index& T_interp_order,
+    const Verbosity& verbosity) {
+  ArrayOfSingleScatteringData arr_ssd;
+  ArrayOfScatteringMetaData arr_smd;
+
+  scat_species_read(arr_ssd,
+                    arr_smd,
+                    scat_data_files,
+                    true,
+                    f_grid,
+                    interp_order,
+                    T_range,
+                    T_interp_order,
+                    verbosity);
+
+  // append as new scattering species
+  scat_data_raw.push_back(std::move(arr_ssd));
+  scat_meta.push_back(std::move(arr_smd));
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ScatElementsWriteIndexed(  // Keywords:
+    const ArrayOfString& scat_data_files,
+    const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  ArrayOfString fail_msg;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() &&                       \
+                             scat_data_files.nelem() > 1)                     \
+    num_threads(arts_omp_get_max_threads() > 16 ? 16                          \
+                                                : arts_omp_get_max_threads()) \
+        shared(out2, scat_data_files)
+  for (Index i = 0; i < scat_data_files.nelem(); i++) {
+    try {
+      SingleScatteringData ssd;
+      String source_file = scat_data_files[i];
+      find_xml_file(source_file, verbosity);
+      xml_read_from_file(source_file, ssd, verbosity);
+
+      // Written next to the XML file, where the reading methods look for it
+      const String indexed_file = scat_data_indexed_file(source_file);
+      out2 << "  Writing " << indexed_file << "\n";
+      ssd_write_indexed(ssd, indexed_file, source_file);
+    } catch (const std::exception& e) {
+      ostringstream os;
+      os << "Run-time error converting " << scat_data_files[i] << ":\n"
+         << e.what();
+#pragma omp critical(ScatElementsWriteIndexed_push_fail_msg)
+      fail_msg.push_back(os.str());
+    }
+  }
+
+  if (fail_msg.nelem()) {
+    ostringstream os;
+    for (auto& msg : fail_msg) os << msg << '\n';
+
+    throw runtime_error(os.str());
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ScatElementsSelect(  //WS Output:
     ArrayOfArrayOfSingleScatteringData& scat_data_raw,
@@ -42,6 +42,7 @@
 #include "agenda_class.h"
 #include "array.h"
 #include "arts.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "doit.h"
@@ -503,6 +504,7 @@ void cloudbox_field_monoIterate(Workspace& ws,
                                 const Agenda& doit_rte_agenda,
                                 const Agenda& doit_conv_test_agenda,
                                 const Index& accelerated,
+                                const Index& anderson_depth,
                                 const Verbosity& verbosity)
 
 {
@@ -524,6 +526,13 @@ void cloudbox_field_monoIterate(Workspace& ws,
                     "*cloudbox_field_mono* contains at least one NaN value.\n"
                     "This indicates an improper initialization of *cloudbox_field*.");
 
+  if (anderson_depth < 0)
+    throw runtime_error("*anderson_depth* must be non-negative.");
+  if (anderson_depth > 0 && accelerated > 0)
+    throw runtime_error(
+        "Ng acceleration (*accelerated*) and Anderson acceleration\n"
+        "(*anderson_depth*) can not be combined.");
+
   //cloudbox_field_mono can not be further checked here, because there is no way
   //to find out the size without including a lot more interface
   //variables
@@ -550,6 +559,10 @@ void cloudbox_field_monoIterate(Workspace& ws,
   if (accelerated) {
     acceleration_input.resize(4);
   }
+  DoitAndersonMixing anderson(anderson_depth);
+  // The scattering operators of the 1D doit_scat_fieldCalc(Limb) are
+  // built in the first iteration and kept for the following ones
+  DoitScatOperators scat_operators;
   while (doit_conv_flag_local == 0) {
     // 1. Copy cloudbox_field to cloudbox_field_old.
     cloudbox_field_mono_old_local = cloudbox_field_mono;
@@ -583,6 +596,9 @@ void cloudbox_field_monoIterate(Workspace& ws,
         cloudbox_field_ngAcceleration(
             cloudbox_field_mono, acceleration_input, accelerated, verbosity);
       }
+    } else if (anderson_depth > 0 && doit_conv_flag_local == 0) {
+      // Anderson - Acceleration
+      anderson.update(cloudbox_field_mono, cloudbox_field_mono_old_local);
     }
   }  //end of while loop, convergence is reached.
 }
@@ -2185,166 +2201,128 @@ void doit_scat_fieldCalc(Workspace& ws,
 
   // ------ end of checks -----------------------------------------------
 
-  // Initialize variables *pha_mat* and *pha_mat_spt*
-  Tensor4 pha_mat_local(
-      doit_za_grid_size, aa_grid.nelem(), stokes_dim, stokes_dim, 0.);
-
-  Tensor5 pha_mat_spt_local(pnd_field.nbooks(),
-                            doit_za_grid_size,
-                            aa_grid.nelem(),
-                            stokes_dim,
-                            stokes_dim,
-                            0.);
-
-  // Equidistant step size for integration
-  Vector grid_stepsize(2);
-  grid_stepsize[0] = 180. / (Numeric)(doit_za_grid_size - 1);
-  if (Naa > 1) {
-    grid_stepsize[1] = 360. / (Numeric)(Naa - 1);
-  }
-
-  Tensor3 product_field(Nza, Naa, stokes_dim, 0);
+  // Integration weights of the incoming directions
+  Matrix int_weights;
+  doit_scat_integral_weights(int_weights, za_grid, aa_grid);
 
   out2 << "  Calculate the scattered field\n";
 
   if (atmosphere_dim == 1) {
-    // Get pha_mat at the grid positions
-    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      //There is only loop over zenith angle grid ; no azimuth angle grid.
-      for (Index za_index_local = 0; za_index_local < Nza; za_index_local++) {
-        // Calculate the phase matrix of individual scattering elements
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
-
-        product_field = 0;
-
-        // za_in and aa_in are for incoming zenith and azimuth
-        //angle direction for which pha_mat is calculated
-        for (Index za_in = 0; za_in < Nza; ++za_in) {
-          for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-            // Multiplication of phase matrix with incoming
-            // intensity field.
-
-            for (Index i = 0; i < stokes_dim; i++) {
-              for (Index j = 0; j < stokes_dim; j++) {
-                product_field(za_in, aa_in, i) +=
-                    pha_mat_doit(
-                        p_index, za_index_local, 0, za_in, aa_in, i, j) *
-                    cloudbox_field_mono(p_index, 0, 0, za_in, 0, j);
-              }
-            }
-
-          }  //end aa_in loop
-        }    //end za_in loop
-        //integration of the product of ifield_in and pha
-        //  over zenith angle and azimuth angle grid. It calls
-        if (Naa == 1) {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field(p_index, 0, 0, za_index_local, 0, i) =
-                AngIntegrate_trapezoid(product_field(joker, 0, i), za_grid) /
-                2 / PI;
-          }  //end i loop
-        } else {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field(p_index, 0, 0, za_index_local, 0, i) =
-                AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                            za_grid,
-                                            aa_grid,
-                                            grid_stepsize);
-          }
-        }
-      }  //end za_prop loop
-    }    //end p_index loop
-  }      //end atmosphere_dim = 1
+    // The phase matrices of all directions are known, so the scattering
+    // integral of each pressure level is a matrix-vector product. The
+    // operators are kept between the iterations of one frequency.
+    const Index np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+
+    Tensor3 scat_operators_local;
+    const Tensor3& scat_operators =
+        DoitScatOperators::Get(scat_operators_local, pha_mat_doit, int_weights);
+
+    out3 << "  Multiply phase matrices with incoming intensities\n";
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && np > 1)
+    for (Index p_index = 0; p_index < np; p_index++) {
+      // The fields are flattened as [za * stokes_dim + i]
+      Vector field_in(Nza * stokes_dim), field_scat(Nza * stokes_dim);
+      for (Index za = 0; za < Nza; za++)
+        field_in[Range(za * stokes_dim, stokes_dim)] =
+            cloudbox_field_mono(p_index, 0, 0, za, 0, joker);
+
+      mult(field_scat, scat_operators(p_index, joker, joker), field_in);
+
+      for (Index za = 0; za < Nza; za++)
+        doit_scat_field(p_index, 0, 0, za, 0, joker) =
+            field_scat[Range(za * stokes_dim, stokes_dim)];
+    }
+  }  //end atmosphere_dim = 1
 
   //atmosphere_dim = 3
   else if (atmosphere_dim == 3) {
-    /*there is a loop over pressure, latitude and longitudeindex
-        when we calculate the pha_mat from pha_mat_spt and pnd_field
-        using the method pha_matCalc.  */
+    const Index np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const Index nlat = cloudbox_limits[3] - cloudbox_limits[2] + 1;
+    const Index nlon = cloudbox_limits[5] - cloudbox_limits[4] + 1;
+    const Index npos = np * nlat * nlon;
 
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      for (Index lat_index = 0;
-           lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
-           lat_index++) {
-        for (Index lon_index = 0;
-             lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
-             lon_index++) {
-          Numeric rtp_temperature_local =
-              t_field(p_index + cloudbox_limits[0],
-                      lat_index + cloudbox_limits[2],
-                      lon_index + cloudbox_limits[4]);
-
-          for (Index aa_index_local = 1; aa_index_local < Naa;
-               aa_index_local++) {
-            for (Index za_index_local = 0; za_index_local < Nza;
-                 za_index_local++) {
-              out3 << "Calculate phase matrix \n";
-              pha_mat_spt_agendaExecute(ws,
-                                        pha_mat_spt_local,
-                                        za_index_local,
-                                        lat_index,
-                                        lon_index,
-                                        p_index,
-                                        aa_index_local,
-                                        rtp_temperature_local,
-                                        pha_mat_spt_agenda);
-
-              pha_matCalc(pha_mat_local,
-                          pha_mat_spt_local,
-                          pnd_field,
-                          atmosphere_dim,
-                          p_index,
-                          lat_index,
-                          lon_index,
-                          verbosity);
+    // Each thread gets its own workspace for pha_mat_spt_agenda
+    ThreadWorkspaces thread_ws(ws, npos);
+
+    String fail_msg;
+    bool failed = false;
+
+    out3 << "  Calculate phase matrices and integrate them\n";
+
+#pragma omp parallel for if (thread_ws.parallel()) \
+    num_threads(thread_ws.nthreads())
+    for (Index ipos = 0; ipos < npos; ipos++) {
+      if (failed) continue;
+
+      const Index p_index = ipos / (nlat * nlon);
+      const Index lat_index = (ipos / nlon) % nlat;
+      const Index lon_index = ipos % nlon;
+
+      try {
+        Tensor4 pha_mat_local(Nza, Naa, stokes_dim, stokes_dim, 0.);
+        Tensor5 pha_mat_spt_local(
+            pnd_field.nbooks(), Nza, Naa, stokes_dim, stokes_dim, 0.);
+        Matrix pha_int(stokes_dim, stokes_dim);
+
+        Numeric rtp_temperature_local =
+            t_field(p_index + cloudbox_limits[0],
+                    lat_index + cloudbox_limits[2],
+                    lon_index + cloudbox_limits[4]);
+
+        for (Index aa_index_local = 1; aa_index_local < Naa;
+             aa_index_local++) {
+          for (Index za_index_local = 0; za_index_local < Nza;
+               za_index_local++) {
+            pha_mat_spt_agendaExecute(thread_ws.get(),
+                                      pha_mat_spt_local,
+                                      za_index_local,
+                                      lat_index,
+                                      lon_index,
+                                      p_index,
+                                      aa_index_local,
+                                      rtp_temperature_local,
+                                      pha_mat_spt_agenda);
+
+            pha_matCalc(pha_mat_local,
+                        pha_mat_spt_local,
+                        pnd_field,
+                        atmosphere_dim,
+                        p_index,
+                        lat_index,
+                        lon_index,
+                        verbosity);
+
+            // Integrate the phase matrix over all incoming directions
+            // and apply it to the intensity field
+            doit_scat_pha_integral(pha_int, pha_mat_local, int_weights);
+
+            mult(doit_scat_field(p_index,
+                                 lat_index,
+                                 lon_index,
+                                 za_index_local,
+                                 aa_index_local,
+                                 joker),
+                 pha_int,
+                 cloudbox_field_mono(p_index,
+                                     lat_index,
+                                     lon_index,
+                                     za_index_local,
+                                     aa_index_local,
+                                     joker));
+          }  //end za_prop loop
+        }    //end aa_prop loop
+      } catch (const std::exception& e) {
+#pragma omp critical(doit_scat_fieldCalc_fail)
+        {
+          failed = true;
+          fail_msg = e.what();
+        }
+      }
+    }  // end position loop
+
+    if (failed) throw runtime_error(fail_msg);
 
-              product_field = 0;
-
-              //za_in and aa_in are the incoming directions
-              //for which pha_mat_spt is calculated
-              for (Index za_in = 0; za_in < Nza; ++za_in) {
-                for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-                  // Multiplication of phase matrix
-                  // with incloming intensity field.
-                  for (Index i = 0; i < stokes_dim; i++) {
-                    for (Index j = 0; j < stokes_dim; j++) {
-                      product_field(za_in, aa_in, i) +=
-                          pha_mat_local(za_in, aa_in, i, j) *
-                          cloudbox_field_mono(p_index,
-                                              lat_index,
-                                              lon_index,
-                                              za_index_local,
-                                              aa_index_local,
-                                              j);
-                    }
-                  }
-                }  //end aa_in loop
-              }    //end za_in loop
-              //integration of the product of ifield_in and pha
-              //over zenith angle and azimuth angle grid. It
-              //calls here the integration routine
-              //AngIntegrate_trapezoid_opti
-              for (Index i = 0; i < stokes_dim; i++) {
-                doit_scat_field(p_index,
-                                lat_index,
-                                lon_index,
-                                za_index_local,
-                                aa_index_local,
-                                i) =
-                    AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                                za_grid,
-                                                aa_grid,
-                                                grid_stepsize);
-              }  //end i loop
-            }    //end aa_prop loop
-          }      //end za_prop loop
-        }        //end lon loop
-      }          // end lat loop
-    }            // end p loop
     // aa = 0 is the same as aa = 180:
     doit_scat_field(joker, joker, joker, joker, 0, joker) =
         doit_scat_field(joker, joker, joker, joker, Naa - 1, joker);
@@ -2463,17 +2441,6 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
 
   // ------ end of checks -----------------------------------------------
 
-  // Initialize variables *pha_mat* and *pha_mat_spt*
-  Tensor4 pha_mat_local(
-      doit_za_grid_size, aa_grid.nelem(), stokes_dim, stokes_dim, 0.);
-
-  Tensor5 pha_mat_spt_local(pnd_field.nbooks(),
-                            doit_za_grid_size,
-                            aa_grid.nelem(),
-                            stokes_dim,
-                            stokes_dim,
-                            0.);
-
   // Create the grids for the calculation of the scattering integral.
   Vector za_g;
   nlinspace(za_g, 0, 180, doit_za_grid_size);
@@ -2486,9 +2453,6 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
   Matrix itw_za_i(doit_za_grid_size, 2);
   interpweights(itw_za_i, gp_za_i);
 
-  // Intensity field interpolated on equidistant grid.
-  Matrix cloudbox_field_int(doit_za_grid_size, stokes_dim, 0);
-
   // Second, we have to interpolate the scattering integral on the RT
   // zenith angle grid.
   ArrayOfGridPos gp_za(Nza);
@@ -2497,24 +2461,30 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
   Matrix itw_za(Nza, 2);
   interpweights(itw_za, gp_za);
 
-  // Original scattered field, on equidistant zenith angle grid.
-  Matrix doit_scat_field_org(doit_za_grid_size, stokes_dim, 0);
+  // Integration weights of the incoming directions
+  Matrix int_weights;
+  doit_scat_integral_weights(int_weights, za_g, aa_grid);
 
-  //  Grid stepsize of zenith and azimuth angle grid, these are needed for the
-  // integration function.
-  Vector grid_stepsize(2);
-  grid_stepsize[0] = 180. / (Numeric)(doit_za_grid_size - 1);
-  if (Naa > 1) {
-    grid_stepsize[1] = 360. / (Numeric)(Naa - 1);
-  }
+  if (atmosphere_dim == 1) {
+    // The phase matrices of all directions are known, so the scattering
+    // integral of each pressure level is a matrix-vector product. The
+    // operators are kept between the iterations of one frequency.
+    const Index np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
 
-  Tensor3 product_field(doit_za_grid_size, Naa, stokes_dim, 0);
+    Tensor3 scat_operators_local;
+    const Tensor3& scat_operators =
+        DoitScatOperators::Get(scat_operators_local, pha_mat_doit, int_weights);
+
+    out3 << "  Multiply phase matrices with incoming intensities\n";
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && np > 1)
+    for (Index p_index = 0; p_index < np; p_index++) {
+      // Intensity field interpolated on equidistant grid.
+      Matrix cloudbox_field_int(doit_za_grid_size, stokes_dim, 0);
+
+      // Original scattered field, on equidistant zenith angle grid.
+      Matrix doit_scat_field_org(doit_za_grid_size, stokes_dim, 0);
 
-  if (atmosphere_dim == 1) {
-    // Get pha_mat at the grid positions
-    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
       // Interpolate intensity field:
       for (Index i = 0; i < stokes_dim; i++) {
         if (doit_za_interp == 0) {
@@ -2537,51 +2507,18 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
           assert(false);
       }
 
-      //There is only loop over zenith angle grid; no azimuth angle grid.
-      for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
-           za_index_local++) {
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
-
-        product_field = 0;
-
-        // za_in and aa_in are for incoming zenith and azimuth
-        // angle direction for which pha_mat is calculated
-        for (Index za_in = 0; za_in < doit_za_grid_size; za_in++) {
-          for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-            // Multiplication of phase matrix with incoming
-            // intensity field.
-
-            for (Index i = 0; i < stokes_dim; i++) {
-              for (Index j = 0; j < stokes_dim; j++) {
-                product_field(za_in, aa_in, i) +=
-                    pha_mat_doit(
-                        p_index, za_index_local, 0, za_in, aa_in, i, j) *
-                    cloudbox_field_int(za_in, j);
-              }
-            }
+      // The fields are flattened as [za * stokes_dim + i]
+      Vector field_in(doit_za_grid_size * stokes_dim);
+      Vector field_scat(doit_za_grid_size * stokes_dim);
+      for (Index za = 0; za < doit_za_grid_size; za++)
+        field_in[Range(za * stokes_dim, stokes_dim)] =
+            cloudbox_field_int(za, joker);
 
-          }  //end aa_in loop
-        }    //end za_in loop
+      mult(field_scat, scat_operators(p_index, joker, joker), field_in);
 
-        out3 << "Compute integral. \n";
-        if (Naa == 1) {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field_org(za_index_local, i) =
-                AngIntegrate_trapezoid(product_field(joker, 0, i), za_g) / 2 /
-                PI;
-          }  //end i loop
-        } else {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field_org(za_index_local, i) =
-                AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                            za_g,
-                                            aa_grid,
-                                            grid_stepsize);
-          }
-        }
-
-      }  //end za_prop loop
+      for (Index za = 0; za < doit_za_grid_size; za++)
+        doit_scat_field_org(za, joker) =
+            field_scat[Range(za * stokes_dim, stokes_dim)];
 
       // Interpolation on za_grid, which is used in
       // radiative transfer part.
@@ -2605,100 +2542,118 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
   }  //end atmosphere_dim = 1
 
   else if (atmosphere_dim == 3) {
+    const Index np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const Index nlat = cloudbox_limits[3] - cloudbox_limits[2] + 1;
+    const Index nlon = cloudbox_limits[5] - cloudbox_limits[4] + 1;
+    const Index npos = np * nlat * nlon;
+
+    // Each thread gets its own workspace for pha_mat_spt_agenda
+    ThreadWorkspaces thread_ws(ws, npos);
+
+    String fail_msg;
+    bool failed = false;
+
     // Loop over all positions
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      for (Index lat_index = 0;
-           lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
-           lat_index++) {
-        for (Index lon_index = 0;
-             lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
-             lon_index++) {
-          Numeric rtp_temperature_local =
-              t_field(p_index + cloudbox_limits[0],
-                      lat_index + cloudbox_limits[2],
-                      lon_index + cloudbox_limits[4]);
-
-          // Loop over scattered directions
-          for (Index aa_index_local = 1; aa_index_local < Naa;
-               aa_index_local++) {
-            // Interpolate intensity field:
-            for (Index i = 0; i < stokes_dim; i++) {
-              interp(
-                  cloudbox_field_int(joker, i),
-                  itw_za_i,
-                  cloudbox_field_mono(
-                      p_index, lat_index, lon_index, joker, aa_index_local, i),
-                  gp_za_i);
-            }
+    out3 << "  Calculate phase matrices and integrate them\n";
 
-            for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
-                 za_index_local++) {
-              out3 << "Calculate phase matrix \n";
-              pha_mat_spt_agendaExecute(ws,
-                                        pha_mat_spt_local,
-                                        za_index_local,
-                                        lat_index,
-                                        lon_index,
-                                        p_index,
-                                        aa_index_local,
-                                        rtp_temperature_local,
-                                        pha_mat_spt_agenda);
-
-              pha_matCalc(pha_mat_local,
-                          pha_mat_spt_local,
-                          pnd_field,
-                          atmosphere_dim,
-                          p_index,
-                          lat_index,
-                          lon_index,
-                          verbosity);
+#pragma omp parallel for if (thread_ws.parallel()) \
+    num_threads(thread_ws.nthreads())
+    for (Index ipos = 0; ipos < npos; ipos++) {
+      if (failed) continue;
+
+      const Index p_index = ipos / (nlat * nlon);
+      const Index lat_index = (ipos / nlon) % nlat;
+      const Index lon_index = ipos % nlon;
+
+      try {
+        Tensor4 pha_mat_local(
+            doit_za_grid_size, Naa, stokes_dim, stokes_dim, 0.);
+        Tensor5 pha_mat_spt_local(pnd_field.nbooks(),
+                                  doit_za_grid_size,
+                                  Naa,
+                                  stokes_dim,
+                                  stokes_dim,
+                                  0.);
+        Matrix cloudbox_field_int(doit_za_grid_size, stokes_dim, 0);
+        Matrix doit_scat_field_org(doit_za_grid_size, stokes_dim, 0);
+
+        Numeric rtp_temperature_local =
+            t_field(p_index + cloudbox_limits[0],
+                    lat_index + cloudbox_limits[2],
+                    lon_index + cloudbox_limits[4]);
+
+        // Loop over scattered directions
+        for (Index aa_index_local = 1; aa_index_local < Naa;
+             aa_index_local++) {
+          // Interpolate intensity field:
+          for (Index i = 0; i < stokes_dim; i++) {
+            interp(
+                cloudbox_field_int(joker, i),
+                itw_za_i,
+                cloudbox_field_mono(
+                    p_index, lat_index, lon_index, joker, aa_index_local, i),
+                gp_za_i);
+          }
 
-              product_field = 0;
-
-              //za_in and aa_in are the incoming directions
-              //for which pha_mat_spt is calculated
-              out3 << "Multiplication of phase matrix with"
-                   << "incoming intensity \n";
-
-              for (Index za_in = 0; za_in < doit_za_grid_size; za_in++) {
-                for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-                  // Multiplication of phase matrix
-                  // with incloming intensity field.
-                  for (Index i = 0; i < stokes_dim; i++) {
-                    for (Index j = 0; j < stokes_dim; j++) {
-                      product_field(za_in, aa_in, i) +=
-                          pha_mat_local(za_in, aa_in, i, j) *
-                          cloudbox_field_int(za_in, j);
-                    }
+          for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
+               za_index_local++) {
+            pha_mat_spt_agendaExecute(thread_ws.get(),
+                                      pha_mat_spt_local,
+                                      za_index_local,
+                                      lat_index,
+                                      lon_index,
+                                      p_index,
+                                      aa_index_local,
+                                      rtp_temperature_local,
+                                      pha_mat_spt_agenda);
+
+            pha_matCalc(pha_mat_local,
+                        pha_mat_spt_local,
+                        pnd_field,
+                        atmosphere_dim,
+                        p_index,
+                        lat_index,
+                        lon_index,
+                        verbosity);
+
+            // Weighted sum over the incoming directions of the phase
+            // matrix times the incoming intensity
+            VectorView scat = doit_scat_field_org(za_index_local, joker);
+            scat = 0;
+            for (Index za_in = 0; za_in < doit_za_grid_size; za_in++) {
+              for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
+                const Numeric w = int_weights(za_in, aa_in);
+                for (Index i = 0; i < stokes_dim; i++) {
+                  for (Index j = 0; j < stokes_dim; j++) {
+                    scat[i] += w * pha_mat_local(za_in, aa_in, i, j) *
+                               cloudbox_field_int(za_in, j);
                   }
-                }  //end aa_in loop
-              }    //end za_in loop
-
-              out3 << "Compute the integral \n";
-
-              for (Index i = 0; i < stokes_dim; i++) {
-                doit_scat_field_org(za_index_local, i) =
-                    AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                                za_grid,
-                                                aa_grid,
-                                                grid_stepsize);
-              }  //end stokes_dim loop
-
-            }  //end za_prop loop
-            //Interpolate on original za_grid.
-            for (Index i = 0; i < stokes_dim; i++) {
-              interp(
-                  doit_scat_field(
-                      p_index, lat_index, lon_index, joker, aa_index_local, i),
-                  itw_za,
-                  doit_scat_field_org(joker, i),
-                  gp_za);
+                }
+              }
             }
-          }  // end aa_prop loop
-        }    //end lon loop
-      }      //end lat loop
-    }        // end p loop
+          }  //end za_prop loop
+
+          //Interpolate on original za_grid.
+          for (Index i = 0; i < stokes_dim; i++) {
+            interp(
+                doit_scat_field(
+                    p_index, lat_index, lon_index, joker, aa_index_local, i),
+                itw_za,
+                doit_scat_field_org(joker, i),
+                gp_za);
+          }
+        }  // end aa_prop loop
+      } catch (const std::exception& e) {
+#pragma omp critical(doit_scat_fieldCalcLimb_fail)
+        {
+          failed = true;
+          fail_msg = e.what();
+        }
+      }
+    }  // end position loop
+
+    if (failed) throw runtime_error(fail_msg);
+
     doit_scat_field(joker, joker, joker, joker, 0, joker) =
         doit_scat_field(joker, joker, joker, joker, Naa - 1, joker);
   }  // end atm_dim=3
@@ -51,6 +51,7 @@
 #include "m_general.h"
 #include "messages.h"
 #include "mystring.h"
+#include "profiling.h"
 
 #include "math_funcs.h"
 #include "wsv_aux.h"
@@ -407,6 +408,13 @@ void Exit(const Verbosity& verbosity) {
   arts_exit(EXIT_SUCCESS);
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ProfilingStart(const Verbosity& verbosity) {
+  CREATE_OUT2;
+  Profiling::enable();
+  out2 << "  Profiling of agendas and methods started.\n";
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void TestArrayOfAgenda(Workspace& ws,
                        const ArrayOfAgenda& test_agenda_array,
@@ -227,3 +227,12 @@ void abs_xsec_per_speciesAddHitranXsec(  // WS Output:
     throw std::runtime_error(os.str());
   }
 }
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void SetFftwWisdomFile(const String& filename, const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  hitran_xsec_set_fftw_wisdom_file(filename);
+  if (filename.nelem())
+    out2 << "  Using FFTW wisdom from " << filename << ".\n";
+}
@@ -29,10 +29,12 @@
   ===========================================================================*/
 
 #include <cmath>
+#include <cstdint>
 #include <ctime>
 #include <fstream>
 #include <stdexcept>
 #include "arts.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "lin_alg.h"
@@ -60,6 +62,24 @@ extern const Numeric SPEED_OF_LIGHT;
   === The functions (in alphabetical order)
   ===========================================================================*/
 
+/** Seed of the random number stream of a thread in parallel MC mode
+ *
+ * Mixes mc_seed and the thread number with the splitmix64 finalizer, so
+ * that neither neighbouring seeds nor neighbouring threads share streams.
+ *
+ * @param[in] mc_seed As the WSV
+ * @param[in] thread Thread number
+ * @return Seed for the Rng of this thread
+ */
+static unsigned long int mc_thread_seed(const Index mc_seed,
+                                        const Index thread) {
+  std::uint64_t z = std::uint64_t(mc_seed) +
+                    0x9E3779B97F4A7C15ULL * std::uint64_t(thread + 1);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return (unsigned long int)(z ^ (z >> 31));
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void mc_antennaSetGaussian(MCAntenna& mc_antenna,
                            //keyword arguments
@@ -129,6 +149,7 @@ void MCGeneral(Workspace& ws,
                const Numeric& taustep_limit,
                const Index& l_mc_scat_order,
                const Index& t_interp_order,
+               const Index& nthreads,
                const Verbosity& verbosity) {
   // Checks of input
   //
@@ -199,12 +220,10 @@ void MCGeneral(Workspace& ws,
     throw runtime_error(os.str());
   }
 
-  Ppath ppath_step;
-  Rng rng;  //Random Number generator
+  if (nthreads < 0) throw runtime_error("*nthreads* must be >= 0.");
+
   time_t start_time = time(NULL);
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
-  Vector pnd_vec(
-      N_se);  //Vector of particle number densities used at each point
   Vector Z11maxvector(
       N_se);  //Vector holding the maximum phase function for each
 
@@ -219,22 +238,8 @@ void MCGeneral(Workspace& ws,
     }
   }
 
-  rng.seed(mc_seed, verbosity);
-  Numeric g, temperature, albedo, g_los_csc_theta;
-  Matrix A(stokes_dim, stokes_dim), Q(stokes_dim, stokes_dim);
-  Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
-  Matrix q(stokes_dim, stokes_dim), newQ(stokes_dim, stokes_dim);
-  Matrix Z(stokes_dim, stokes_dim);
-  Matrix R_ant2enu(3, 3),
-      R_stokes(stokes_dim, stokes_dim);  // Needed for antenna rotations
-  q = 0.0;
-  newQ = 0.0;
-  Vector vector1(stokes_dim), abs_vec_mono(stokes_dim), I_i(stokes_dim);
-  Vector Isum(stokes_dim), Isquaredsum(stokes_dim);
-  Index termination_flag = 0;
+  Matrix R_ant2enu(3, 3);  // Needed for antenna rotations
   const Numeric f_mono = f_grid[f_index];
-  const Numeric prop_dir =
-      -1.0;  // propagation direction opposite of los angles
 
   CREATE_OUT0;
 
@@ -250,17 +255,6 @@ void MCGeneral(Workspace& ws,
   mc_source_domain.resize(4);
   mc_source_domain = 0;
 
-  //local versions of workspace
-  Numeric local_surface_skin_t;
-  Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
-  Matrix local_surface_los;
-  Tensor4 local_surface_rmatrix;
-  Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
-  Vector local_rte_los(2);
-  Vector new_rte_los(2);
-  Index np;
-  Isum = 0.0;
-  Isquaredsum = 0.0;
   Numeric std_err_i;
   bool convert_to_rjbt = false;
   if (iy_unit == "RJBT") {
@@ -279,262 +273,444 @@ void MCGeneral(Workspace& ws,
   // Calculate rotation matrix for boresight
   rotmat_enu(R_ant2enu, sensor_los(0, joker));
 
-  //Begin Main Loop
-  //
-  bool keepgoing, oksampling;
-  Index nfails = 0;
-  //
-  while (true) {
-    // Complete content of while inside try/catch to handle occasional
-    // failures in the ppath calculations
-    try {
-      bool inside_cloud;
-
-      mc_iteration_count += 1;
-      Index scattering_order = 0;
-
-      keepgoing = true;   // indicating whether to continue tracing a photon
-      oksampling = true;  // gets false if g becomes zero
-
-      //Sample a FOV direction
-      Matrix R_prop(3, 3);
-      mc_antenna.draw_los(
-          local_rte_los, R_prop, rng, R_ant2enu, sensor_los(0, joker));
-
-      // Get stokes rotation matrix for rotating polarization
-      rotmat_stokes(
-          R_stokes, stokes_dim, prop_dir, prop_dir, R_prop, R_ant2enu);
-      id_mat(Q);
-      local_rte_pos = sensor_pos(0, joker);
-      I_i = 0.0;
-
-      while (keepgoing) {
-        mcPathTraceGeneral(ws,
-                           evol_op,
-                           abs_vec_mono,
-                           temperature,
-                           ext_mat_mono,
-                           rng,
-                           local_rte_pos,
-                           local_rte_los,
-                           pnd_vec,
-                           g,
-                           ppath_step,
-                           termination_flag,
-                           inside_cloud,
-                           ppath_step_agenda,
-                           ppath_lmax,
-                           ppath_lraytrace,
-                           taustep_limit,
-                           propmat_clearsky_agenda,
-                           stokes_dim,
-                           f_index,
-                           f_grid,
-                           p_grid,
-                           lat_grid,
-                           lon_grid,
-                           z_field,
-                           refellipsoid,
-                           z_surface,
-                           t_field,
-                           vmr_field,
-                           cloudbox_limits,
-                           pnd_field,
-                           scat_data,
-                           verbosity);
-
-        // GH 2011-09-08: if the lowest layer has large
-        // extent and a thick cloud, g may be 0 due to
-        // underflow, but then I_i should be 0 as well.
-        // Don't turn it into nan for no reason.
-        // If reaching underflow, no point in going on;
-        // hence new photon.
-        // GH 2011-09-14: moved this check to outside the different
-        // scenarios, as this goes wrong regardless of the scenario.
-        if (g == 0) {
-          keepgoing = false;
-          oksampling = false;
-          mc_iteration_count -= 1;
-          out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
-               << "happens repeatedly, try to decrease *ppath_lmax*)";
-        } else if (termination_flag == 1) {
-          iy_space_agendaExecute(ws,
-                                 local_iy,
-                                 Vector(1, f_mono),
-                                 local_rte_pos,
-                                 local_rte_los,
-                                 iy_space_agenda);
-          mult(vector1, evol_op, local_iy(0, joker));
+  // Traces a single photon, adding its radiance to I_i. Returns false if
+  // the path sampling was rejected, and the photon shall not be counted.
+  auto trace_photon = [&](Workspace& l_ws,
+                          Rng& rng,
+                          const Agenda& l_ppath_step_agenda,
+                          const Agenda& l_iy_space_agenda,
+                          const Agenda& l_surface_rtprop_agenda,
+                          const Agenda& l_propmat_clearsky_agenda,
+                          Vector& I_i,
+                          Index& scattering_order,
+                          ArrayOfIndex& source_domain,
+                          Ppath& ppath_step) -> bool {
+    Numeric g, temperature, albedo, g_los_csc_theta;
+    Matrix Q(stokes_dim, stokes_dim);
+    Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
+    Matrix q(stokes_dim, stokes_dim), newQ(stokes_dim, stokes_dim);
+    Matrix Z(stokes_dim, stokes_dim);
+    q = 0.0;
+    newQ = 0.0;
+    Vector vector1(stokes_dim), abs_vec_mono(stokes_dim);
+    Vector pnd_vec(
+        N_se);  //Vector of particle number densities used at each point
+    Index termination_flag = 0;
+
+    //local versions of workspace
+    Numeric local_surface_skin_t;
+    Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
+    Matrix local_surface_los;
+    Tensor4 local_surface_rmatrix;
+    Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
+    Vector local_rte_los(2);
+    Vector new_rte_los(2);
+
+    bool inside_cloud;
+    bool keepgoing = true;  // indicating whether to continue tracing a photon
+    bool oksampling = true;  // gets false if g becomes zero
+    scattering_order = 0;
+
+    //Sample a FOV direction
+    Matrix R_prop(3, 3);
+    mc_antenna.draw_los(
+        local_rte_los, R_prop, rng, R_ant2enu, sensor_los(0, joker));
+
+    id_mat(Q);
+    local_rte_pos = sensor_pos(0, joker);
+    I_i = 0.0;
+
+    while (keepgoing) {
+      mcPathTraceGeneral(l_ws,
+                         evol_op,
+                         abs_vec_mono,
+                         temperature,
+                         ext_mat_mono,
+                         rng,
+                         local_rte_pos,
+                         local_rte_los,
+                         pnd_vec,
+                         g,
+                         ppath_step,
+                         termination_flag,
+                         inside_cloud,
+                         l_ppath_step_agenda,
+                         ppath_lmax,
+                         ppath_lraytrace,
+                         taustep_limit,
+                         l_propmat_clearsky_agenda,
+                         stokes_dim,
+                         f_index,
+                         f_grid,
+                         p_grid,
+                         lat_grid,
+                         lon_grid,
+                         z_field,
+                         refellipsoid,
+                         z_surface,
+                         t_field,
+                         vmr_field,
+                         cloudbox_limits,
+                         pnd_field,
+                         scat_data,
+                         verbosity);
+
+      // GH 2011-09-08: if the lowest layer has large
+      // extent and a thick cloud, g may be 0 due to
+      // underflow, but then I_i should be 0 as well.
+      // Don't turn it into nan for no reason.
+      // If reaching underflow, no point in going on;
+      // hence new photon.
+      // GH 2011-09-14: moved this check to outside the different
+      // scenarios, as this goes wrong regardless of the scenario.
+      if (g == 0) {
+        keepgoing = false;
+        oksampling = false;
+#pragma omp critical(MCGeneral_fail_msg)
+        out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
+             << "happens repeatedly, try to decrease *ppath_lmax*)";
+      } else if (termination_flag == 1) {
+        iy_space_agendaExecute(l_ws,
+                               local_iy,
+                               Vector(1, f_mono),
+                               local_rte_pos,
+                               local_rte_los,
+                               l_iy_space_agenda);
+        mult(vector1, evol_op, local_iy(0, joker));
+        mult(I_i, Q, vector1);
+        I_i /= g;
+        keepgoing = false;  //stop here. New photon.
+        source_domain[0] += 1;
+      } else if (termination_flag == 2) {
+        //Calculate surface properties
+        surface_rtprop_agendaExecute(l_ws,
+                                     local_surface_skin_t,
+                                     local_surface_emission,
+                                     local_surface_los,
+                                     local_surface_rmatrix,
+                                     Vector(1, f_mono),
+                                     local_rte_pos,
+                                     local_rte_los,
+                                     l_surface_rtprop_agenda);
+
+        //if( local_surface_los.nrows() > 1 )
+        // throw runtime_error(
+        //                "The method handles only specular reflections." );
+
+        //deal with blackbody case
+        if (local_surface_los.empty()) {
+          mult(vector1, evol_op, local_surface_emission(0, joker));
           mult(I_i, Q, vector1);
           I_i /= g;
-          keepgoing = false;  //stop here. New photon.
-          mc_source_domain[0] += 1;
-        } else if (termination_flag == 2) {
-          //Calculate surface properties
-          surface_rtprop_agendaExecute(ws,
-                                       local_surface_skin_t,
-                                       local_surface_emission,
-                                       local_surface_los,
-                                       local_surface_rmatrix,
-                                       Vector(1, f_mono),
-                                       local_rte_pos,
-                                       local_rte_los,
-                                       surface_rtprop_agenda);
-
-          //if( local_surface_los.nrows() > 1 )
-          // throw runtime_error(
-          //                "The method handles only specular reflections." );
-
-          //deal with blackbody case
-          if (local_surface_los.empty()) {
+          keepgoing = false;
+          source_domain[1] += 1;
+        } else
+        //decide between reflection and emission
+        {
+          const Numeric rnd = rng.draw();
+
+          Numeric R11 = 0;
+          for (Index i = 0; i < local_surface_rmatrix.nbooks(); i++) {
+            R11 += local_surface_rmatrix(i, 0, 0, 0);
+          }
+
+          if (rnd > R11) {
+            //then we have emission
             mult(vector1, evol_op, local_surface_emission(0, joker));
             mult(I_i, Q, vector1);
-            I_i /= g;
+            I_i /= g * (1 - R11);
             keepgoing = false;
-            mc_source_domain[1] += 1;
-          } else
-          //decide between reflection and emission
-          {
-            const Numeric rnd = rng.draw();
-
-            Numeric R11 = 0;
-            for (Index i = 0; i < local_surface_rmatrix.nbooks(); i++) {
-              R11 += local_surface_rmatrix(i, 0, 0, 0);
-            }
-
-            if (rnd > R11) {
-              //then we have emission
-              mult(vector1, evol_op, local_surface_emission(0, joker));
-              mult(I_i, Q, vector1);
-              I_i /= g * (1 - R11);
-              keepgoing = false;
-              mc_source_domain[1] += 1;
-            } else {
-              //we have reflection
-              // determine which reflection los to use
-              Index i = 0;
-              Numeric rsum = local_surface_rmatrix(i, 0, 0, 0);
-              while (rsum < rnd) {
-                i++;
-                rsum += local_surface_rmatrix(i, 0, 0, 0);
-              }
-
-              local_rte_los = local_surface_los(i, joker);
-
-              mult(q, evol_op, local_surface_rmatrix(i, 0, joker, joker));
-              mult(newQ, Q, q);
-              Q = newQ;
-              Q /= g * local_surface_rmatrix(i, 0, 0, 0);
-            }
-          }
-        } else if (inside_cloud) {
-          //we have another scattering/emission point
-          //Estimate single scattering albedo
-          albedo = 1 - abs_vec_mono[0] / ext_mat_mono(0, 0);
-
-          //determine whether photon is emitted or scattered
-          if (rng.draw() > albedo) {
-            //Calculate emission
-            Numeric planck_value = planck(f_mono, temperature);
-            Vector emission = abs_vec_mono;
-            emission *= planck_value;
-            Vector emissioncontri(stokes_dim);
-            mult(emissioncontri, evol_op, emission);
-            emissioncontri /= (g * (1 - albedo));  //yuck!
-            mult(I_i, Q, emissioncontri);
-            keepgoing = false;
-            mc_source_domain[3] += 1;
+            source_domain[1] += 1;
           } else {
-            //we have a scattering event
-            Sample_los(new_rte_los,
-                       g_los_csc_theta,
-                       Z,
-                       rng,
-                       local_rte_los,
-                       scat_data,
-                       f_index,
-                       stokes_dim,
-                       pnd_vec,
-                       Z11maxvector,
-                       ext_mat_mono(0, 0) - abs_vec_mono[0],
-                       temperature,
-                       t_interp_order);
+            //we have reflection
+            // determine which reflection los to use
+            Index i = 0;
+            Numeric rsum = local_surface_rmatrix(i, 0, 0, 0);
+            while (rsum < rnd) {
+              i++;
+              rsum += local_surface_rmatrix(i, 0, 0, 0);
+            }
 
-            Z /= g * g_los_csc_theta * albedo;
+            local_rte_los = local_surface_los(i, joker);
 
-            mult(q, evol_op, Z);
+            mult(q, evol_op, local_surface_rmatrix(i, 0, joker, joker));
             mult(newQ, Q, q);
             Q = newQ;
-            scattering_order += 1;
-            local_rte_los = new_rte_los;
+            Q /= g * local_surface_rmatrix(i, 0, 0, 0);
           }
-        } else {
-          //Must be clear sky emission point
+        }
+      } else if (inside_cloud) {
+        //we have another scattering/emission point
+        //Estimate single scattering albedo
+        albedo = 1 - abs_vec_mono[0] / ext_mat_mono(0, 0);
+
+        //determine whether photon is emitted or scattered
+        if (rng.draw() > albedo) {
           //Calculate emission
           Numeric planck_value = planck(f_mono, temperature);
           Vector emission = abs_vec_mono;
           emission *= planck_value;
           Vector emissioncontri(stokes_dim);
           mult(emissioncontri, evol_op, emission);
-          emissioncontri /= g;
+          emissioncontri /= (g * (1 - albedo));  //yuck!
           mult(I_i, Q, emissioncontri);
           keepgoing = false;
-          mc_source_domain[2] += 1;
-        }
-      }  // keepgoing
-
-      if (oksampling) {
-        // Set spome of the bookkeeping variables
-        np = ppath_step.np;
-        mc_points(ppath_step.gp_p[np - 1].idx,
-                  ppath_step.gp_lat[np - 1].idx,
-                  ppath_step.gp_lon[np - 1].idx) += 1;
-        if (scattering_order < l_mc_scat_order) {
-          mc_scat_order[scattering_order] += 1;
+          source_domain[3] += 1;
+        } else {
+          //we have a scattering event
+          Sample_los(new_rte_los,
+                     g_los_csc_theta,
+                     Z,
+                     rng,
+                     local_rte_los,
+                     scat_data,
+                     f_index,
+                     stokes_dim,
+                     pnd_vec,
+                     Z11maxvector,
+                     ext_mat_mono(0, 0) - abs_vec_mono[0],
+                     temperature,
+                     t_interp_order);
+
+          Z /= g * g_los_csc_theta * albedo;
+
+          mult(q, evol_op, Z);
+          mult(newQ, Q, q);
+          Q = newQ;
+          scattering_order += 1;
+          local_rte_los = new_rte_los;
         }
+      } else {
+        //Must be clear sky emission point
+        //Calculate emission
+        Numeric planck_value = planck(f_mono, temperature);
+        Vector emission = abs_vec_mono;
+        emission *= planck_value;
+        Vector emissioncontri(stokes_dim);
+        mult(emissioncontri, evol_op, emission);
+        emissioncontri /= g;
+        mult(I_i, Q, emissioncontri);
+        keepgoing = false;
+        source_domain[2] += 1;
+      }
+    }  // keepgoing
+
+    return oksampling;
+  };
+
+  // Adds an accepted photon to the bookkeeping variables
+  auto count_photon = [&](Tensor3& points,
+                          ArrayOfIndex& scat_order,
+                          Vector& Isum,
+                          Vector& Isquaredsum,
+                          const Vector& I_i,
+                          const Index scattering_order,
+                          const Ppath& ppath_step) {
+    const Index np = ppath_step.np;
+    points(ppath_step.gp_p[np - 1].idx,
+           ppath_step.gp_lat[np - 1].idx,
+           ppath_step.gp_lon[np - 1].idx) += 1;
+    if (scattering_order < l_mc_scat_order) {
+      scat_order[scattering_order] += 1;
+    }
 
-        // Rotate into antenna polarization frame
-        Vector I_hold(stokes_dim);
-        mult(I_hold, R_stokes, I_i);
-        Isum += I_i;
+    Isum += I_i;
+    for (Index j = 0; j < stokes_dim; j++) {
+      assert(!std::isnan(I_i[j]));
+      Isquaredsum[j] += I_i[j] * I_i[j];
+    }
+  };
 
-        for (Index j = 0; j < stokes_dim; j++) {
-          assert(!std::isnan(I_i[j]));
-          Isquaredsum[j] += I_i[j] * I_i[j];
-        }
-        y = Isum;
-        y /= (Numeric)mc_iteration_count;
-        for (Index j = 0; j < stokes_dim; j++) {
-          mc_error[j] = sqrt(
-              (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
-              (Numeric)mc_iteration_count);
-        }
-        if (std_err > 0 && mc_iteration_count >= min_iter &&
-            mc_error[0] < std_err_i) {
-          break;
+  // Sets y and mc_error from the accumulated sums
+  auto set_y_and_error = [&](const Vector& Isum, const Vector& Isquaredsum) {
+    y = Isum;
+    y /= (Numeric)mc_iteration_count;
+    for (Index j = 0; j < stokes_dim; j++) {
+      mc_error[j] = sqrt(
+          (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
+          (Numeric)mc_iteration_count);
+    }
+  };
+
+  // Checks the termination criteria
+  auto converged = [&]() {
+    return (std_err > 0 && mc_iteration_count >= min_iter &&
+            mc_error[0] < std_err_i) ||
+           (max_time > 0 && (Index)(time(NULL) - start_time) >= max_time) ||
+           (max_iter > 0 && mc_iteration_count >= max_iter);
+  };
+
+  const String too_many_fails =
+      "The MC path sampling has failed five times. A few failures "
+      "should be OK, but this number is suspiciously high and the "
+      "reason to these failures should be tracked down.";
+
+  Vector I_i(stokes_dim);
+  Vector Isum(stokes_dim, 0.0), Isquaredsum(stokes_dim, 0.0);
+  Ppath ppath_step;
+
+  if (nthreads == 1) {
+    Rng rng;  //Random Number generator
+    rng.seed(mc_seed, verbosity);
+
+    //Begin Main Loop
+    //
+    Index nfails = 0;
+    //
+    while (true) {
+      // Complete content of while inside try/catch to handle occasional
+      // failures in the ppath calculations
+      try {
+        mc_iteration_count += 1;
+        Index scattering_order;
+
+        if (trace_photon(ws,
+                         rng,
+                         ppath_step_agenda,
+                         iy_space_agenda,
+                         surface_rtprop_agenda,
+                         propmat_clearsky_agenda,
+                         I_i,
+                         scattering_order,
+                         mc_source_domain,
+                         ppath_step)) {
+          count_photon(mc_points,
+                       mc_scat_order,
+                       Isum,
+                       Isquaredsum,
+                       I_i,
+                       scattering_order,
+                       ppath_step);
+          set_y_and_error(Isum, Isquaredsum);
+          if (converged()) break;
+        } else {
+          mc_iteration_count -= 1;
         }
-        if (max_time > 0 && (Index)(time(NULL) - start_time) >= max_time) {
-          break;
+      }  // Try
+
+      catch (const std::runtime_error& e) {
+        mc_iteration_count += 1;
+        nfails += 1;
+        out0 << "WARNING: A MC path sampling failed! Error was:\n";
+        cout << e.what() << endl;
+        if (nfails >= 5) {
+          throw runtime_error(too_many_fails);
         }
-        if (max_iter > 0 && mc_iteration_count >= max_iter) {
-          break;
+      }
+    }  // while
+  } else {
+    // Each of nthreads streams traces its own share of every round of
+    // photons, with its own random number stream and workspace. The
+    // per-stream sums are merged in stream order after each round, where the
+    // termination criteria are checked, so the result only depends on
+    // mc_seed and nthreads, and not on the number of threads OpenMP grants.
+    const Index nt = nthreads ? nthreads : arts_omp_get_max_threads();
+    const Index photons_per_round = max(min_iter, nt);
+
+    ArrayOfVector t_Isum(nt, Vector(stokes_dim, 0.0));
+    ArrayOfVector t_Isquaredsum(nt, Vector(stokes_dim, 0.0));
+    ArrayOfTensor3 t_points(
+        nt, Tensor3(p_grid.nelem(), lat_grid.nelem(), lon_grid.nelem(), 0));
+    ArrayOfArrayOfIndex t_scat_order(nt, ArrayOfIndex(l_mc_scat_order, 0));
+    ArrayOfArrayOfIndex t_source_domain(nt, ArrayOfIndex(4, 0));
+    ArrayOfIndex t_count(nt, 0), t_fails(nt, 0), t_ntrace(nt, 0);
+    std::vector<Rng> rngs(nt);
+    for (Index it = 0; it < nt; it++)
+      rngs[it].force_seed(mc_thread_seed(mc_seed, it));
+
+    // Splits the next round evenly over the streams, without passing max_iter
+    auto plan_round = [&]() {
+      Index nround = photons_per_round;
+      if (max_iter > 0) nround = min(nround, max_iter - mc_iteration_count);
+      for (Index it = 0; it < nt; it++)
+        t_ntrace[it] = nround / nt + (it < nround % nt ? 1 : 0);
+    };
+    plan_round();
+
+    // Workspaces and agendas of the streams. Streams are not tied to
+    // threads, so that OpenMP may run them on fewer threads than nt
+    std::vector<Workspace> l_ws(nt, ws);
+    std::vector<Agenda> l_ppath_step_agenda(nt, ppath_step_agenda);
+    std::vector<Agenda> l_iy_space_agenda(nt, iy_space_agenda);
+    std::vector<Agenda> l_surface_rtprop_agenda(nt, surface_rtprop_agenda);
+    std::vector<Agenda> l_propmat_clearsky_agenda(nt, propmat_clearsky_agenda);
+    bool done = false;
+    bool failed = false;
+
+    while (not done) {
+#pragma omp parallel for schedule(static, 1) num_threads(nt) \
+    if (!arts_omp_in_parallel()) \
+    firstprivate(I_i, ppath_step)
+      for (Index it = 0; it < nt; it++) {
+        for (Index i = 0; i < t_ntrace[it]; i++) {
+          try {
+            t_count[it] += 1;
+            Index scattering_order;
+
+            if (trace_photon(l_ws[it],
+                             rngs[it],
+                             l_ppath_step_agenda[it],
+                             l_iy_space_agenda[it],
+                             l_surface_rtprop_agenda[it],
+                             l_propmat_clearsky_agenda[it],
+                             I_i,
+                             scattering_order,
+                             t_source_domain[it],
+                             ppath_step)) {
+              count_photon(t_points[it],
+                           t_scat_order[it],
+                           t_Isum[it],
+                           t_Isquaredsum[it],
+                           I_i,
+                           scattering_order,
+                           ppath_step);
+            } else {
+              t_count[it] -= 1;
+            }
+          } catch (const std::runtime_error& e) {
+            t_fails[it] += 1;
+#pragma omp critical(MCGeneral_fail_msg)
+            {
+              out0 << "WARNING: A MC path sampling failed! Error was:\n";
+              cout << e.what() << endl;
+            }
+          }
         }
       }
-    }  // Try
 
-    catch (const std::runtime_error& e) {
-      mc_iteration_count += 1;
-      nfails += 1;
-      out0 << "WARNING: A MC path sampling failed! Error was:\n";
-      cout << e.what() << endl;
+      // Merge in stream order
+      mc_iteration_count = 0;
+      Index nfails = 0;
+      Isum = 0.0;
+      Isquaredsum = 0.0;
+      for (Index jt = 0; jt < nt; jt++) {
+        mc_iteration_count += t_count[jt] + t_fails[jt];
+        nfails += t_fails[jt];
+        Isum += t_Isum[jt];
+        Isquaredsum += t_Isquaredsum[jt];
+      }
+
       if (nfails >= 5) {
-        throw runtime_error(
-            "The MC path sampling has failed five times. A few failures "
-            "should be OK, but this number is suspiciously high and the "
-            "reason to these failures should be tracked down.");
+        failed = true;
+        done = true;
+      } else if (mc_iteration_count) {
+        set_y_and_error(Isum, Isquaredsum);
+        done = converged();
       }
+
+      plan_round();
     }
-  }  // while
+
+    if (failed) throw runtime_error(too_many_fails);
+
+    for (Index it = 0; it < nt; it++) {
+      mc_points += t_points[it];
+      for (Index j = 0; j < l_mc_scat_order; j++)
+        mc_scat_order[j] += t_scat_order[it][j];
+      for (Index j = 0; j < 4; j++)
+        mc_source_domain[j] += t_source_domain[it][j];
+    }
+  }
 
   if (convert_to_rjbt) {
     for (Index j = 0; j < stokes_dim; j++) {
@@ -587,6 +763,7 @@ void MCRadar(  // Workspace reference:
     const Numeric& ze_tref,
     const Numeric& k2,
     const Index& t_interp_order,
+    const Index& nthreads,
     // Verbosity object:
     const Verbosity& verbosity) {
   CREATE_OUT0;
@@ -669,43 +846,15 @@ void MCRadar(  // Workspace reference:
         "Gaussian antenna patterns.");
   }
 
-  Ppath ppath_step;
-  Rng rng;                          //Random Number generator
+  if (nthreads < 0) throw runtime_error("*nthreads* must be >= 0.");
+
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
-  Vector pnd_vec(
-      N_se);  //Vector of particle number densities used at each point
   bool anyptype_nonTotRan = is_anyptype_nonTotRan(scat_data);
   bool is_dist = max(range_bins) > 1;  // Is it round trip time or distance
-  rng.seed(mc_seed, verbosity);
-  Numeric ppath_lraytrace_var;
-  //Numeric temperature, albedo;
-  Numeric albedo;
-  Numeric Csca, Cext;
-  Numeric antenna_wgt;
-  Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
-  Matrix trans_mat(stokes_dim, stokes_dim);
-  Matrix Z(stokes_dim, stokes_dim);
-  Matrix R_ant2enu(3, 3), R_enu2ant(3, 3), R_stokes(stokes_dim, stokes_dim);
-  Vector abs_vec_mono(stokes_dim), I_i(stokes_dim), I_i_rot(stokes_dim);
+  Matrix R_ant2enu(3, 3), R_enu2ant(3, 3);
   Vector Isum(nbins * stokes_dim), Isquaredsum(nbins * stokes_dim);
-  Index termination_flag = 0;
   Vector bin_height(nbins);
   Vector range_bin_count(nbins);
-  Index mc_iter;
-  Index scat_order;
-
-  // allocating variables needed for pha_mat extraction (don't want to do this
-  // in every loop step again).
-  ArrayOfArrayOfTensor6 pha_mat_Nse;
-  ArrayOfArrayOfIndex ptypes_Nse;
-  Matrix t_ok;
-  ArrayOfTensor6 pha_mat_ssbulk;
-  ArrayOfIndex ptype_ssbulk;
-  Tensor6 pha_mat_bulk;
-  Index ptype_bulk;
-  Matrix pdir_array(1, 2), idir_array(1, 2);
-  Vector t_array(1);
-  Matrix pnds(N_se, 1);
 
   // for pha_mat handling, at the moment we still need scat_data_mono. Hence,
   // extract that here (but in its local container, not into the WSV
@@ -729,23 +878,11 @@ void MCRadar(  // Workspace reference:
 
   range_bin_count = 0;
 
-  mc_iter = 0;
   // this will need to be reshaped differently for range gates
   mc_error.resize(stokes_dim * nbins);
 
-  //local versions of workspace
-  Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
-  Matrix local_surface_los;
-  Tensor4 local_surface_rmatrix;
-  Vector local_rte_pos(3);
-  Vector local_rte_los(2);
-  Vector new_rte_los(2);
-  Vector Ipath(stokes_dim), Ihold(stokes_dim), Ipath_norm(stokes_dim);
   Isum = 0.0;
   Isquaredsum = 0.0;
-  Numeric s_tot, s_return;  // photon distance traveled
-  Numeric t_tot, t_return;  // photon time traveled
-  Numeric r_trav, r_bin;  // range traveled (1-way distance) or round-trip time
 
   Numeric fac;
   if (iy_unit == "1") {
@@ -768,16 +905,56 @@ void MCRadar(  // Workspace reference:
   rotmat_enu(R_ant2enu, sensor_los(0, joker));
   R_enu2ant = transpose(R_ant2enu);
 
-  //Begin Main Loop
-  bool keepgoing, firstpass, integrity;
-  while (mc_iter < mc_max_iter) {
-    bool inside_cloud;
-
-    mc_iter += 1;
+  // Traces a single photon, adding its returns to the range bin sums
+  auto trace_photon = [&](Workspace& l_ws,
+                          Rng& rng,
+                          const Agenda& l_ppath_step_agenda,
+                          const Agenda& l_propmat_clearsky_agenda,
+                          Vector& l_Isum,
+                          Vector& l_Isquaredsum,
+                          Vector& l_range_bin_count) {
+    Ppath ppath_step;
+    Vector pnd_vec(
+        N_se);  //Vector of particle number densities used at each point
+    Numeric ppath_lraytrace_var;
+    //Numeric temperature, albedo;
+    Numeric albedo;
+    Numeric Csca, Cext;
+    Numeric antenna_wgt;
+    Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
+    Matrix trans_mat(stokes_dim, stokes_dim);
+    Matrix Z(stokes_dim, stokes_dim);
+    Matrix R_stokes(stokes_dim, stokes_dim);
+    Vector abs_vec_mono(stokes_dim), I_i(stokes_dim), I_i_rot(stokes_dim);
+    Index termination_flag = 0;
+    Index scat_order;
+
+    // allocating variables needed for pha_mat extraction (don't want to do this
+    // in every loop step again).
+    ArrayOfArrayOfTensor6 pha_mat_Nse;
+    ArrayOfArrayOfIndex ptypes_Nse;
+    Matrix t_ok;
+    ArrayOfTensor6 pha_mat_ssbulk;
+    ArrayOfIndex ptype_ssbulk;
+    Tensor6 pha_mat_bulk;
+    Index ptype_bulk;
+    Matrix pdir_array(1, 2), idir_array(1, 2);
+    Vector t_array(1);
+    Matrix pnds(N_se, 1);
+
+    //local versions of workspace
+    Vector local_rte_pos(3);
+    Vector local_rte_los(2);
+    Vector new_rte_los(2);
+    Vector Ipath(stokes_dim), Ihold(stokes_dim);
+    Numeric s_tot, s_return;  // photon distance traveled
+    Numeric t_tot, t_return;  // photon time traveled
+    Numeric r_trav, r_bin;  // range traveled (1-way distance) or round-trip time
 
-    integrity = true;  // intensity is not nan or below threshold
-    keepgoing = true;  // indicating whether to continue tracing a photon
-    firstpass = true;  // ensure backscatter is properly calculated
+    bool inside_cloud;
+    bool integrity = true;  // intensity is not nan or below threshold
+    bool keepgoing = true;  // indicating whether to continue tracing a photon
+    bool firstpass = true;  // ensure backscatter is properly calculated
 
     //Sample a FOV direction
     Matrix R_tx(3, 3);
@@ -794,7 +971,7 @@ void MCRadar(  // Workspace reference:
     while (keepgoing) {
       Numeric s_path, t_path;
 
-      mcPathTraceRadar(ws,
+      mcPathTraceRadar(l_ws,
                        evol_op,
                        abs_vec_mono,
                        t_array[0],
@@ -808,10 +985,10 @@ void MCRadar(  // Workspace reference:
                        ppath_step,
                        termination_flag,
                        inside_cloud,
-                       ppath_step_agenda,
+                       l_ppath_step_agenda,
                        ppath_lmax,
                        ppath_lraytrace,
-                       propmat_clearsky_agenda,
+                       l_propmat_clearsky_agenda,
                        anyptype_nonTotRan,
                        stokes_dim,
                        f_index,
@@ -897,11 +1074,11 @@ void MCRadar(  // Workspace reference:
                                             local_rte_pos,
                                             verbosity);
 
-        ppathFromRtePos2(ws,
+        ppathFromRtePos2(l_ws,
                          ppath,
                          rte_los_antenna,
                          ppath_lraytrace_var,
-                         ppath_step_agenda,
+                         l_ppath_step_agenda,
                          atmosphere_dim,
                          p_grid,
                          lat_grid,
@@ -942,10 +1119,10 @@ void MCRadar(  // Workspace reference:
         // Still within max range of radar?
         if (r_trav <= r_max) {
           // Compute path extinction as with radio link
-          get_ppath_transmat(ws,
+          get_ppath_transmat(l_ws,
                              trans_mat,
                              ppath,
-                             propmat_clearsky_agenda,
+                             l_propmat_clearsky_agenda,
                              stokes_dim,
                              f_index,
                              f_grid,
@@ -1019,11 +1196,11 @@ void MCRadar(  // Workspace reference:
             for (Index istokes = 0; istokes < stokes_dim; istokes++) {
               Index ibiny = ibin * stokes_dim + istokes;
               assert(!std::isnan(I_i_rot[istokes]));
-              Isum[ibiny] += antenna_wgt * I_i_rot[istokes];
-              Isquaredsum[ibiny] += antenna_wgt * antenna_wgt *
-                                    I_i_rot[istokes] * I_i_rot[istokes];
+              l_Isum[ibiny] += antenna_wgt * I_i_rot[istokes];
+              l_Isquaredsum[ibiny] += antenna_wgt * antenna_wgt *
+                                      I_i_rot[istokes] * I_i_rot[istokes];
             }
-            range_bin_count[ibin] += 1;
+            l_range_bin_count[ibin] += 1;
           }
 
           scat_order++;
@@ -1071,8 +1248,81 @@ void MCRadar(  // Workspace reference:
       if (scat_order >= mc_max_scatorder) keepgoing = false;
       if (!integrity) keepgoing = false;
     }  // while (inner: keepgoing)
+  };
+
+  if (nthreads == 1) {
+    Rng rng;  //Random Number generator
+    rng.seed(mc_seed, verbosity);
+
+    //Begin Main Loop
+    for (Index mc_iter = 0; mc_iter < mc_max_iter; mc_iter++) {
+      trace_photon(ws,
+                   rng,
+                   ppath_step_agenda,
+                   propmat_clearsky_agenda,
+                   Isum,
+                   Isquaredsum,
+                   range_bin_count);
+    }
+  } else {
+    // Each thread traces a fixed share of the photons, with its own random
+    // number stream and workspace. The per-thread sums are merged in thread
+    // order, so the result only depends on mc_seed and nthreads.
+    const Index nt = nthreads ? nthreads : arts_omp_get_max_threads();
+
+    ArrayOfVector t_Isum(nt, Vector(nbins * stokes_dim, 0.0));
+    ArrayOfVector t_Isquaredsum(nt, Vector(nbins * stokes_dim, 0.0));
+    ArrayOfVector t_range_bin_count(nt, Vector(nbins, 0.0));
+    ArrayOfString fail_msg;
+    bool do_abort = false;
+
+    Workspace l_ws(ws);
+    Agenda l_ppath_step_agenda(ppath_step_agenda);
+    Agenda l_propmat_clearsky_agenda(propmat_clearsky_agenda);
+
+#pragma omp parallel for schedule(static, 1) num_threads(nt) \
+    if (!arts_omp_in_parallel()) \
+    firstprivate(l_ws, l_ppath_step_agenda, l_propmat_clearsky_agenda)
+    for (Index it = 0; it < nt; it++) {
+      if (do_abort) continue;
+      try {
+        Rng rng;
+        rng.force_seed(mc_thread_seed(mc_seed, it));
+
+        const Index ntrace = mc_max_iter / nt + (it < mc_max_iter % nt ? 1 : 0);
+        for (Index mc_iter = 0; mc_iter < ntrace; mc_iter++) {
+          trace_photon(l_ws,
+                       rng,
+                       l_ppath_step_agenda,
+                       l_propmat_clearsky_agenda,
+                       t_Isum[it],
+                       t_Isquaredsum[it],
+                       t_range_bin_count[it]);
+        }
+      } catch (const std::runtime_error& e) {
+#pragma omp critical(MCRadar_fail_msg)
+        {
+          do_abort = true;
+          fail_msg.push_back(e.what());
+        }
+      }
+    }
+
+    if (do_abort) {
+      ostringstream os;
+      os << "Error messages from failed photon tracing:\n";
+      for (const auto& msg : fail_msg) os << msg << '\n';
+      throw runtime_error(os.str());
+    }
+
+    for (Index it = 0; it < nt; it++) {
+      Isum += t_Isum[it];
+      Isquaredsum += t_Isquaredsum[it];
+      range_bin_count += t_range_bin_count[it];
+    }
+  }
 
-  }  // while (outer)
+  const Index mc_iter = mc_max_iter;
 
   // Normalize range bins and apply sensor response (polarization)
   for (Index ibin = 0; ibin < nbins; ibin++) {
@@ -189,6 +189,9 @@ void geo_posWherePpathPassesZref(Vector& geo_pos,
   out2 << "  Sets geo-position to:\n" << geo_pos;
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppathCacheClear(const Verbosity&) { ppath_cache_clear(); }
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ppathCalc(Workspace& ws,
                Ppath& ppath,
@@ -1553,6 +1556,47 @@ void ppathStepByStep(Workspace& ws,
              verbosity);
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppathStepByStepCached(Workspace& ws,
+                           Ppath& ppath,
+                           const Agenda& ppath_step_agenda,
+                           const Index& ppath_inside_cloudbox_do,
+                           const Index& atmosphere_dim,
+                           const Vector& p_grid,
+                           const Vector& lat_grid,
+                           const Vector& lon_grid,
+                           const Tensor3& z_field,
+                           const Vector& f_grid,
+                           const Vector& refellipsoid,
+                           const Matrix& z_surface,
+                           const Index& cloudbox_on,
+                           const ArrayOfIndex& cloudbox_limits,
+                           const Vector& rte_pos,
+                           const Vector& rte_los,
+                           const Numeric& ppath_lmax,
+                           const Numeric& ppath_lraytrace,
+                           const Verbosity& verbosity) {
+  ppath_calc_cached(ws,
+                    ppath,
+                    ppath_step_agenda,
+                    atmosphere_dim,
+                    p_grid,
+                    lat_grid,
+                    lon_grid,
+                    z_field,
+                    f_grid,
+                    refellipsoid,
+                    z_surface,
+                    cloudbox_on,
+                    cloudbox_limits,
+                    rte_pos,
+                    rte_los,
+                    ppath_lmax,
+                    ppath_lraytrace,
+                    ppath_inside_cloudbox_do,
+                    verbosity);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ppathWriteXMLPartial(  //WS Input:
     const String& file_format,
@@ -1799,25 +1843,31 @@ void ppath_stepGeometric(  // WS Output:
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
-void ppath_stepRefractionBasic(Workspace& ws,
-                               Ppath& ppath_step,
-                               const Agenda& refr_index_air_agenda,
-                               const Index& atmosphere_dim,
-                               const Vector& p_grid,
-                               const Vector& lat_grid,
-                               const Vector& lon_grid,
-                               const Tensor3& z_field,
-                               const Tensor3& t_field,
-                               const Tensor4& vmr_field,
-                               const Vector& refellipsoid,
-                               const Matrix& z_surface,
-                               const Vector& f_grid,
-                               const Numeric& ppath_lmax,
-                               const Numeric& ppath_lraytrace,
-                               const Verbosity&) {
+void ppath_stepRefractionAdaptive(Workspace& ws,
+                                  Ppath& ppath_step,
+                                  const Agenda& refr_index_air_agenda,
+                                  const Index& atmosphere_dim,
+                                  const Vector& p_grid,
+                                  const Vector& lat_grid,
+                                  const Vector& lon_grid,
+                                  const Tensor3& z_field,
+                                  const Tensor3& t_field,
+                                  const Tensor4& vmr_field,
+                                  const Vector& refellipsoid,
+                                  const Matrix& z_surface,
+                                  const Vector& f_grid,
+                                  const Numeric& ppath_lmax,
+                                  const Numeric& ppath_lraytrace,
+                                  const Numeric& za_tolerance,
+                                  const Numeric& lraytrace_max,
+                                  const Verbosity&) {
   // Input checks here would be rather costly as this function is called
   // many times.
   assert(ppath_lraytrace > 0);
+  if (za_tolerance < 0 || lraytrace_max < ppath_lraytrace)
+    throw runtime_error(
+        "*za_tolerance* must be >= 0 and *lraytrace_max* must not be "
+        "smaller than *ppath_lraytrace*.");
 
   // A call with background set, just wants to obtain the refractive index for
   // complete ppaths consistent of a single point.
@@ -1835,7 +1885,9 @@ void ppath_stepRefractionBasic(Workspace& ws,
                          ppath_lmax,
                          refr_index_air_agenda,
                          "linear_basic",
-                         ppath_lraytrace);
+                         ppath_lraytrace,
+                         za_tolerance,
+                         lraytrace_max);
     } else if (atmosphere_dim == 2) {
       ppath_step_refr_2d(ws,
                          ppath_step,
@@ -1850,7 +1902,9 @@ void ppath_stepRefractionBasic(Workspace& ws,
                          ppath_lmax,
                          refr_index_air_agenda,
                          "linear_basic",
-                         ppath_lraytrace);
+                         ppath_lraytrace,
+                         za_tolerance,
+                         lraytrace_max);
     } else if (atmosphere_dim == 3) {
       ppath_step_refr_3d(ws,
                          ppath_step,
@@ -1866,7 +1920,9 @@ void ppath_stepRefractionBasic(Workspace& ws,
                          ppath_lmax,
                          refr_index_air_agenda,
                          "linear_basic",
-                         ppath_lraytrace);
+                         ppath_lraytrace,
+                         za_tolerance,
+                         lraytrace_max);
     } else {
       throw runtime_error("The atmospheric dimensionality must be 1-3.");
     }
@@ -1920,6 +1976,43 @@ void ppath_stepRefractionBasic(Workspace& ws,
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppath_stepRefractionBasic(Workspace& ws,
+                               Ppath& ppath_step,
+                               const Agenda& refr_index_air_agenda,
+                               const Index& atmosphere_dim,
+                               const Vector& p_grid,
+                               const Vector& lat_grid,
+                               const Vector& lon_grid,
+                               const Tensor3& z_field,
+                               const Tensor3& t_field,
+                               const Tensor4& vmr_field,
+                               const Vector& refellipsoid,
+                               const Matrix& z_surface,
+                               const Vector& f_grid,
+                               const Numeric& ppath_lmax,
+                               const Numeric& ppath_lraytrace,
+                               const Verbosity& verbosity) {
+  ppath_stepRefractionAdaptive(ws,
+                               ppath_step,
+                               refr_index_air_agenda,
+                               atmosphere_dim,
+                               p_grid,
+                               lat_grid,
+                               lon_grid,
+                               z_field,
+                               t_field,
+                               vmr_field,
+                               refellipsoid,
+                               z_surface,
+                               f_grid,
+                               ppath_lmax,
+                               ppath_lraytrace,
+                               0,
+                               ppath_lraytrace,
+                               verbosity);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void rte_losSet(Vector& rte_los,
                 const Index& atmosphere_dim,
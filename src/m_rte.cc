@@ -39,6 +39,7 @@
 #include "jacobian.h"
 #include "logic.h"
 #include "math_funcs.h"
+#include "matpack_pool.h"
 #include "messages.h"
 #include "montecarlo.h"
 #include "physics_funcs.h"
@@ -213,6 +214,10 @@ void iyEmissionStandard(
     const Numeric& rte_alonglos_v,
     const Tensor3& surface_props_data,
     const Verbosity& verbosity) {
+  // Recycle the storage of the many short-lived temporaries created for
+  // each ppath point
+  MatpackScratchScope matpack_scratch;
+
   //  Init Jacobian quantities?
   const Index j_analytical_do = jacobian_do ? do_analytical_jacobian<2>(jacobian_quantities) : 0;
   
@@ -355,78 +360,101 @@ void iyEmissionStandard(
     const bool temperature_jacobian =
         j_analytical_do and do_temperature_jacobian(jacobian_quantities);
 
-    Agenda l_propmat_clearsky_agenda(propmat_clearsky_agenda);
-    Workspace l_ws(ws);
+    // If the agenda takes the absorption from the lookup table, extract it
+    // for all ppath points at once. This needs the same frequency grid at
+    // all points, i.e. no Doppler shifts.
+    std::unique_ptr<GasAbsLookupPrefetch> lookup_prefetch;
+    bool same_f = true;
+    for (Index ip = 1; same_f && ip < np; ip++)
+      for (Index iv = 0; same_f && iv < nf; iv++)
+        same_f = ppvar_f(iv, ip) == ppvar_f(iv, 0);
+    if (same_f)
+      lookup_prefetch = abs_lookup_prefetch(ws,
+                                            propmat_clearsky_agenda,
+                                            jacobian_quantities,
+                                            ppvar_f(joker, 0),
+                                            ppvar_p,
+                                            ppvar_t,
+                                            ppvar_vmr);
+
+    ThreadWorkspaces thread_ws(ws, np);
     ArrayOfString fail_msg;
     bool do_abort = false;
 
-    // Loop ppath points and determine radiative properties
-#pragma omp parallel for if (!arts_omp_in_parallel()) \
-    firstprivate(l_ws, l_propmat_clearsky_agenda, a, B, dB_dT, S, da_dx, dS_dx)
-    for (Index ip = 0; ip < np; ip++) {
-      if (do_abort) continue;
-      try {
-        get_stepwise_blackbody_radiation(
-            B, dB_dT, ppvar_f(joker, ip), ppvar_t[ip], temperature_jacobian);
-
-        get_stepwise_clearsky_propmat(l_ws,
-                                      K[ip],
-                                      S,
-                                      lte[ip],
-                                      dK_dx[ip],
-                                      dS_dx,
-                                      l_propmat_clearsky_agenda,
-                                      jacobian_quantities,
-                                      ppvar_f(joker, ip),
-                                      ppvar_mag(joker, ip),
-                                      ppath.los(ip, joker),
-                                      ppvar_nlte[ip],
-                                      ppvar_vmr(joker, ip),
-                                      ppvar_t[ip],
-                                      ppvar_p[ip],
-                                      jac_species_i,
-                                      j_analytical_do);
-
-        if (j_analytical_do)
-          adapt_stepwise_partial_derivatives(dK_dx[ip],
-                                             dS_dx,
-                                             jacobian_quantities,
-                                             ppvar_f(joker, ip),
-                                             ppath.los(ip, joker),
-                                             ppvar_vmr(joker, ip),
-                                             ppvar_t[ip],
-                                             ppvar_p[ip],
-                                             jac_species_i,
-                                             lte[ip],
-                                             atmosphere_dim,
-                                             j_analytical_do);
-
-        // Here absorption equals extinction
-        a = K[ip];
-        if (j_analytical_do)
-          FOR_ANALYTICAL_JACOBIANS_DO(da_dx[iq] = dK_dx[ip][iq];);
-
-        stepwise_source(src_rad[ip],
-                        dsrc_rad[ip],
-                        K[ip],
-                        a,
-                        S,
-                        dK_dx[ip],
-                        da_dx,
-                        dS_dx,
-                        B,
-                        dB_dT,
-                        jacobian_quantities,
-                        jacobian_do);
-      } catch (const std::runtime_error& e) {
-        ostringstream os;
-        os << "Runtime-error in source calculation at index " << ip
-           << ": \n";
-        os << e.what();
+    // Loop ppath points and determine radiative properties. Each thread
+    // recycles the storage of its own temporaries.
+#pragma omp parallel if (thread_ws.parallel()) \
+    num_threads(thread_ws.nthreads()) \
+    firstprivate(a, B, dB_dT, S, da_dx, dS_dx)
+    {
+      MatpackScratchScope thread_scratch;
+
+#pragma omp for
+      for (Index ip = 0; ip < np; ip++) {
+        if (do_abort) continue;
+        try {
+          get_stepwise_blackbody_radiation(
+              B, dB_dT, ppvar_f(joker, ip), ppvar_t[ip], temperature_jacobian);
+
+          get_stepwise_clearsky_propmat(thread_ws.get(),
+                                        K[ip],
+                                        S,
+                                        lte[ip],
+                                        dK_dx[ip],
+                                        dS_dx,
+                                        propmat_clearsky_agenda,
+                                        jacobian_quantities,
+                                        ppvar_f(joker, ip),
+                                        ppvar_mag(joker, ip),
+                                        ppath.los(ip, joker),
+                                        ppvar_nlte[ip],
+                                        ppvar_vmr(joker, ip),
+                                        ppvar_t[ip],
+                                        ppvar_p[ip],
+                                        jac_species_i,
+                                        j_analytical_do);
+
+          if (j_analytical_do)
+            adapt_stepwise_partial_derivatives(dK_dx[ip],
+                                               dS_dx,
+                                               jacobian_quantities,
+                                               ppvar_f(joker, ip),
+                                               ppath.los(ip, joker),
+                                               ppvar_vmr(joker, ip),
+                                               ppvar_t[ip],
+                                               ppvar_p[ip],
+                                               jac_species_i,
+                                               lte[ip],
+                                               atmosphere_dim,
+                                               j_analytical_do);
+
+          // Here absorption equals extinction
+          a = K[ip];
+          if (j_analytical_do)
+            FOR_ANALYTICAL_JACOBIANS_DO(da_dx[iq] = dK_dx[ip][iq];);
+
+          stepwise_source(src_rad[ip],
+                          dsrc_rad[ip],
+                          K[ip],
+                          a,
+                          S,
+                          dK_dx[ip],
+                          da_dx,
+                          dS_dx,
+                          B,
+                          dB_dT,
+                          jacobian_quantities,
+                          jacobian_do);
+        } catch (const std::runtime_error& e) {
+          ostringstream os;
+          os << "Runtime-error in source calculation at index " << ip
+             << ": \n";
+          os << e.what();
 #pragma omp critical(iyEmissionStandard_source)
-        {
-          do_abort = true;
-          fail_msg.push_back(os.str());
+          {
+            do_abort = true;
+            fail_msg.push_back(os.str());
+          }
         }
       }
     }
@@ -1304,6 +1332,7 @@ void iyMC(Workspace& ws,
                   mc_taustep_limit,
                   1,
                   t_interp_order,
+                  1,
                   verbosity);
 
         assert(y.nelem() == stokes_dim);
@@ -1407,6 +1436,7 @@ void yCalc(Workspace& ws,
            const Index& jacobian_do,
            const ArrayOfRetrievalQuantity& jacobian_quantities,
            const ArrayOfString& iy_aux_vars,
+           const Index& f_chunk_size,
            const Verbosity& verbosity) {
   CREATE_OUT3;
 
@@ -1443,6 +1473,8 @@ void yCalc(Workspace& ws,
     throw runtime_error(
         "The sensor variables must be flagged to have\n"
         "passed a consistency check (sensor_checked=1).");
+  if (f_chunk_size < 0)
+    throw runtime_error("*f_chunk_size* must be >= 0.");
 
   // Some sizes
   const Index nf = f_grid.nelem();
@@ -1493,19 +1525,147 @@ void yCalc(Workspace& ws,
   String fail_msg;
   bool failed = false;
 
-  if (nmblock >= arts_omp_get_max_threads() ||
-      (nf <= nmblock && nmblock >= nlos)) {
+  // Frequency chunks are only used when there are too few measurement
+  // blocks and LOS to keep all threads busy. Scattering solvers work on
+  // the complete f_grid and are not split.
+  const bool use_chunks = f_chunk_size > 0 && f_chunk_size < nf &&
+                          !cloudbox_on &&
+                          nmblock * nlos < arts_omp_get_max_threads();
+  const bool mblock_parallel = nmblock >= arts_omp_get_max_threads() ||
+                               (nf <= nmblock && nmblock >= nlos);
+
+  // jacobianCalcPointingZaRecalc reruns the forward model inside
+  // jacobian_agenda, once per mblock. When the mblocks are not handled in
+  // parallel, these reruns are made concurrently by first calculating all
+  // iyb and then applying the sensor and jacobian_agenda in parallel over
+  // the mblocks. This is not a general perturbation engine: the pointing
+  // is the only retrieval quantity with a rerun here, the reruns are only
+  // parallel across mblocks, and a single mblock reruns as an ordinary
+  // iyb_calc. Perturbed atmospheric states are run in parallel by
+  // ybatchCalc, see jacobianFromYbatch.
+  bool pointing_recalc = false;
+  if (jacobian_do && nmblock > 1 && !mblock_parallel)
+    for (const auto& jq : jacobian_quantities)
+      if (jq == Jacobian::Sensor::PointingZenithRecalc)
+        pointing_recalc = true;
+
+  if (use_chunks || pointing_recalc) {
+    ArrayOfVector iyb;
+    ArrayOfArrayOfMatrix diyb_dx;
+    ArrayOfMatrix geo_pos_matrix;
+
+    if (use_chunks) {
+      out3 << "  Parallelizing mblock and frequency chunk loop (" << nmblock
+           << " mblocks, chunks of " << f_chunk_size << " frequencies)\n";
+
+      iyb_calc_chunked(ws,
+                       iyb,
+                       iyb_aux_array,
+                       diyb_dx,
+                       geo_pos_matrix,
+                       atmosphere_dim,
+                       nlte_field,
+                       cloudbox_on,
+                       stokes_dim,
+                       f_grid,
+                       sensor_pos,
+                       sensor_los,
+                       transmitter_pos,
+                       mblock_dlos_grid,
+                       iy_unit,
+                       iy_main_agenda,
+                       geo_pos_agenda,
+                       j_analytical_do,
+                       jacobian_quantities,
+                       jacobian_indices,
+                       iy_aux_vars,
+                       f_chunk_size,
+                       verbosity);
+    } else {
+      out3 << "  Parallelizing Jacobian part of mblock loop (" << nmblock
+           << " iterations)\n";
+
+      iyb.resize(nmblock);
+      diyb_dx.resize(nmblock);
+      geo_pos_matrix.resize(nmblock);
+      for (Index mblock_index = 0; mblock_index < nmblock; mblock_index++)
+        iyb_calc(ws,
+                 iyb[mblock_index],
+                 iyb_aux_array[mblock_index],
+                 diyb_dx[mblock_index],
+                 geo_pos_matrix[mblock_index],
+                 mblock_index,
+                 atmosphere_dim,
+                 nlte_field,
+                 cloudbox_on,
+                 stokes_dim,
+                 f_grid,
+                 sensor_pos,
+                 sensor_los,
+                 transmitter_pos,
+                 mblock_dlos_grid,
+                 iy_unit,
+                 iy_main_agenda,
+                 geo_pos_agenda,
+                 j_analytical_do,
+                 jacobian_quantities,
+                 jacobian_indices,
+                 iy_aux_vars,
+                 verbosity);
+    }
+
+    ThreadWorkspaces thread_ws(ws, nmblock);
+
+#pragma omp parallel for if (thread_ws.parallel()) \
+    num_threads(thread_ws.nthreads())
+    for (Index mblock_index = 0; mblock_index < nmblock; mblock_index++) {
+      // Skip remaining iterations if an error occurred
+      if (failed) continue;
+
+      try {
+        yCalc_mblock_apply_sensor(thread_ws.get(),
+                                  y,
+                                  y_f,
+                                  y_pol,
+                                  y_pos,
+                                  y_los,
+                                  y_geo,
+                                  jacobian,
+                                  stokes_dim,
+                                  f_grid,
+                                  sensor_pos,
+                                  sensor_los,
+                                  sensor_response,
+                                  sensor_response_f,
+                                  sensor_response_pol,
+                                  sensor_response_dlos,
+                                  jacobian_agenda,
+                                  jacobian_do,
+                                  jacobian_quantities,
+                                  jacobian_indices,
+                                  iyb[mblock_index],
+                                  diyb_dx[mblock_index],
+                                  geo_pos_matrix[mblock_index],
+                                  mblock_index,
+                                  n1y,
+                                  j_analytical_do);
+      } catch (const std::exception& e) {
+#pragma omp critical(yCalc_fail)
+        {
+          fail_msg = e.what();
+          failed = true;
+        }
+      }
+    }  // End mblock loop
+  } else if (mblock_parallel) {
     out3 << "  Parallelizing mblock loop (" << nmblock << " iterations)\n";
 
-    // We have to make a local copy of the Workspace and the agendas because
-    // only non-reference types can be declared firstprivate in OpenMP
-    Workspace l_ws(ws);
-    Agenda l_jacobian_agenda(jacobian_agenda);
-    Agenda l_iy_main_agenda(iy_main_agenda);
-    Agenda l_geo_pos_agenda(geo_pos_agenda);
+    // Each thread gets its own workspace, which is reused by all agenda
+    // calls inside the loop body
+    ThreadWorkspaces thread_ws(ws, nmblock);
 
-#pragma omp parallel for firstprivate( \
-    l_ws, l_jacobian_agenda, l_iy_main_agenda, l_geo_pos_agenda)
+#pragma omp parallel for if (thread_ws.parallel()) \
+    num_threads(thread_ws.nthreads())
     for (Index mblock_index = 0; mblock_index < nmblock; mblock_index++) {
       // Skip remaining iterations if an error occurred
       if (failed) continue;
@@ -1513,7 +1673,7 @@ void yCalc(Workspace& ws,
       yCalc_mblock_loop_body(failed,
                              fail_msg,
                              iyb_aux_array,
-                             l_ws,
+                             thread_ws.get(),
                              y,
                              y_f,
                              y_pol,
@@ -1535,9 +1695,9 @@ void yCalc(Workspace& ws,
                              sensor_response_pol,
                              sensor_response_dlos,
                              iy_unit,
-                             l_iy_main_agenda,
-                             l_geo_pos_agenda,
-                             l_jacobian_agenda,
+                             iy_main_agenda,
+                             geo_pos_agenda,
+                             jacobian_agenda,
                              jacobian_do,
                              jacobian_quantities,
                              jacobian_indices,
@@ -1741,6 +1901,7 @@ void yCalcAppend(Workspace& ws,
         jacobian_do,
         jacobian_quantities,
         iy_aux_vars,
+        0,
         verbosity);
 
   // Consistency checks
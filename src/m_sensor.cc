@@ -49,6 +49,7 @@
 #include "messages.h"
 #include "ppath.h"
 #include "sensor.h"
+#include "sensor_cache.h"
 #include "sorting.h"
 #include "special_interp.h"
 #include "xml_io.h"
@@ -1598,6 +1599,68 @@ void sensor_responseFrequencySwitching(
 
 
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void sensor_responseFromAgendaCached(Workspace& ws,
+                                     Sparse& sensor_response,
+                                     Vector& sensor_response_f,
+                                     Vector& sensor_response_f_grid,
+                                     ArrayOfIndex& sensor_response_pol,
+                                     ArrayOfIndex& sensor_response_pol_grid,
+                                     Matrix& sensor_response_dlos,
+                                     Matrix& sensor_response_dlos_grid,
+                                     Matrix& mblock_dlos_grid,
+                                     const Vector& f_backend,
+                                     const Agenda& sensor_response_agenda,
+                                     const String& cache_dir,
+                                     const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  if (cache_dir.empty())
+    throw runtime_error("*cache_dir* must not be empty.");
+
+  const String filename =
+      cache_dir + "/sensor_response_" +
+      agenda_input_hash(ws, sensor_response_agenda, verbosity) + ".bin";
+
+  if (sensor_response_cache_read(sensor_response,
+                                 sensor_response_f,
+                                 sensor_response_f_grid,
+                                 sensor_response_pol,
+                                 sensor_response_pol_grid,
+                                 sensor_response_dlos,
+                                 sensor_response_dlos_grid,
+                                 mblock_dlos_grid,
+                                 filename)) {
+    out2 << "  Sensor response read from cache: " << filename << "\n";
+    return;
+  }
+
+  sensor_response_agendaExecute(ws,
+                                sensor_response,
+                                sensor_response_f,
+                                sensor_response_f_grid,
+                                sensor_response_pol,
+                                sensor_response_pol_grid,
+                                sensor_response_dlos,
+                                sensor_response_dlos_grid,
+                                mblock_dlos_grid,
+                                f_backend,
+                                sensor_response_agenda);
+
+  sensor_response_cache_write(sensor_response,
+                              sensor_response_f,
+                              sensor_response_f_grid,
+                              sensor_response_pol,
+                              sensor_response_pol_grid,
+                              sensor_response_dlos,
+                              sensor_response_dlos_grid,
+                              mblock_dlos_grid,
+                              filename);
+  out2 << "  Sensor response written to cache: " << filename << "\n";
+}
+
+
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void sensor_responseIF2RF(  // WS Output:
     Vector& sensor_response_f,
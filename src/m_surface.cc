@@ -1070,37 +1070,9 @@ void surfaceTelsem(Matrix& surface_los,
   }
   chk_if_in_range("Longitude input to TELSEM2", lon, 0.0, 360.0);
 
-  Index cellnumber = atlas.calc_cellnum(lat, lon);
-  // Check if cell is in atlas.
-  if (!atlas.contains(cellnumber)) {
-    if (d_max <= 0.0) {
-      throw std::runtime_error(
-          "Given coordinates are not contained in "
-          " TELSEM atlas. To enable nearest neighbor"
-          "interpolation set *d_max* to a positive "
-          "value.");
-    } else {
-      cellnumber = atlas.calc_cellnum_nearest_neighbor(lat, lon);
-      Numeric lat_nn, lon_nn;
-      std::tie(lat_nn, lon_nn) = atlas.get_coordinates(cellnumber);
-      Numeric d = sphdist(lat, lon, lat_nn, lon_nn);
-      if (d > d_max) {
-        std::ostringstream out{};
-        out << "Distance of nearest neighbor exceeds provided limit (";
-        out << d << " > " << d_max << ").";
-        throw std::runtime_error(out.str());
-      }
-    }
-  }
-
-  Index class1 = atlas.get_class1(cellnumber);
-  Index class2 = atlas.get_class2(cellnumber);
-
-  Vector emis_h = atlas.get_emis_h(cellnumber);
-  Vector emis_v = atlas.get_emis_v(cellnumber);
-  Numeric e_v, e_h, theta;
-  theta = 180.0 - abs(rtp_los[0]);
+  const Index cellnumber = atlas.find_cell(lat, lon, d_max);
 
+  Vector f(nf);
   for (Index i = 0; i < nf; ++i) {
     if (f_grid[i] < 5e9)
       throw std::runtime_error("Only frequency >= 5 GHz are allowed");
@@ -1109,12 +1081,23 @@ void surfaceTelsem(Matrix& surface_los,
 
     // For frequencies 700 <= f <= 900 GHz use 700 GHz to avoid extrapolation
     // outside of TELSEM specifications.
-    Numeric f = std::min(f_grid[i], 700e9) * 1e-9;
-    std::tie(e_v, e_h) =
-        atlas.emis_interp(theta, f, class1, class2, emis_v, emis_h);
+    f[i] = std::min(f_grid[i], 700e9) * 1e-9;
+  }
 
-    surface_rv_rh(i, 0) = min(max(1.0 - e_v, r_min), r_max);
-    surface_rv_rh(i, 1) = min(max(1.0 - e_h, r_min), r_max);
+  const Numeric theta = 180.0 - abs(rtp_los[0]);
+  Vector e_v(nf), e_h(nf);
+  atlas.emis_interp(e_v,
+                    e_h,
+                    theta,
+                    f,
+                    atlas.get_class1(cellnumber),
+                    atlas.get_class2(cellnumber),
+                    atlas.get_emis_v(cellnumber),
+                    atlas.get_emis_h(cellnumber));
+
+  for (Index i = 0; i < nf; ++i) {
+    surface_rv_rh(i, 0) = min(max(1.0 - e_v[i], r_min), r_max);
+    surface_rv_rh(i, 1) = min(max(1.0 - e_h[i], r_min), r_max);
   }
 
   surfaceFlatRvRh(surface_los,
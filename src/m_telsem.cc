@@ -45,39 +45,38 @@ void telsemStandalone(Matrix &emis,
   chk_if_in_range("Latitude input to TELSEM2", lat, -90.0, 90.0);
   chk_if_in_range("Longitude input to TELSEM2", lon, 0.0, 360.0);
 
-  Index cellnumber = atlas.calc_cellnum(lat, lon);
-  // Check if cell is in atlas.
-  if (!atlas.contains(cellnumber)) {
-    if (d_max <= 0.0) {
-      throw std::runtime_error(
-          "Given coordinates are not contained in "
-          " TELSEM atlas. To enable nearest neighbor"
-          "interpolation set *d_max* to a positive "
-          "value.");
-    } else {
-      cellnumber = atlas.calc_cellnum_nearest_neighbor(lat, lon);
-      Numeric lat_nn, lon_nn;
-      std::tie(lat_nn, lon_nn) = atlas.get_coordinates(cellnumber);
-      Numeric d = sphdist(lat, lon, lat_nn, lon_nn);
-      if (d > d_max) {
-        std::ostringstream out{};
-        out << "Distance of nearest neighbor exceeds provided limit (";
-        out << d << " > " << d_max << ").";
-        throw std::runtime_error(out.str());
-      }
-    }
-  }
-
-  Index class1 = atlas.get_class1(cellnumber);
-  Index class2 = atlas.get_class2(cellnumber);
-  Vector emis_v = atlas.get_emis_v(cellnumber);
-  Vector emis_h = atlas.get_emis_h(cellnumber);
+  const Index cellnumber = atlas.find_cell(lat, lon, d_max);
 
+  Vector freq(f);
+  freq *= 1e-9;
   emis.resize(f.nelem(), 2);
-  for (Index i = 0; i < f.nelem(); ++i) {
-    std::tie(emis(i, 0), emis(i, 1)) =
-        atlas.emis_interp(theta, f[i] * 1e-9, class1, class2, emis_v, emis_h);
-  }
+  atlas.emis_interp(emis(joker, 0),
+                    emis(joker, 1),
+                    theta,
+                    freq,
+                    atlas.get_class1(cellnumber),
+                    atlas.get_class2(cellnumber),
+                    atlas.get_emis_v(cellnumber),
+                    atlas.get_emis_h(cellnumber));
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void telsemStandaloneBatch(Tensor3 &emis,
+                           const Vector &lat,
+                           const Vector &lon,
+                           const Vector &theta,
+                           const Vector &f,
+                           const TelsemAtlas &atlas,
+                           const Numeric &d_max,
+                           const Verbosity &) {
+  for (Index i = 0; i < lat.nelem(); ++i)
+    chk_if_in_range("Latitude input to TELSEM2", lat[i], -90.0, 90.0);
+  for (Index i = 0; i < lon.nelem(); ++i)
+    chk_if_in_range("Longitude input to TELSEM2", lon[i], 0.0, 360.0);
+
+  Vector freq(f);
+  freq *= 1e-9;
+  atlas.emis_interp_batch(emis, lat, lon, theta, freq, d_max);
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -45,6 +45,7 @@
 #include "arts_omp.h"
 #include "auto_md.h"
 #include "auto_version.h"
+#include "computeserver.h"
 #include "docserver.h"
 #include "exceptions.h"
 #include "file.h"
@@ -54,6 +55,7 @@
 #include "mystring.h"
 #include "parameters.h"
 #include "parser.h"
+#include "profiling.h"
 #include "workspace_ng.h"
 #include "wsv_aux.h"
 
@@ -903,6 +905,11 @@ int main(int argc, char** argv) {
     polite_goodby();
   }
 
+  if (0 != parameters.computeserver && 1 != parameters.controlfiles.nelem()) {
+    cerr << "The compute server needs exactly one control file.\n";
+    polite_goodby();
+  }
+
   // Set the basename according to the first control file, if not
   // explicitly specified.
   if ("" == parameters.basename) {
@@ -933,6 +940,8 @@ int main(int argc, char** argv) {
   // option or default.
   set_reporting_level(parameters.reporting);
 
+  if (parameters.profile) Profiling::enable();
+
   // Keep around a global copy of the verbosity levels at launch, so that
   // verbosityInit() can be used to reset them in the control file
   extern Verbosity verbosity_at_launch;
@@ -1040,6 +1049,15 @@ int main(int argc, char** argv) {
 
         // Execute main agenda:
         Arts2(workspace, tasklist, verbosity);
+
+#ifdef ENABLE_DOCSERVER
+        // Keep the workspace to serve requests:
+        if (0 != parameters.computeserver) {
+          Computeserver computeserver(
+              workspace, parameters.computeserver, verbosity);
+          computeserver.launch();
+        }
+#endif
       } catch (const std::exception& x) {
         ostringstream os;
         os << "Run-time error in controlfile: " << parameters.controlfiles[i]
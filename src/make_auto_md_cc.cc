@@ -384,9 +384,9 @@ int main() {
     ofs << "        // Even if a variable is only used as WSM output inside this agenda,\n";
     ofs << "        // It is possible that it is used as input further down by another agenda,\n";
     ofs << "        // which we can't see here. Therefore initialized variables have to be\n";
-    ofs << "        // duplicated.\n";
+    ofs << "        // shared. Agenda::execute makes a copy before the first write.\n";
     ofs << "        if (ws.is_initialized(i))\n";
-    ofs << "            ws.duplicate(i);\n";
+    ofs << "            ws.share(i);\n";
     ofs << "        else\n";
     ofs << "            ws.push_uninitialized(i, NULL);\n";
     ofs << "    }\n";
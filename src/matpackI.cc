@@ -26,6 +26,7 @@
 #include <cstring>
 #include "blas.h"
 #include "exceptions.h"
+#include "matpack_pool.h"
 
 using std::cout;
 using std::endl;
@@ -318,23 +319,23 @@ void copy(Numeric x, Iterator1D target, const Iterator1D& end) {
 // ---------------------
 
 Vector::Vector(std::initializer_list<Numeric> init)
-    : VectorView(new Numeric[init.size()], Range(0, init.size())) {
+    : VectorView(matpack_new(init.size()), Range(0, init.size())) {
   std::copy(init.begin(), init.end(), begin());
 }
 
-Vector::Vector(Index n) : VectorView(new Numeric[n], Range(0, n)) {
+Vector::Vector(Index n) : VectorView(matpack_new(n), Range(0, n)) {
   // Nothing to do here.
 }
 
 Vector::Vector(Index n, Numeric fill)
-    : VectorView(new Numeric[n], Range(0, n)) {
+    : VectorView(matpack_new(n), Range(0, n)) {
   // Here we can access the raw memory directly, for slightly
   // increased efficiency:
   std::fill_n(mdata, n, fill);
 }
 
 Vector::Vector(Numeric start, Index extent, Numeric stride)
-    : VectorView(new Numeric[extent], Range(0, extent)) {
+    : VectorView(matpack_new(extent), Range(0, extent)) {
   // Fill with values:
   Numeric x = start;
   Iterator1D i = begin();
@@ -346,17 +347,17 @@ Vector::Vector(Numeric start, Index extent, Numeric stride)
 }
 
 Vector::Vector(const ConstVectorView& v)
-    : VectorView(new Numeric[v.nelem()], Range(0, v.nelem())) {
+    : VectorView(matpack_new(v.nelem()), Range(0, v.nelem())) {
   copy(v.begin(), v.end(), begin());
 }
 
 Vector::Vector(const Vector& v)
-    : VectorView(new Numeric[v.nelem()], Range(0, v.nelem())) {
+    : VectorView(matpack_new(v.nelem()), Range(0, v.nelem())) {
   std::memcpy(mdata, v.mdata, nelem() * sizeof(Numeric));
 }
 
 Vector::Vector(const std::vector<Numeric>& v)
-    : VectorView(new Numeric[v.size()], Range(0, v.size())) {
+    : VectorView(matpack_new(v.size()), Range(0, v.size())) {
   std::vector<Numeric>::const_iterator vec_it_end = v.end();
   Iterator1D this_it = this->begin();
   for (std::vector<Numeric>::const_iterator vec_it = v.begin();
@@ -381,7 +382,7 @@ Vector& Vector::operator=(const Vector& v) {
 
 Vector& Vector::operator=(Vector&& v) noexcept {
   if (this != &v) {
-    delete[] mdata;
+    matpack_delete(mdata, nelem());
     mdata = v.mdata;
     mrange = v.mrange;
     v.mrange = Range(0, 0);
@@ -404,8 +405,8 @@ Vector& Vector::operator=(Numeric x) {
 void Vector::resize(Index n) {
   assert(0 <= n);
   if (mrange.mextent != n) {
-    delete[] mdata;
-    mdata = new Numeric[n];
+    matpack_delete(mdata, nelem());
+    mdata = matpack_new(n);
     mrange.mstart = 0;
     mrange.mextent = n;
     mrange.mstride = 1;
@@ -417,7 +418,7 @@ void swap(Vector& v1, Vector& v2) {
   std::swap(v1.mdata, v2.mdata);
 }
 
-Vector::~Vector() { delete[] mdata; }
+Vector::~Vector() { matpack_delete(mdata, nelem()); }
 
 // Functions for ConstMatrixView:
 // ------------------------------
@@ -942,13 +943,13 @@ void copy(Numeric x, Iterator2D target, const Iterator2D& end) {
 /** Constructor setting size. This constructor has to set the stride
     in the row range correctly! */
 Matrix::Matrix(Index r, Index c)
-    : MatrixView(new Numeric[r * c], Range(0, r, c), Range(0, c)) {
+    : MatrixView(matpack_new(r * c), Range(0, r, c), Range(0, c)) {
   // Nothing to do here.
 }
 
 /** Constructor setting size and filling with constant value. */
 Matrix::Matrix(Index r, Index c, Numeric fill)
-    : MatrixView(new Numeric[r * c], Range(0, r, c), Range(0, c)) {
+    : MatrixView(matpack_new(r * c), Range(0, r, c), Range(0, c)) {
   // Here we can access the raw memory directly, for slightly
   // increased efficiency:
   std::fill_n(mdata, r * c, fill);
@@ -957,7 +958,7 @@ Matrix::Matrix(Index r, Index c, Numeric fill)
 /** Copy constructor from MatrixView. This automatically sets the size
     and copies the data. */
 Matrix::Matrix(const ConstMatrixView& m)
-    : MatrixView(new Numeric[m.nrows() * m.ncols()],
+    : MatrixView(matpack_new(m.nrows() * m.ncols()),
                  Range(0, m.nrows(), m.ncols()),
                  Range(0, m.ncols())) {
   copy(m.begin(), m.end(), begin());
@@ -966,7 +967,7 @@ Matrix::Matrix(const ConstMatrixView& m)
 /** Copy constructor from Matrix. This automatically sets the size
     and copies the data. */
 Matrix::Matrix(const Matrix& m)
-    : MatrixView(new Numeric[m.nrows() * m.ncols()],
+    : MatrixView(matpack_new(m.nrows() * m.ncols()),
                  Range(0, m.nrows(), m.ncols()),
                  Range(0, m.ncols())) {
   // There is a catch here: If m is an empty matrix, then it will have
@@ -1012,7 +1013,7 @@ Matrix& Matrix::operator=(const Matrix& m) {
 //! Move assignment operator from another matrix.
 Matrix& Matrix::operator=(Matrix&& m) noexcept {
   if (this != &m) {
-    delete[] mdata;
+    matpack_delete(mdata, nrows() * ncols());
     mdata = m.mdata;
     mrr = m.mrr;
     mcr = m.mcr;
@@ -1058,8 +1059,8 @@ void Matrix::resize(Index r, Index c) {
   assert(0 <= c);
 
   if (mrr.mextent != r || mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[r * c];
+    matpack_delete(mdata, nrows() * ncols());
+    mdata = matpack_new(r * c);
 
     mrr.mstart = 0;
     mrr.mextent = r;
@@ -1083,7 +1084,7 @@ void swap(Matrix& m1, Matrix& m2) {
 Matrix::~Matrix() {
   //   cout << "Destroying a Matrix:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  matpack_delete(mdata, nrows() * ncols());
 }
 
 // Some general Matrix Vector functions:
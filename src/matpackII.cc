@@ -270,11 +270,7 @@ Sparse& Sparse::operator/=(Numeric x) {
 void Sparse::list_elements(Vector& values,
                            ArrayOfIndex& row_indices,
                            ArrayOfIndex& column_indices) const {
-  Index m, n;
-  m = nrows();
-  n = ncols();
-  Matrix A(m, n);
-  A = 0.0;
+  const Index m = nrows();
 
   values.resize(nnz());
   row_indices.resize(nnz());
@@ -24,6 +24,7 @@
 
 #include "matpackIII.h"
 #include "exceptions.h"
+#include "matpack_pool.h"
 
 using std::runtime_error;
 
@@ -560,7 +561,7 @@ void copy(Numeric x, Iterator3D target, const Iterator3D& end) {
 /** Constructor setting size. This constructor has to set the strides
     in the page and row ranges correctly! */
 Tensor3::Tensor3(Index p, Index r, Index c)
-    : Tensor3View(new Numeric[p * r * c],
+    : Tensor3View(matpack_new(p * r * c),
                   Range(0, p, r * c),
                   Range(0, r, c),
                   Range(0, c)) {
@@ -569,7 +570,7 @@ Tensor3::Tensor3(Index p, Index r, Index c)
 
 /** Constructor setting size and filling with constant value. */
 Tensor3::Tensor3(Index p, Index r, Index c, Numeric fill)
-    : Tensor3View(new Numeric[p * r * c],
+    : Tensor3View(matpack_new(p * r * c),
                   Range(0, p, r * c),
                   Range(0, r, c),
                   Range(0, c)) {
@@ -581,7 +582,7 @@ Tensor3::Tensor3(Index p, Index r, Index c, Numeric fill)
 /** Copy constructor from Tensor3View. This automatically sets the size
     and copies the data. */
 Tensor3::Tensor3(const ConstTensor3View& m)
-    : Tensor3View(new Numeric[m.npages() * m.nrows() * m.ncols()],
+    : Tensor3View(matpack_new(m.npages() * m.nrows() * m.ncols()),
                   Range(0, m.npages(), m.nrows() * m.ncols()),
                   Range(0, m.nrows(), m.ncols()),
                   Range(0, m.ncols())) {
@@ -591,7 +592,7 @@ Tensor3::Tensor3(const ConstTensor3View& m)
 /** Copy constructor from Tensor3. This automatically sets the size
     and copies the data. */
 Tensor3::Tensor3(const Tensor3& m)
-    : Tensor3View(new Numeric[m.npages() * m.nrows() * m.ncols()],
+    : Tensor3View(matpack_new(m.npages() * m.nrows() * m.ncols()),
                   Range(0, m.npages(), m.nrows() * m.ncols()),
                   Range(0, m.nrows(), m.ncols()),
                   Range(0, m.ncols())) {
@@ -638,7 +639,7 @@ Tensor3& Tensor3::operator=(const Tensor3& x) {
 //! Move assignment operator from another tensor.
 Tensor3& Tensor3::operator=(Tensor3&& x) noexcept {
   if (this != &x) {
-    delete[] mdata;
+    matpack_delete(mdata, npages() * nrows() * ncols());
     mdata = x.mdata;
     mpr = x.mpr;
     mrr = x.mrr;
@@ -667,8 +668,8 @@ void Tensor3::resize(Index p, Index r, Index c) {
   assert(0 <= c);
 
   if (mpr.mextent != p || mrr.mextent != r || mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[p * r * c];
+    matpack_delete(mdata, npages() * nrows() * ncols());
+    mdata = matpack_new(p * r * c);
 
     mpr.mstart = 0;
     mpr.mextent = p;
@@ -697,7 +698,7 @@ void swap(Tensor3& t1, Tensor3& t2) {
 Tensor3::~Tensor3() {
   //   cout << "Destroying a Tensor3:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  matpack_delete(mdata, npages() * nrows() * ncols());
 }
 
 /** A generic transform function for tensors, which can be used to
@@ -24,6 +24,7 @@
 
 #include "matpackIV.h"
 #include "exceptions.h"
+#include "matpack_pool.h"
 
 using std::runtime_error;
 
@@ -950,7 +951,7 @@ void copy(Numeric x, Iterator4D target, const Iterator4D& end) {
 /** Constructor setting size. This constructor has to set the strides
     in the book, page and row ranges correctly! */
 Tensor4::Tensor4(Index b, Index p, Index r, Index c)
-    : Tensor4View(new Numeric[b * p * r * c],
+    : Tensor4View(matpack_new(b * p * r * c),
                   Range(0, b, p * r * c),
                   Range(0, p, r * c),
                   Range(0, r, c),
@@ -960,7 +961,7 @@ Tensor4::Tensor4(Index b, Index p, Index r, Index c)
 
 /** Constructor setting size and filling with constant value. */
 Tensor4::Tensor4(Index b, Index p, Index r, Index c, Numeric fill)
-    : Tensor4View(new Numeric[b * p * r * c],
+    : Tensor4View(matpack_new(b * p * r * c),
                   Range(0, b, p * r * c),
                   Range(0, p, r * c),
                   Range(0, r, c),
@@ -973,7 +974,7 @@ Tensor4::Tensor4(Index b, Index p, Index r, Index c, Numeric fill)
 /** Copy constructor from Tensor4View. This automatically sets the size
     and copies the data. */
 Tensor4::Tensor4(const ConstTensor4View& m)
-    : Tensor4View(new Numeric[m.nbooks() * m.npages() * m.nrows() * m.ncols()],
+    : Tensor4View(matpack_new(m.nbooks() * m.npages() * m.nrows() * m.ncols()),
                   Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
                   Range(0, m.npages(), m.nrows() * m.ncols()),
                   Range(0, m.nrows(), m.ncols()),
@@ -984,7 +985,7 @@ Tensor4::Tensor4(const ConstTensor4View& m)
 /** Copy constructor from Tensor4. This automatically sets the size
     and copies the data. */
 Tensor4::Tensor4(const Tensor4& m)
-    : Tensor4View(new Numeric[m.nbooks() * m.npages() * m.nrows() * m.ncols()],
+    : Tensor4View(matpack_new(m.nbooks() * m.npages() * m.nrows() * m.ncols()),
                   Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
                   Range(0, m.npages(), m.nrows() * m.ncols()),
                   Range(0, m.nrows(), m.ncols()),
@@ -1036,7 +1037,7 @@ Tensor4& Tensor4::operator=(const Tensor4& x) {
 //! Move assignment operator from another tensor.
 Tensor4& Tensor4::operator=(Tensor4&& x) noexcept {
   if (this != &x) {
-    delete[] mdata;
+    matpack_delete(mdata, nbooks() * npages() * nrows() * ncols());
     mdata = x.mdata;
     mbr = x.mbr;
     mpr = x.mpr;
@@ -1069,8 +1070,8 @@ void Tensor4::resize(Index b, Index p, Index r, Index c) {
 
   if (mbr.mextent != b || mpr.mextent != p || mrr.mextent != r ||
       mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[b * p * r * c];
+    matpack_delete(mdata, nbooks() * npages() * nrows() * ncols());
+    mdata = matpack_new(b * p * r * c);
 
     mbr.mstart = 0;
     mbr.mextent = b;
@@ -1104,7 +1105,7 @@ void swap(Tensor4& t1, Tensor4& t2) {
 Tensor4::~Tensor4() {
   //   cout << "Destroying a Tensor4:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  matpack_delete(mdata, nbooks() * npages() * nrows() * ncols());
 }
 
 /** A generic transform function for tensors, which can be used to
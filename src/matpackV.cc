@@ -24,6 +24,7 @@
 
 #include "matpackV.h"
 #include "exceptions.h"
+#include "matpack_pool.h"
 
 using std::runtime_error;
 
@@ -1615,7 +1616,7 @@ void copy(Numeric x, Iterator5D target, const Iterator5D& end) {
 /** Constructor setting size. This constructor has to set the strides
     in the shelf, book, page and row ranges correctly! */
 Tensor5::Tensor5(Index s, Index b, Index p, Index r, Index c)
-    : Tensor5View(new Numeric[s * b * p * r * c],
+    : Tensor5View(matpack_new(s * b * p * r * c),
                   Range(0, s, b * p * r * c),
                   Range(0, b, p * r * c),
                   Range(0, p, r * c),
@@ -1626,7 +1627,7 @@ Tensor5::Tensor5(Index s, Index b, Index p, Index r, Index c)
 
 /** Constructor setting size and filling with constant value. */
 Tensor5::Tensor5(Index s, Index b, Index p, Index r, Index c, Numeric fill)
-    : Tensor5View(new Numeric[s * b * p * r * c],
+    : Tensor5View(matpack_new(s * b * p * r * c),
                   Range(0, s, b * p * r * c),
                   Range(0, b, p * r * c),
                   Range(0, p, r * c),
@@ -1641,8 +1642,8 @@ Tensor5::Tensor5(Index s, Index b, Index p, Index r, Index c, Numeric fill)
     and copies the data. */
 Tensor5::Tensor5(const ConstTensor5View& m)
     : Tensor5View(
-          new Numeric[m.nshelves() * m.nbooks() * m.npages() * m.nrows() *
-                      m.ncols()],
+          matpack_new(m.nshelves() * m.nbooks() * m.npages() * m.nrows() *
+                      m.ncols()),
           Range(
               0, m.nshelves(), m.nbooks() * m.npages() * m.nrows() * m.ncols()),
           Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
@@ -1656,8 +1657,8 @@ Tensor5::Tensor5(const ConstTensor5View& m)
     and copies the data. */
 Tensor5::Tensor5(const Tensor5& m)
     : Tensor5View(
-          new Numeric[m.nshelves() * m.nbooks() * m.npages() * m.nrows() *
-                      m.ncols()],
+          matpack_new(m.nshelves() * m.nbooks() * m.npages() * m.nrows() *
+                      m.ncols()),
           Range(
               0, m.nshelves(), m.nbooks() * m.npages() * m.nrows() * m.ncols()),
           Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
@@ -1713,7 +1714,8 @@ Tensor5& Tensor5::operator=(const Tensor5& x) {
 //! Move assignment operator from another tensor.
 Tensor5& Tensor5::operator=(Tensor5&& x) noexcept {
   if (this != &x) {
-    delete[] mdata;
+    matpack_delete(mdata,
+                   nshelves() * nbooks() * npages() * nrows() * ncols());
     mdata = x.mdata;
     msr = x.msr;
     mbr = x.mbr;
@@ -1749,8 +1751,9 @@ void Tensor5::resize(Index s, Index b, Index p, Index r, Index c) {
 
   if (msr.mextent != s || mbr.mextent != b || mpr.mextent != p ||
       mrr.mextent != r || mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[s * b * p * r * c];
+    matpack_delete(mdata,
+                   nshelves() * nbooks() * npages() * nrows() * ncols());
+    mdata = matpack_new(s * b * p * r * c);
 
     msr.mstart = 0;
     msr.mextent = s;
@@ -1789,7 +1792,8 @@ void swap(Tensor5& t1, Tensor5& t2) {
 Tensor5::~Tensor5() {
   //   cout << "Destroying a Tensor5:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  matpack_delete(mdata,
+                 nshelves() * nbooks() * npages() * nrows() * ncols());
 }
 
 /** A generic transform function for tensors, which can be used to
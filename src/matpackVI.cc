@@ -24,6 +24,7 @@
 
 #include "matpackVI.h"
 #include "exceptions.h"
+#include "matpack_pool.h"
 
 // Functions for ConstTensor6View:
 // ------------------------------
@@ -2028,7 +2029,7 @@ void copy(Numeric x, Iterator6D target, const Iterator6D& end) {
 /** Constructor setting size. This constructor has to set the strides
     in the page and row ranges correctly! */
 Tensor6::Tensor6(Index v, Index s, Index b, Index p, Index r, Index c)
-    : Tensor6View(new Numeric[v * s * b * p * r * c],
+    : Tensor6View(matpack_new(v * s * b * p * r * c),
                   Range(0, v, s * b * p * r * c),
                   Range(0, s, b * p * r * c),
                   Range(0, b, p * r * c),
@@ -2041,7 +2042,7 @@ Tensor6::Tensor6(Index v, Index s, Index b, Index p, Index r, Index c)
 /** Constructor setting size and filling with constant value. */
 Tensor6::Tensor6(
     Index v, Index s, Index b, Index p, Index r, Index c, Numeric fill)
-    : Tensor6View(new Numeric[v * s * b * p * r * c],
+    : Tensor6View(matpack_new(v * s * b * p * r * c),
                   Range(0, v, s * b * p * r * c),
                   Range(0, s, b * p * r * c),
                   Range(0, b, p * r * c),
@@ -2057,8 +2058,8 @@ Tensor6::Tensor6(
     and copies the data. */
 Tensor6::Tensor6(const ConstTensor6View& m)
     : Tensor6View(
-          new Numeric[m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
-                      m.nrows() * m.ncols()],
+          matpack_new(m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
+                      m.nrows() * m.ncols()),
           Range(0,
                 m.nvitrines(),
                 m.nshelves() * m.nbooks() * m.npages() * m.nrows() * m.ncols()),
@@ -2075,8 +2076,8 @@ Tensor6::Tensor6(const ConstTensor6View& m)
     and copies the data. */
 Tensor6::Tensor6(const Tensor6& m)
     : Tensor6View(
-          new Numeric[m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
-                      m.nrows() * m.ncols()],
+          matpack_new(m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
+                      m.nrows() * m.ncols()),
           Range(0,
                 m.nvitrines(),
                 m.nshelves() * m.nbooks() * m.npages() * m.nrows() * m.ncols()),
@@ -2140,7 +2141,9 @@ Tensor6& Tensor6::operator=(const Tensor6& x) {
 //! Move assignment operator from another tensor.
 Tensor6& Tensor6::operator=(Tensor6&& x) noexcept {
   if (this != &x) {
-    delete[] mdata;
+    matpack_delete(mdata,
+                   nvitrines() * nshelves() * nbooks() * npages() * nrows() *
+                   ncols());
     mdata = x.mdata;
     mvr = x.mvr;
     msr = x.msr;
@@ -2182,8 +2185,10 @@ void Tensor6::resize(Index v, Index s, Index b, Index p, Index r, Index c) {
 
   if (mvr.mextent != v || msr.mextent != s || mbr.mextent != b ||
       mpr.mextent != p || mrr.mextent != r || mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[v * s * b * p * r * c];
+    matpack_delete(mdata,
+                   nvitrines() * nshelves() * nbooks() * npages() * nrows() *
+                   ncols());
+    mdata = matpack_new(v * s * b * p * r * c);
 
     mvr.mstart = 0;
     mvr.mextent = v;
@@ -2227,7 +2232,9 @@ void swap(Tensor6& t1, Tensor6& t2) {
 Tensor6::~Tensor6() {
   //   cout << "Destroying a Tensor6:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  matpack_delete(mdata,
+                 nvitrines() * nshelves() * nbooks() * npages() * nrows() *
+                 ncols());
 }
 
 /** A generic transform function for tensors, which can be used to
@@ -0,0 +1,67 @@
+/**
+  \file   matpack_pool.cc
+
+  \brief  Per-thread scratch pool for the storage of matpack containers.
+
+  \date   2026-10-15
+*/
+
+#include "matpack_pool.h"
+#include <unordered_map>
+#include <vector>
+
+namespace matpack_pool_detail {
+
+//! Upper limit of the number of Numerics kept by the pool of one thread.
+constexpr Index max_pooled = Index(8) * 1024 * 1024;
+
+//! Released blocks of the current thread, by number of elements.
+struct Pool {
+  std::unordered_map<Index, std::vector<Numeric*>> blocks;
+  Index pooled{0};
+
+  void clear() {
+    for (auto& b : blocks)
+      for (Numeric* p : b.second) delete[] p;
+    blocks.clear();
+    pooled = 0;
+  }
+
+  ~Pool() { clear(); }
+};
+
+thread_local Index scope_depth = 0;
+thread_local Index hits = 0;
+thread_local Pool pool;
+
+Numeric* pool_new(Index n) {
+  auto it = pool.blocks.find(n);
+  if (it != pool.blocks.end() && !it->second.empty()) {
+    Numeric* p = it->second.back();
+    it->second.pop_back();
+    pool.pooled -= n;
+    ++hits;
+    return p;
+  }
+  return new Numeric[n];
+}
+
+void pool_delete(Numeric* p, Index n) noexcept {
+  if (n > 0 && pool.pooled + n <= max_pooled) {
+    try {
+      pool.blocks[n].push_back(p);
+      pool.pooled += n;
+      return;
+    } catch (...) {
+      // Could not grow the pool, release the block instead
+    }
+  }
+  delete[] p;
+}
+
+}  // namespace matpack_pool_detail
+
+MatpackScratchScope::~MatpackScratchScope() {
+  if (--matpack_pool_detail::scope_depth == 0)
+    matpack_pool_detail::pool.clear();
+}
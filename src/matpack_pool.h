@@ -0,0 +1,77 @@
+/**
+  \file   matpack_pool.h
+
+  \brief  Per-thread scratch pool for the storage of matpack containers.
+
+  Vector, Matrix and Tensor3 to Tensor7 allocate their storage through
+  matpack_new and release it through matpack_delete. Outside of a
+  MatpackScratchScope these are plain new[] and delete[].
+
+  While a MatpackScratchScope is alive on a thread, released blocks are
+  kept in a pool owned by that thread instead of being returned to the
+  heap, and allocations of the same size are served from this pool.
+  This removes the heap traffic, and the allocator lock contention
+  under OpenMP, of loops that repeatedly create temporaries of the
+  same sizes. The pool is emptied when the outermost scope on the
+  thread ends.
+
+  All blocks are obtained with new Numeric[], so a block can be released
+  on another thread than the one that allocated it, or after the scope
+  has ended.
+
+  The scope only affects the thread that opened it. Parallel loops open
+  a scope inside the parallel region, so that every worker thread pools
+  its own temporaries.
+
+  \date   2026-10-15
+*/
+
+#ifndef matpack_pool_h
+#define matpack_pool_h
+
+#include "matpack.h"
+
+namespace matpack_pool_detail {
+extern thread_local Index scope_depth;
+extern thread_local Index hits;
+
+Numeric* pool_new(Index n);
+
+void pool_delete(Numeric* p, Index n) noexcept;
+}  // namespace matpack_pool_detail
+
+/** Allocate storage for n Numerics. */
+inline Numeric* matpack_new(Index n) {
+  if (matpack_pool_detail::scope_depth) return matpack_pool_detail::pool_new(n);
+  return new Numeric[n];
+}
+
+/** Release storage of n Numerics obtained from matpack_new. */
+inline void matpack_delete(Numeric* p, Index n) noexcept {
+  if (matpack_pool_detail::scope_depth && p)
+    matpack_pool_detail::pool_delete(p, n);
+  else
+    delete[] p;
+}
+
+/** Number of allocations served from the pool of the current thread.
+ *
+ * The count is never reset. It is mainly meant for tests.
+ */
+inline Index matpack_scratch_hits() { return matpack_pool_detail::hits; }
+
+/** Enables the scratch pool on the current thread while it is alive.
+ *
+ * Scopes can be nested, only the outermost one releases the pool.
+ */
+class MatpackScratchScope {
+ public:
+  MatpackScratchScope() { ++matpack_pool_detail::scope_depth; }
+
+  MatpackScratchScope(const MatpackScratchScope&) = delete;
+  MatpackScratchScope& operator=(const MatpackScratchScope&) = delete;
+
+  ~MatpackScratchScope();
+};
+
+#endif  // matpack_pool_h
@@ -1844,6 +1844,31 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupReadMapped"),
+      DESCRIPTION(
+          "Reads a gas absorption lookup table in the native binary format.\n"
+          "\n"
+          "Only the grids and species of the table are read into memory. The\n"
+          "cross-sections are memory mapped read-only from the file, so reading\n"
+          "is fast regardless of the table size, and all processes on a node\n"
+          "that read the same file share one copy of it in the page cache.\n"
+          "*abs_lookupAdapt* copies only the species and frequencies that are\n"
+          "needed out of the mapped table.\n"
+          "\n"
+          "The file must be written by *abs_lookupWriteMapped* on a machine\n"
+          "with the same byte order. Sets *abs_lookup_is_adapted* to 0.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("abs_lookup", "abs_lookup_is_adapted"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the native lookup table file.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupSetup"),
       DESCRIPTION(
@@ -2101,6 +2126,29 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
   
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupWriteMapped"),
+      DESCRIPTION(
+          "Writes a gas absorption lookup table in the native binary format.\n"
+          "\n"
+          "The cross-sections are stored uncompressed in native byte order,\n"
+          "aligned to the page size, so that *abs_lookupReadMapped* can memory\n"
+          "map them directly.\n"
+          "\n"
+          "The table is written to a temporary file that replaces the target\n"
+          "when complete, so a table that is mapped from the target stays\n"
+          "valid.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lookup"),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the native lookup table file.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_nlteFromRaw"),
       DESCRIPTION("Sets NLTE values manually\n"
@@ -4268,6 +4316,20 @@ void define_md_data_raw() {
           "    *doit_rte_agenda*.\n"
           " 3. Convergence test using *doit_conv_test_agenda*.\n"
           "\n"
+          "The iteration can be accelerated in two ways. Ng acceleration\n"
+          "(*accelerated*) extrapolates the field from the last four\n"
+          "iterations every fourth iteration. Anderson acceleration\n"
+          "(*anderson_depth* > 0) mixes the field after every iteration\n"
+          "with the fields of up to *anderson_depth* previous iterations,\n"
+          "such that the change of the field between iterations is\n"
+          "minimised. It often needs considerably fewer iterations for\n"
+          "optically thick clouds. The convergence test is applied to the\n"
+          "field before the mixing. The two methods can not be combined.\n"
+          "\n"
+          "The 1D scattering operators of *doit_scat_fieldCalc* and\n"
+          "*doit_scat_fieldCalcLimb* are built in the first iteration and\n"
+          "kept until the iteration has converged.\n"
+          "\n"
           "Note: The atmospheric dimensionality *atmosphere_dim* can be\n"
           "      either 1 or 3. To these dimensions the method adapts\n"
           "      automatically. 2D scattering calculations are not\n"
@@ -4281,11 +4343,13 @@ void define_md_data_raw() {
          "doit_scat_field_agenda",
          "doit_rte_agenda",
          "doit_conv_test_agenda"),
-      GIN("accelerated"),
-      GIN_TYPE("Index"),
-      GIN_DEFAULT("0"),
+      GIN("accelerated", "anderson_depth"),
+      GIN_TYPE("Index", "Index"),
+      GIN_DEFAULT("0", "0"),
       GIN_DESC(
-          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)")));
+          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)",
+          "Number of previous iterations used for Anderson acceleration,\n"
+          "0 switches it off. Values of 3 to 6 are typical.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("cloudbox_fieldCrop"),
@@ -5941,7 +6005,17 @@ void define_md_data_raw() {
           "\n"
           "The scattering integral field is generated by integrating\n"
           "the product of phase matrix and Stokes vector over all incident\n"
-          "angles. For more information please refer to AUG.\n"),
+          "angles. For more information please refer to AUG.\n"
+          "\n"
+          "For 1D, the phase matrices of *pha_mat_doit* are integrated into\n"
+          "one scattering operator per pressure level. Within\n"
+          "*cloudbox_field_monoIterate* the operators are built in the first\n"
+          "iteration and kept for the remaining iterations of the frequency,\n"
+          "so *pha_mat_doit* must not be changed inside the iteration. For\n"
+          "3D, the phase matrices are calculated by *pha_mat_spt_agenda* for\n"
+          "each position and direction in every iteration and nothing is\n"
+          "kept, as the operators of all positions would take too much\n"
+          "memory.\n"),
       AUTHORS("Sreerekha T.R.", "Claudia Emde"),
       OUT("doit_scat_field"),
       GOUT(),
@@ -5981,6 +6055,9 @@ void define_md_data_raw() {
           "*DOAngularGridsSet* and it should always be used for limb\n"
           "simulations.\n"
           "\n"
+          "The scattering operators are kept between iterations as\n"
+          "described for *doit_scat_fieldCalc*.\n"
+          "\n"
           "For more information please refer to AUG.\n"),
       AUTHORS("Claudia Emde"),
       OUT("doit_scat_field"),
@@ -8686,6 +8763,9 @@ void define_md_data_raw() {
           "In addition, it is less sensitive to the choice of dza (as long\n"
           "as a small value is applied).\n"
           "\n"
+          "With \"recalc\", *yCalc* runs the reruns of the measurement blocks\n"
+          "in parallel, see *yCalc*.\n"
+          "\n"
           "The pointing off-set can be modelled to be time varying. The time\n"
           "variation is then described by a polynomial (with standard base\n"
           "functions). For example, a polynomial order of 0 means that the\n"
@@ -9305,7 +9385,12 @@ void define_md_data_raw() {
           "behind *y*. The function takes the differences between *ybatch*\n"
           "and *y* to form a numerical derived estimate of *jacobian*.\n"
           "\n"
-          "Column i of *jacobian* equals: (ybatch[i]-y)/pert_size.\n"),
+          "Column i of *jacobian* equals: (ybatch[i]-y)/pert_size.\n"
+          "\n"
+          "When *ybatch* is calculated by *ybatchCalc*, with the perturbation\n"
+          "made in *ybatch_calc_agenda* (e.g. by *AtmFieldPerturb* with\n"
+          "*ybatch_index* as position), the perturbed spectra are calculated\n"
+          "in parallel, each thread with its own copy of the perturbed field.\n"),
       AUTHORS("Patrick Eriksson"),
       OUT("jacobian"),
       GOUT(),
@@ -10177,15 +10262,20 @@ void define_md_data_raw() {
          "mc_max_iter",
          "mc_min_iter",
          "mc_taustep_limit"),
-      GIN("l_mc_scat_order", "t_interp_order"),
-      GIN_TYPE("Index", "Index"),
-      GIN_DEFAULT("11", "1"),
+      GIN("l_mc_scat_order", "t_interp_order", "nthreads"),
+      GIN_TYPE("Index", "Index", "Index"),
+      GIN_DEFAULT("11", "1", "1"),
       GIN_DESC("The length to be given to *mc_scat_order*. Note that"
                " scattering orders equal and above this value will not"
                " be counted.",
                "Interpolation order of temperature for scattering data (so"
                " far only applied in phase matrix, not in extinction and"
-               " absorption.")));
+               " absorption.",
+               "Number of threads tracing photons. 1 gives the serial"
+               " algorithm, 0 uses all available threads. With more than"
+               " one thread, each thread gets its own random number stream"
+               " derived from *mc_seed*, and the result is reproducible for"
+               " a given *mc_seed* and number of threads.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("MCRadar"),
@@ -10255,14 +10345,19 @@ void define_md_data_raw() {
          "mc_max_scatorder",
          "mc_seed",
          "mc_max_iter"),
-      GIN("ze_tref", "k2", "t_interp_order"),
-      GIN_TYPE("Numeric", "Numeric", "Index"),
-      GIN_DEFAULT("273.15", "-1", "1"),
+      GIN("ze_tref", "k2", "t_interp_order", "nthreads"),
+      GIN_TYPE("Numeric", "Numeric", "Index", "Index"),
+      GIN_DEFAULT("273.15", "-1", "1", "1"),
       GIN_DESC("Reference temperature for conversion to Ze.",
                "Reference dielectric factor.",
                "Interpolation order of temperature for scattering data (so"
                " far only applied in phase matrix, not in extinction and"
-               " absorption.")));
+               " absorption.",
+               "Number of threads tracing photons. 1 gives the serial"
+               " algorithm, 0 uses all available threads. With more than"
+               " one thread, each thread gets its own random number stream"
+               " derived from *mc_seed*, and the result is reproducible for"
+               " a given *mc_seed* and number of threads.")));
 
   md_data_raw.push_back(
       create_mdrecord(NAME("MCSetSeedFromTime"),
@@ -11772,6 +11867,25 @@ void define_md_data_raw() {
       GIN_DEFAULT("3"),
       GIN_DESC("Number of zenith angles per position")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppathCacheClear"),
+      DESCRIPTION(
+          "Removes all paths from the cache of *ppathStepByStepCached*.\n"
+          "\n"
+          "The cache is not cleared when the atmosphere changes, as the\n"
+          "cached paths are identified by all input they depend on. Use this\n"
+          "method to release the memory of the cache.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ppathCalc"),
       DESCRIPTION(
@@ -12048,6 +12162,53 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppathStepByStepCached"),
+      DESCRIPTION(
+          "As *ppathStepByStep*, but reuses earlier calculated paths.\n"
+          "\n"
+          "Propagation paths that only depend on geometry are kept in a cache\n"
+          "shared by all threads, and repeated calculations with the same\n"
+          "geometry skip the path stepping. This is useful when only the\n"
+          "atmospheric state changes between calculations, for example in\n"
+          "*ybatchCalc* over profiles on a fixed *z_field*.\n"
+          "\n"
+          "Only 1D paths without refraction, i.e. where *ppath_step_agenda*\n"
+          "uses *ppath_stepGeometric*, are cached. They are identified by\n"
+          "*p_grid*, *z_field*, *refellipsoid*, *z_surface*, the cloudbox,\n"
+          "*rte_pos*, *rte_los*, *ppath_lmax*, *ppath_lraytrace* and\n"
+          "*ppath_inside_cloudbox_do*. Other paths are calculated as by\n"
+          "*ppathStepByStep*. At most 1000 paths are kept.\n"
+          "\n"
+          "The cache is kept for the whole ARTS process, also between\n"
+          "workspaces. Use *ppathCacheClear* to empty it, and\n"
+          "*ppathStepByStep* to calculate paths without the cache.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("ppath"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("ppath_step_agenda",
+         "ppath_inside_cloudbox_do",
+         "atmosphere_dim",
+         "p_grid",
+         "lat_grid",
+         "lon_grid",
+         "z_field",
+         "f_grid",
+         "refellipsoid",
+         "z_surface",
+         "cloudbox_on",
+         "cloudbox_limits",
+         "rte_pos",
+         "rte_los",
+         "ppath_lmax",
+         "ppath_lraytrace"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ppathWriteXMLPartial"),
       DESCRIPTION(
@@ -12109,6 +12270,53 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppath_stepRefractionAdaptive"),
+      DESCRIPTION(
+          "As *ppath_stepRefractionBasic*, but with adaptive ray tracing\n"
+          "step lengths.\n"
+          "\n"
+          "The length of each ray tracing step is selected from an estimate\n"
+          "of the error of the change of the zenith angle (and azimuth angle\n"
+          "for 3D) over the step. The estimate is the difference to a scheme\n"
+          "of one order higher, using the mean of the bending rates at the\n"
+          "two ends of the step. The length is set to keep this error close\n"
+          "to *za_tolerance* [deg], but never becomes shorter than\n"
+          "*ppath_lraytrace* or longer than *lraytrace_max*. The refractive\n"
+          "index is evaluated once per ray tracing step, as for the basic\n"
+          "method.\n"
+          "\n"
+          "Where the refractive index changes slowly, such as in the upper\n"
+          "atmosphere, considerably longer steps can be taken than with a\n"
+          "fixed *ppath_lraytrace*, while the short steps are kept where\n"
+          "they are needed, e.g. close to the surface and for limb\n"
+          "sounding tangent points. Setting *za_tolerance* to 0 gives the\n"
+          "same result as *ppath_stepRefractionBasic*.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("ppath_step"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("refr_index_air_agenda",
+         "ppath_step",
+         "atmosphere_dim",
+         "p_grid",
+         "lat_grid",
+         "lon_grid",
+         "z_field",
+         "t_field",
+         "vmr_field",
+         "refellipsoid",
+         "z_surface",
+         "f_grid",
+         "ppath_lmax",
+         "ppath_lraytrace"),
+      GIN("za_tolerance", "lraytrace_max"),
+      GIN_TYPE("Numeric", "Numeric"),
+      GIN_DEFAULT("1e-5", "10e3"),
+      GIN_DESC("Allowed error of the direction per ray tracing step [deg].",
+               "Maximum length of ray tracing steps [m].")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ppath_stepRefractionBasic"),
       DESCRIPTION(
@@ -12223,6 +12431,32 @@ void define_md_data_raw() {
                USES_TEMPLATES(true),
                PASSWORKSPACE(true)));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ProfilingStart"),
+      DESCRIPTION(
+          "Starts profiling of agendas and workspace methods.\n"
+          "\n"
+          "From here on, wall time, call count and thread of every agenda\n"
+          "execution and every method call are recorded, including agendas\n"
+          "executed inside other methods such as *ybatchCalc* or *iyCalc*.\n"
+          "At exit, a flat profile is written to <basename>.profile.txt\n"
+          "and a trace in Chrome trace event format to <basename>.trace.json.\n"
+          "The trace can be viewed in chrome://tracing or Perfetto. It keeps\n"
+          "at most 100000 events per thread, the flat profile counts all.\n"
+          "\n"
+          "Profiling can also be switched on for the whole run with the\n"
+          "commandline option --profile.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ZFromPSimple"),
       DESCRIPTION(
@@ -12351,7 +12585,8 @@ void define_md_data_raw() {
           "interpolation is controlled by *abs_f_interp_order*. If this is zero,\n"
           "then f_grid must either be the same as the internal frequency grid of\n"
           "the lookup table (for efficiency reasons, only the first and last\n"
-          "element of f_grid are checked), or must have only a single element.\n"
+          "element of f_grid are checked), or must consist of frequencies of\n"
+          "the lookup table, e.g. a single one.\n"
           "If *abs_f_interp_order* is above zero, then frequency is interpolated\n"
           "along with the other interpolation dimensions. This is useful for\n"
           "calculations with Doppler shift.\n"
@@ -14079,6 +14314,12 @@ void define_md_data_raw() {
                   "\t\"Post2004\"\t-\tfor new format\n"
                   "\t\"Online\"\t-\tfor the online format with quantum numbers (highly experimental)\n"
                   "\n"
+                  "If an index of the file exists, written by *WriteHITRANIndex*,\n"
+                  "reading starts close to *fmin* instead of at the start of the\n"
+                  "file. The file is read until the first line above *fmax*. The\n"
+                  "records are parsed in parallel, and the lines are sorted into\n"
+                  "bands in parallel over isotopologues.\n"
+                  "\n"
                   "Be careful setting the options!\n"
       ),
       AUTHORS("Hermann Berg", "Thomas Kuhn", "Richard Larsson"),
@@ -15805,6 +16046,36 @@ void define_md_data_raw() {
       GIN_DESC("List of names of single scattering data files.",
                "List of names of the corresponding pnd_field files.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ScatElementsWriteIndexed"),
+      DESCRIPTION(
+          "Converts single scattering data files to the indexed binary format.\n"
+          "\n"
+          "For each file, the single scattering data are written to a file in\n"
+          "the directory where the XML file is found, which can be in the\n"
+          "include path, with the ending '.xml*' replaced by '.ssdi'.\n"
+          "*ScatSpeciesScatAndMetaReadSubset* reads these files in place of\n"
+          "the XML files, and then only loads the frequencies and temperatures\n"
+          "that are needed.\n"
+          "\n"
+          "The data are stored uncompressed in native byte order. The files\n"
+          "can only be read on machines with the same byte order. The meta\n"
+          "data files are not converted.\n"
+          "\n"
+          "The size and modification time of the XML file are stored in the\n"
+          "indexed file. If the XML file has changed since, the indexed file\n"
+          "is ignored and the XML file is read.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("scat_data_files"),
+      GIN_TYPE("ArrayOfString"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Array of single scattering data file names.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ScatSpeciesExtendTemperature"),
       DESCRIPTION(
@@ -16011,6 +16282,46 @@ void define_md_data_raw() {
       GIN_DEFAULT(NODEF),
       GIN_DESC("Array of single scattering data file names.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ScatSpeciesScatAndMetaReadSubset"),
+      DESCRIPTION(
+          "As *ScatSpeciesScatAndMetaRead*, but only keeps the single\n"
+          "scattering data that are needed for *f_grid* and a range of\n"
+          "temperatures.\n"
+          "\n"
+          "Of the frequencies, only those used for interpolating the data to\n"
+          "*f_grid* by *scat_dataCalc* with the given *interp_order* are kept.\n"
+          "The result of *scat_dataCalc* is hence the same as with the full\n"
+          "data. Of the temperatures, those used for interpolating the data to\n"
+          "the ends of *T_range* with *T_interp_order* are kept. Higher\n"
+          "orders hence keep neighbours outside of *T_range*. *T_range* must\n"
+          "cover all temperatures of the calculation, and *T_interp_order*\n"
+          "must not be below the order used with the data (for example\n"
+          "*t_interp_order* of *iyHybrid*). An empty *T_range* keeps all\n"
+          "temperatures.\n"
+          "\n"
+          "If a scattering element has a file in the indexed format, written\n"
+          "by *ScatElementsWriteIndexed*, it is read instead of the XML file,\n"
+          "unless the XML file has changed since. The indexed file is looked\n"
+          "for in the directory where the XML file is found, which can be in\n"
+          "the include path. Only the needed parts of the data are then read\n"
+          "from disk, which saves time and memory. Otherwise, the XML file is\n"
+          "read and the data are reduced directly after reading. The\n"
+          "scattering elements are read in parallel.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("scat_data_raw", "scat_meta"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("scat_data_raw", "scat_meta", "f_grid"),
+      GIN("scat_data_files", "interp_order", "T_range", "T_interp_order"),
+      GIN_TYPE("ArrayOfString", "Index", "Vector", "Index"),
+      GIN_DEFAULT(NODEF, "1", "[]", "1"),
+      GIN_DESC("Array of single scattering data file names.",
+               "Interpolation order used by *scat_dataCalc*.",
+               "Minimum and maximum temperature of the calculation [K].",
+               "Interpolation order in temperature used with the data.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("scat_data_singleTmatrix"),
       DESCRIPTION(
@@ -17224,6 +17535,52 @@ void define_md_data_raw() {
       GIN_DEFAULT(".1e9"),
       GIN_DESC("Desired grid spacing in Hz.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("sensor_responseFromAgendaCached"),
+      DESCRIPTION(
+          "Executes *sensor_response_agenda*, with results cached on disk.\n"
+          "\n"
+          "Setting up the sensor response can take considerable time, for\n"
+          "example with *sensor_responseMetMM* or *sensor_responseGenericAMSU*.\n"
+          "This method stores the output of *sensor_response_agenda* in a file\n"
+          "in *cache_dir*. The file name contains a hash of the methods of the\n"
+          "agenda and of the values of all workspace variables that these\n"
+          "methods read. If a file with a matching hash exists, the sensor\n"
+          "response is read from it and the agenda is not executed.\n"
+          "\n"
+          "Files read by the agenda, e.g. by *ReadXML*, enter the hash with\n"
+          "their size and modification time, so changing such a file gives a\n"
+          "new cache entry. This requires that the file name is given as a\n"
+          "String. Files found by a default name, as *ReadXML* with an empty\n"
+          "filename, and files read indirectly, e.g. through an include in a\n"
+          "read file, are not detected. Clear the cache after changing them.\n"
+          "\n"
+          "Cache files are read through a memory map, and are written under a\n"
+          "temporary name and then renamed. Several processes can thus share a\n"
+          "cache directory. The files are stored in the native byte order and\n"
+          "are intended for machines of the same type. A file written with\n"
+          "another byte order is detected by a marker in its header, and is\n"
+          "then recalculated and overwritten. Numeric values enter the hash\n"
+          "with 17 significant digits. Old cache files are never removed by\n"
+          "ARTS.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("sensor_response",
+          "sensor_response_f",
+          "sensor_response_f_grid",
+          "sensor_response_pol",
+          "sensor_response_pol_grid",
+          "sensor_response_dlos",
+          "sensor_response_dlos_grid",
+          "mblock_dlos_grid"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("f_backend", "sensor_response_agenda"),
+      GIN("cache_dir"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Directory of the cache files.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("sensor_responseGenericAMSU"),
       DESCRIPTION(
@@ -17298,6 +17655,70 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("SetFftwWisdomFile"),
+      DESCRIPTION(
+          "Uses FFTW wisdom for the pressure broadening of HITRAN cross\n"
+          "sections.\n"
+          "\n"
+          "The FFTW plans of the convolution in *abs_xsec_per_speciesAddHitranXsec*\n"
+          "are created once per transform length and reused by all threads.\n"
+          "Without wisdom, plans are estimated. After this method, wisdom is\n"
+          "imported from the file, if it exists, new plans are measured, and\n"
+          "the accumulated wisdom is written back to the file after each new\n"
+          "plan. Measured plans can be faster, but the cross sections can\n"
+          "differ in the last digits from those with estimated plans.\n"
+          "\n"
+          "Call this method before any cross sections are calculated. Plans\n"
+          "that already exist are kept. An empty filename switches back to\n"
+          "estimated plans without wisdom.\n"
+          "\n"
+          "Throws if ARTS was compiled without FFTW and the filename is not\n"
+          "empty.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the wisdom file.")));
+
+  md_data_raw.push_back(create_mdrecord(
+      NAME("SetLinePruningTolerance"),
+      DESCRIPTION(
+          "Skips lines that contribute negligibly to their band.\n"
+          "\n"
+          "For every band, pressure and temperature, the contribution of each\n"
+          "line is estimated as its line strength times the larger of its\n"
+          "Lorentz and Doppler profiles at the *f_grid* point closest to its\n"
+          "line center. Lines whose estimate is below *tolerance* times the\n"
+          "largest estimate of the band are not computed. This saves most of\n"
+          "the line-by-line work when a narrow *f_grid* is used together with\n"
+          "a full line catalogue.\n"
+          "\n"
+          "Bands in non-LTE and lines with line parameter Jacobians are never\n"
+          "pruned. A tolerance of 0 switches pruning off.\n"
+          "\n"
+          "The tolerance is not stored in the workspace. It is a setting of\n"
+          "the ARTS process and is used by all following line-by-line\n"
+          "absorption calculations in every workspace and thread, also by\n"
+          "other compute server sessions or Python API workspaces, until the\n"
+          "method is called again. Reset it with a tolerance of 0 when other\n"
+          "calculations of the process must not be pruned.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("tolerance"),
+      GIN_TYPE("Numeric"),
+      GIN_DEFAULT("0"),
+      GIN_DESC("Relative tolerance, e.g. 1e-6.")));
+
   md_data_raw.push_back(
       create_mdrecord(NAME("SetNumberOfThreads"),
                DESCRIPTION("Change the number of threads used by ARTS.\n"),
@@ -17311,6 +17732,44 @@ void define_md_data_raw() {
                GIN_TYPE("Index"),
                GIN_DEFAULT(NODEF),
                GIN_DESC("Number of threads.")));
+
+  md_data_raw.push_back(create_mdrecord(
+      NAME("SetVoigtKernel"),
+      DESCRIPTION(
+          "Selects how the Faddeeva function of Voigt line shapes is evaluated.\n"
+          "\n"
+          "The kernel is not a workspace variable but a setting of the whole\n"
+          "ARTS process. It applies to all following line-by-line absorption\n"
+          "calculations, including line cutoffs and Zeeman components, in\n"
+          "every workspace and thread of the process, e.g. all sessions of the\n"
+          "compute server or all workspaces of the Python API. It stays in\n"
+          "effect until this method is called again. Available kernels:\n"
+          "\n"
+          "  \"Faddeeva\": The default. One frequency at a time with\n"
+          "      Faddeeva::w, accurate to full double precision.\n"
+          "  \"Weideman\": Whole frequency grids at a time in vectorised\n"
+          "      loops. Weideman's 32-term rational approximation is used\n"
+          "      close to the line center and a 12-point Gauss-Hermite\n"
+          "      quadrature further out. The relative error of the complex\n"
+          "      line shape is below 1e-12. The relative error of absorption\n"
+          "      and dispersion separately is below 1e-7 where the ratio of\n"
+          "      pressure to Doppler broadening is at least 1e-4. Below that,\n"
+          "      the relative error of the absorption far out in the line\n"
+          "      wings can be larger, while the absolute error is still\n"
+          "      below 1e-12 of the line shape magnitude.\n"
+          "\n"
+          "The vectorised loops profit from compiling ARTS for the native\n"
+          "CPU, e.g. with -march=native for AVX2 or AVX-512.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("kernel"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT("Faddeeva"),
+      GIN_DESC("Name of the kernel, \"Faddeeva\" or \"Weideman\".")));
   
   md_data_raw.push_back(create_mdrecord(
       NAME("Sleep"),
@@ -18556,6 +19015,37 @@ void define_md_data_raw() {
                "The maximum allowed distance for nearest neighbor"
                " interpolation in meters.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("telsemStandaloneBatch"),
+      DESCRIPTION(
+          "Stand-alone evaluation of the Telsem model for many positions.\n"
+          "\n"
+          "As *telsemStandalone*, but for vectors of latitudes, longitudes\n"
+          "and incidence angles, all of the same length. The positions are\n"
+          "sorted by atlas cell and processed in parallel. The angular\n"
+          "dependence is evaluated once per position, and the frequency\n"
+          "interpolation for all frequencies at once.\n"
+          "\n"
+          "The output has size [position, frequency, 2], with the vertical\n"
+          "and horizontal emissivity in the last dimension.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT("emissivities"),
+      GOUT_TYPE("Tensor3"),
+      GOUT_DESC("The computed v and h emissivites"),
+      IN(),
+      GIN("lat", "lon", "theta", "f", "ta", "d_max"),
+      GIN_TYPE(
+          "Vector", "Vector", "Vector", "Vector", "TelsemAtlas", "Numeric"),
+      GIN_DEFAULT(NODEF, NODEF, NODEF, NODEF, NODEF, "-1"),
+      GIN_DESC("The latitudes for which to compute the emissivities.",
+               "The longitudes for which to compute the emissivities.",
+               "The incidence angles.",
+               "The frequencies for which to compute the emissivities.",
+               "The Telsem atlas to use.",
+               "The maximum allowed distance for nearest neighbor"
+               " interpolation in meters.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("telsemAtlasLookup"),
       DESCRIPTION(
@@ -19978,6 +20468,32 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("WriteHITRANIndex"),
+      DESCRIPTION(
+          "Writes a frequency index of a HITRAN .par file.\n"
+          "\n"
+          "The index is written to the file name of the HITRAN file with\n"
+          "'.index' appended. It lists the position of every 1024th record of\n"
+          "the file together with its frequency. *ReadHITRAN* uses the index\n"
+          "to start reading close to its lower frequency limit, so that\n"
+          "reading a narrow frequency range from a large catalogue does not\n"
+          "require scanning the file from the start.\n"
+          "\n"
+          "The HITRAN file must be sorted by frequency. The index holds the size\n"
+          "of the HITRAN file, and is ignored by *ReadHITRAN* if the file has\n"
+          "changed size. Rerun this method when the HITRAN file is changed.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the HITRAN file")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("WriteMolTau"),
       DESCRIPTION(
@@ -20658,7 +21174,40 @@ void define_md_data_raw() {
           "\n"
           "The Jacobian provided (*jacobian*) is adopted to selected retrieval\n"
           "units, but no transformations are applied. Transformations are\n"
-          "included by calling *jacobianAdjustAndTransform*.\n"),
+          "included by calling *jacobianAdjustAndTransform*.\n"
+          "\n"
+          "With few measurement blocks and pencil beams, there is not enough\n"
+          "work to keep all threads busy. If *f_chunk_size* is set, *f_grid*\n"
+          "is then split into chunks of this many frequencies, and each\n"
+          "combination of measurement block and chunk is calculated by its\n"
+          "own *iy_main_agenda* call, in parallel. The agendas then see only\n"
+          "a part of *f_grid*. This is only valid for clear-sky calculations\n"
+          "where all frequency dependent input is derived from *f_grid*\n"
+          "inside the agendas. Input with one value per frequency of the full\n"
+          "*f_grid*, such as *surface_reflectivity*,\n"
+          "*surface_scalar_reflectivity* or a precalculated transmitted\n"
+          "signal, does not match a chunk and must not be combined with\n"
+          "*f_chunk_size*. Methods that check the size\n"
+          "of such input fail, others may silently use the wrong values.\n"
+          "Chunking is not applied when the cloudbox is on.\n"
+          "\n"
+          "Jacobians of *jacobianAddPointingZa* with the \"recalc\" method\n"
+          "rerun the radiative transfer inside *jacobian_agenda*. If the\n"
+          "measurement blocks are not calculated in parallel, these reruns\n"
+          "are still made in parallel over the measurement blocks, after\n"
+          "the unperturbed spectra of all blocks have been calculated. With\n"
+          "a single measurement block, the rerun is only parallel over the\n"
+          "pencil beams.\n"
+          "\n"
+          "There is no general perturbation engine that perturbs each of\n"
+          "*jacobian_quantities* and runs the perturbed states in parallel.\n"
+          "The pointing \"recalc\" is the only retrieval quantity that reruns\n"
+          "the forward model. All others are analytical or are derived from\n"
+          "the unperturbed spectra. This holds also\n"
+          "for *yCalc* inside *inversion_iterate_agenda* of *OEM*. Jacobians\n"
+          "by perturbation of other quantities are made with *ybatchCalc*\n"
+          "and *jacobianFromYbatch*, where the perturbed states run in\n"
+          "parallel but are set up by *ybatch_calc_agenda*.\n"),
       AUTHORS("Patrick Eriksson"),
       OUT("y", "y_f", "y_pol", "y_pos", "y_los", "y_aux", "y_geo", "jacobian"),
       GOUT(),
@@ -20689,10 +21238,15 @@ void define_md_data_raw() {
          "jacobian_do",
          "jacobian_quantities",
          "iy_aux_vars"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("f_chunk_size"),
+      GIN_TYPE("Index"),
+      GIN_DEFAULT("0"),
+      GIN_DESC(
+          "Number of frequencies per chunk, 0 for no chunking. Each chunk\n"
+          "is one *iy_main_agenda* call, so its absorption and radiative\n"
+          "transfer run in sequence. Only different chunks overlap, on\n"
+          "different threads. *sensor_response* is applied per measurement\n"
+          "block, after all its chunks are done.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("yCalcAppend"),
@@ -59,7 +59,7 @@ void nca_read_from_file(const int ncid, GasAbsLookup& gal, const Verbosity&) {
   nca_get_data_Vector(ncid, "t_ref", gal.t_ref, true);
   nca_get_data_Vector(ncid, "t_pert", gal.t_pert, true);
   nca_get_data_Vector(ncid, "nls_pert", gal.nls_pert, true);
-  nca_get_data_Tensor4(ncid, "xsec", gal.xsec, true);
+  nca_get_data_Tensor4(ncid, "xsec", gal.Xsec(), true);
 }
 
 //! Writes a GasAbsLookup table to a NetCDF file
@@ -144,7 +144,10 @@ void nca_write_to_file(const int ncid,
   int t_ref_varid = nca_def_Vector(ncid, "t_ref", gal.t_ref);
   int t_pert_varid = nca_def_Vector(ncid, "t_pert", gal.t_pert);
   int nls_pert_varid = nca_def_Vector(ncid, "nls_pert", gal.nls_pert);
-  int xsec_varid = nca_def_Tensor4(ncid, "xsec", gal.xsec);
+  // A memory mapped table has its cross-sections in the mapped file
+  Tensor4 mapped_xsec;
+  const Tensor4& xsec = gal.XsecForOutput(mapped_xsec);
+  int xsec_varid = nca_def_Tensor4(ncid, "xsec", xsec);
 
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
 
@@ -166,7 +169,7 @@ void nca_write_to_file(const int ncid,
   nca_put_var_Vector(ncid, t_ref_varid, gal.t_ref);
   nca_put_var_Vector(ncid, t_pert_varid, gal.t_pert);
   nca_put_var_Vector(ncid, nls_pert_varid, gal.nls_pert);
-  nca_put_var_Tensor4(ncid, xsec_varid, gal.xsec);
+  nca_put_var_Tensor4(ncid, xsec_varid, xsec);
 }
 
 ////////////////////////////////////////////////////////////////////////////
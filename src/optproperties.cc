@@ -35,8 +35,14 @@
   ===========================================================================*/
 
 #include "optproperties.h"
+#include <sys/stat.h>
+#include <unistd.h>
 #include <cfloat>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <stdexcept>
 #include "array.h"
 #include "arts.h"
@@ -2696,3 +2702,541 @@ String PTypeToString(const ParticleSSDMethod& particle_ssdmethod) {
 
   return particle_ssdmethod_string;
 }
+
+//! Determine the frequency and temperature ranges of SSD that are needed.
+/*!
+  The frequency range holds all points used for polynomial interpolation
+  of the data to f_grid (as done by scat_dataCalc). Interpolating the
+  reduced data gives the same result as interpolating the full data. The
+  temperature range likewise holds all points used for polynomial
+  interpolation of the data to the ends of T_range, which for a
+  T_interp_order above 1 includes neighbours outside of T_range.
+
+  The full ranges are returned for an empty f_grid or T_range, and for
+  grids with a single element.
+
+  \param[out] f_start       Index of first frequency to keep.
+  \param[out] nf            Number of frequencies to keep.
+  \param[out] T_start       Index of first temperature to keep.
+  \param[out] nT            Number of temperatures to keep.
+  \param[in]  ssd_f_grid    Frequency grid of the SSD.
+  \param[in]  ssd_T_grid    Temperature grid of the SSD.
+  \param[in]  f_grid        Frequencies that will be used, or empty.
+  \param[in]  interp_order  Order of the frequency interpolation.
+  \param[in]  T_range       Minimum and maximum temperature that will be
+                            used, or empty.
+  \param[in]  T_interp_order  Order of the temperature interpolation.
+
+  \date   2026-10-15
+*/
+void ssd_subset_ranges(  //Output
+    Index& f_start,
+    Index& nf,
+    Index& T_start,
+    Index& nT,
+    //Input
+    ConstVectorView ssd_f_grid,
+    ConstVectorView ssd_T_grid,
+    ConstVectorView f_grid,
+    const Index& interp_order,
+    ConstVectorView T_range,
+    const Index& T_interp_order) {
+  f_start = 0;
+  nf = ssd_f_grid.nelem();
+  if (f_grid.nelem() && nf > 1) {
+    chk_interpolation_grids(
+        "scat_data_raw.f_grid to f_grid", ssd_f_grid, f_grid, interp_order);
+
+    ArrayOfGridPosPoly f_gp(f_grid.nelem());
+    gridpos_poly(f_gp, ssd_f_grid, f_grid, interp_order);
+
+    Index i_min = nf, i_max = 0;
+    for (const auto& gp : f_gp)
+      for (const auto& i : gp.idx) {
+        i_min = min(i_min, i);
+        i_max = max(i_max, i);
+      }
+    f_start = i_min;
+    nf = i_max - i_min + 1;
+  }
+
+  T_start = 0;
+  nT = ssd_T_grid.nelem();
+  if (T_range.nelem() && nT > 1) {
+    if (T_range.nelem() != 2 || T_range[0] > T_range[1]) {
+      ostringstream os;
+      os << "The temperature range must have two elements, minimum and\n"
+         << "maximum temperature, but is " << T_range << ".";
+      throw runtime_error(os.str());
+    }
+
+    // The interpolation stencils of temperatures inside T_range lie between
+    // the ones of its ends. Temperatures outside of the grid are treated as
+    // its end points.
+    Vector T_ends(2);
+    for (Index i = 0; i < 2; i++)
+      T_ends[i] = min(max(T_range[i], ssd_T_grid[0]), ssd_T_grid[nT - 1]);
+
+    ArrayOfGridPosPoly T_gp(2);
+    gridpos_poly(T_gp, ssd_T_grid, T_ends, min(T_interp_order, nT - 1));
+
+    Index i_min = nT, i_max = 0;
+    for (const auto& gp : T_gp)
+      for (const auto& i : gp.idx) {
+        i_min = min(i_min, i);
+        i_max = max(i_max, i);
+      }
+    T_start = i_min;
+    nT = i_max - i_min + 1;
+  }
+}
+
+//! Check that the data of SSD match its frequency and temperature grids.
+static void ssd_chk_ft_size(const Index& nf,
+                            const Index& nT,
+                            const Index& pha_nf,
+                            const Index& pha_nT,
+                            const Index& ext_nf,
+                            const Index& ext_nT,
+                            const Index& abs_nf,
+                            const Index& abs_nT) {
+  if (pha_nf != nf || ext_nf != nf || abs_nf != nf || pha_nT != nT ||
+      ext_nT != nT || abs_nT != nT) {
+    ostringstream os;
+    os << "The frequency and temperature dimensions of the single scattering\n"
+       << "data do not match its grids (" << nf << " frequencies and " << nT
+       << " temperatures).";
+    throw runtime_error(os.str());
+  }
+}
+
+//! Reduce SSD to ranges of frequencies and temperatures.
+/*!
+  \param[in,out] ssd      Single scattering data.
+  \param[in]     f_start  Index of first frequency to keep.
+  \param[in]     nf       Number of frequencies to keep.
+  \param[in]     T_start  Index of first temperature to keep.
+  \param[in]     nT       Number of temperatures to keep.
+
+  \date   2026-10-15
+*/
+void ssd_subset(  //Output and Input
+    SingleScatteringData& ssd,
+    //Input
+    const Index& f_start,
+    const Index& nf,
+    const Index& T_start,
+    const Index& nT) {
+  ssd_chk_ft_size(ssd.f_grid.nelem(),
+                  ssd.T_grid.nelem(),
+                  ssd.pha_mat_data.nlibraries(),
+                  ssd.pha_mat_data.nvitrines(),
+                  ssd.ext_mat_data.nshelves(),
+                  ssd.ext_mat_data.nbooks(),
+                  ssd.abs_vec_data.nshelves(),
+                  ssd.abs_vec_data.nbooks());
+
+  if (nf == ssd.f_grid.nelem() && nT == ssd.T_grid.nelem()) return;
+
+  const Range fr(f_start, nf);
+  const Range tr(T_start, nT);
+
+  Vector f_grid = ssd.f_grid[fr];
+  Vector T_grid = ssd.T_grid[tr];
+  Tensor7 pha_mat_data =
+      ssd.pha_mat_data(fr, tr, joker, joker, joker, joker, joker);
+  Tensor5 ext_mat_data = ssd.ext_mat_data(fr, tr, joker, joker, joker);
+  Tensor5 abs_vec_data = ssd.abs_vec_data(fr, tr, joker, joker, joker);
+
+  ssd.f_grid = std::move(f_grid);
+  ssd.T_grid = std::move(T_grid);
+  ssd.pha_mat_data = std::move(pha_mat_data);
+  ssd.ext_mat_data = std::move(ext_mat_data);
+  ssd.abs_vec_data = std::move(abs_vec_data);
+}
+
+//! Header of the indexed SSD file format.
+/*!
+  The header is followed by the description, by the frequency, temperature,
+  zenith and azimuth angle grids as their size followed by the raw
+  Numerics, and by the raw data of pha_mat_data, ext_mat_data and
+  abs_vec_data, all in native byte order. As frequency and temperature are
+  the two leading dimensions of the data, each temperature range at one
+  frequency is a contiguous block of the file.
+
+  The size and modification time of the XML file the data was converted
+  from are stored, so that an indexed file that is older than its XML file
+  can be detected.
+*/
+struct IndexedSsdHeader {
+  char magic[8];
+  std::uint64_t version;
+  std::uint64_t byte_order;
+  std::int64_t source_size;
+  std::int64_t source_mtime;
+  std::int64_t ptype;
+  std::int64_t description_length;
+  std::int64_t pha_mat_shape[7];
+  std::int64_t ext_mat_shape[5];
+  std::int64_t abs_vec_shape[5];
+};
+
+static const char indexed_ssd_magic[8] = {
+    'A', 'R', 'T', 'S', 'S', 'S', 'D', '\0'};
+static const std::uint64_t indexed_ssd_version = 2;
+static const std::uint64_t indexed_ssd_byte_order = 0x0102030405060708ULL;
+
+//! Size and modification time of the source of an indexed SSD file.
+/*!
+  \param[out] size      File size, -1 if the file can not be found.
+  \param[out] mtime     Modification time, -1 if the file can not be found.
+  \param[in]  filename  Name of the file.
+*/
+static void indexed_ssd_source_stamp(std::int64_t& size,
+                                     std::int64_t& mtime,
+                                     const String& filename) {
+  struct stat st;
+  if (filename.nelem() && stat(filename.c_str(), &st) == 0) {
+    size = st.st_size;
+    mtime = st.st_mtime;
+  } else {
+    size = -1;
+    mtime = -1;
+  }
+}
+
+//! Write a grid of an indexed SSD file.
+static void write_indexed_grid(std::ostream& os, ConstVectorView v) {
+  const std::int64_t n = v.nelem();
+  os.write(reinterpret_cast<const char*>(&n), sizeof(n));
+  for (Index i = 0; i < v.nelem(); i++) {
+    const Numeric x = v[i];
+    os.write(reinterpret_cast<const char*>(&x), sizeof(Numeric));
+  }
+}
+
+//! Read a grid of an indexed SSD file.
+static void read_indexed_grid(std::istream& is, Vector& v) {
+  std::int64_t n;
+  is.read(reinterpret_cast<char*>(&n), sizeof(n));
+  if (!is || n < 0)
+    throw runtime_error("Corrupt grid in indexed scattering data file.");
+  v.resize(n);
+  if (n)
+    is.read(reinterpret_cast<char*>(v.get_c_array()), n * sizeof(Numeric));
+}
+
+//! Write SSD in the indexed binary format.
+/*!
+  See ssd_read_indexed.
+
+  \param[in]  ssd              Single scattering data.
+  \param[in]  filename         Name of the file to write.
+  \param[in]  source_filename  Name of the XML file the data was read from.
+                               Its size and modification time are stored,
+                               see ssd_indexed_is_current.
+
+  \date   2026-10-15
+*/
+void ssd_write_indexed(const SingleScatteringData& ssd,
+                       const String& filename,
+                       const String& source_filename) {
+  ssd_chk_ft_size(ssd.f_grid.nelem(),
+                  ssd.T_grid.nelem(),
+                  ssd.pha_mat_data.nlibraries(),
+                  ssd.pha_mat_data.nvitrines(),
+                  ssd.ext_mat_data.nshelves(),
+                  ssd.ext_mat_data.nbooks(),
+                  ssd.abs_vec_data.nshelves(),
+                  ssd.abs_vec_data.nbooks());
+
+  IndexedSsdHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, indexed_ssd_magic, sizeof(header.magic));
+  header.version = indexed_ssd_version;
+  header.byte_order = indexed_ssd_byte_order;
+  indexed_ssd_source_stamp(
+      header.source_size, header.source_mtime, source_filename);
+  header.ptype = ssd.ptype;
+  header.description_length = ssd.description.length();
+
+  const Tensor7& pha = ssd.pha_mat_data;
+  const std::int64_t pha_shape[7] = {pha.nlibraries(),
+                                     pha.nvitrines(),
+                                     pha.nshelves(),
+                                     pha.nbooks(),
+                                     pha.npages(),
+                                     pha.nrows(),
+                                     pha.ncols()};
+  memcpy(header.pha_mat_shape, pha_shape, sizeof(pha_shape));
+  const Tensor5* t5[2] = {&ssd.ext_mat_data, &ssd.abs_vec_data};
+  std::int64_t* t5_shape[2] = {header.ext_mat_shape, header.abs_vec_shape};
+  for (Index i = 0; i < 2; i++) {
+    t5_shape[i][0] = t5[i]->nshelves();
+    t5_shape[i][1] = t5[i]->nbooks();
+    t5_shape[i][2] = t5[i]->npages();
+    t5_shape[i][3] = t5[i]->nrows();
+    t5_shape[i][4] = t5[i]->ncols();
+  }
+
+  // Write to a name unique to this process and rename when complete, so
+  // that readers never see a partly written file
+  ostringstream tmpname;
+  tmpname << filename << ".tmp" << getpid();
+
+  {
+    std::ofstream os(tmpname.str(), std::ios::binary | std::ios::trunc);
+    if (!os) {
+      ostringstream err;
+      err << "Cannot open indexed scattering data file " << tmpname.str()
+          << " for writing.";
+      throw runtime_error(err.str());
+    }
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(ssd.description.data(), header.description_length);
+    write_indexed_grid(os, ssd.f_grid);
+    write_indexed_grid(os, ssd.T_grid);
+    write_indexed_grid(os, ssd.za_grid);
+    write_indexed_grid(os, ssd.aa_grid);
+    if (!pha.empty())
+      os.write(reinterpret_cast<const char*>(pha.get_c_array()),
+               pha_shape[0] * pha_shape[1] * pha_shape[2] * pha_shape[3] *
+                   pha_shape[4] * pha_shape[5] * pha_shape[6] *
+                   sizeof(Numeric));
+    for (Index i = 0; i < 2; i++)
+      if (!t5[i]->empty())
+        os.write(reinterpret_cast<const char*>(t5[i]->get_c_array()),
+                 t5_shape[i][0] * t5_shape[i][1] * t5_shape[i][2] *
+                     t5_shape[i][3] * t5_shape[i][4] * sizeof(Numeric));
+
+    if (!os) {
+      os.close();
+      std::remove(tmpname.str().c_str());
+      ostringstream err;
+      err << "Error writing indexed scattering data file " << tmpname.str()
+          << ".";
+      throw runtime_error(err.str());
+    }
+  }
+
+  if (std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    std::remove(tmpname.str().c_str());
+    ostringstream err;
+    err << "Cannot move indexed scattering data file into place: " << filename
+        << ".";
+    throw runtime_error(err.str());
+  }
+}
+
+//! Check whether an indexed SSD file is up to date.
+/*!
+  The indexed file is current if it has the version of this reader and the
+  size and modification time of the XML file match the ones stored when the
+  indexed file was written.
+
+  \param[in]  filename         Name of the indexed file.
+  \param[in]  source_filename  Name of the XML file.
+
+  \return  True if the indexed file can be used instead of the XML file.
+
+  \date   2026-10-15
+*/
+bool ssd_indexed_is_current(const String& filename,
+                            const String& source_filename) {
+  std::ifstream is(filename.c_str(), std::ios::binary);
+  IndexedSsdHeader header;
+  is.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!is || memcmp(header.magic, indexed_ssd_magic, sizeof(header.magic)) ||
+      header.version != indexed_ssd_version ||
+      header.byte_order != indexed_ssd_byte_order)
+    return false;
+
+  std::int64_t size, mtime;
+  indexed_ssd_source_stamp(size, mtime, source_filename);
+  return size >= 0 && size == header.source_size &&
+         mtime == header.source_mtime;
+}
+
+//! Read a frequency and temperature range of a data block.
+/*!
+  \param[in]  is        Stream of the file.
+  \param[in]  offset    Position of the data block in the file.
+  \param[in]  shape     Shape of the data block, frequency and temperature
+                        being the first two dimensions.
+  \param[in]  ndims     Number of dimensions.
+  \param[in]  f_start   Index of first frequency to read.
+  \param[in]  nf        Number of frequencies to read.
+  \param[in]  T_start   Index of first temperature to read.
+  \param[in]  nT        Number of temperatures to read.
+  \param[out] data      Start of the output data.
+
+  \return  Position of the end of the block.
+*/
+static std::streamoff read_indexed_block(std::istream& is,
+                                         const std::streamoff offset,
+                                         const std::int64_t* shape,
+                                         const Index ndims,
+                                         const Index f_start,
+                                         const Index nf,
+                                         const Index T_start,
+                                         const Index nT,
+                                         Numeric* data) {
+  std::int64_t slab = 1;
+  for (Index i = 2; i < ndims; i++) slab *= shape[i];
+
+  const std::streamoff bytes = nT * slab * sizeof(Numeric);
+  if (bytes)
+    for (Index i = 0; i < nf; i++) {
+      is.seekg(offset + ((f_start + i) * shape[1] + T_start) * slab *
+                            std::streamoff(sizeof(Numeric)));
+      is.read(reinterpret_cast<char*>(data + i * nT * slab), bytes);
+    }
+
+  return offset + shape[0] * shape[1] * slab * sizeof(Numeric);
+}
+
+//! Read SSD from an indexed binary file.
+/*!
+  Only the frequencies and temperatures selected by ssd_subset_ranges are
+  read from the file. The file must be written by ssd_write_indexed on a
+  machine with the same byte order.
+
+  \param[out] ssd           Single scattering data.
+  \param[in]  filename      Name of the file to read.
+  \param[in]  f_grid        Frequencies that will be used, or empty.
+  \param[in]  interp_order  Order of the frequency interpolation.
+  \param[in]  T_range       Minimum and maximum temperature that will be
+                            used, or empty.
+  \param[in]  T_interp_order  Order of the temperature interpolation.
+
+  \date   2026-10-15
+*/
+void ssd_read_indexed(  //Output
+    SingleScatteringData& ssd,
+    //Input
+    const String& filename,
+    ConstVectorView f_grid,
+    const Index& interp_order,
+    ConstVectorView T_range,
+    const Index& T_interp_order) {
+  std::ifstream is(filename.c_str(), std::ios::binary);
+  if (!is) {
+    ostringstream os;
+    os << "Cannot open indexed scattering data file " << filename << ".";
+    throw runtime_error(os.str());
+  }
+
+  IndexedSsdHeader header;
+  is.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!is || memcmp(header.magic, indexed_ssd_magic, sizeof(header.magic)) ||
+      header.version != indexed_ssd_version) {
+    ostringstream os;
+    os << "The file " << filename
+       << " is not an indexed scattering data file of version "
+       << indexed_ssd_version << ".";
+    throw runtime_error(os.str());
+  }
+  if (header.byte_order != indexed_ssd_byte_order) {
+    ostringstream os;
+    os << "The indexed scattering data file " << filename
+       << " was written on a machine with another byte order.";
+    throw runtime_error(os.str());
+  }
+  if (header.description_length < 0)
+    throw runtime_error("Corrupt indexed scattering data file " + filename);
+
+  ssd.ptype = PType(header.ptype);
+  ssd.description.resize(header.description_length);
+  is.read(&ssd.description[0], header.description_length);
+  read_indexed_grid(is, ssd.f_grid);
+  read_indexed_grid(is, ssd.T_grid);
+  read_indexed_grid(is, ssd.za_grid);
+  read_indexed_grid(is, ssd.aa_grid);
+
+  const std::int64_t* pha_shape = header.pha_mat_shape;
+  const std::int64_t* ext_shape = header.ext_mat_shape;
+  const std::int64_t* abs_shape = header.abs_vec_shape;
+  for (Index i = 0; i < 7; i++)
+    if (pha_shape[i] < 0 || (i < 5 && (ext_shape[i] < 0 || abs_shape[i] < 0)))
+      throw runtime_error("Corrupt indexed scattering data file " + filename);
+  ssd_chk_ft_size(ssd.f_grid.nelem(),
+                  ssd.T_grid.nelem(),
+                  pha_shape[0],
+                  pha_shape[1],
+                  ext_shape[0],
+                  ext_shape[1],
+                  abs_shape[0],
+                  abs_shape[1]);
+
+  Index f_start, nf, T_start, nT;
+  ssd_subset_ranges(f_start,
+                    nf,
+                    T_start,
+                    nT,
+                    ssd.f_grid,
+                    ssd.T_grid,
+                    f_grid,
+                    interp_order,
+                    T_range,
+                    T_interp_order);
+
+  ssd.pha_mat_data.resize(nf,
+                          nT,
+                          pha_shape[2],
+                          pha_shape[3],
+                          pha_shape[4],
+                          pha_shape[5],
+                          pha_shape[6]);
+  ssd.ext_mat_data.resize(
+      nf, nT, ext_shape[2], ext_shape[3], ext_shape[4]);
+  ssd.abs_vec_data.resize(
+      nf, nT, abs_shape[2], abs_shape[3], abs_shape[4]);
+
+  std::streamoff offset = is.tellg();
+  offset = read_indexed_block(is,
+                              offset,
+                              pha_shape,
+                              7,
+                              f_start,
+                              nf,
+                              T_start,
+                              nT,
+                              ssd.pha_mat_data.empty()
+                                  ? nullptr
+                                  : ssd.pha_mat_data.get_c_array());
+  offset = read_indexed_block(is,
+                              offset,
+                              ext_shape,
+                              5,
+                              f_start,
+                              nf,
+                              T_start,
+                              nT,
+                              ssd.ext_mat_data.empty()
+                                  ? nullptr
+                                  : ssd.ext_mat_data.get_c_array());
+  read_indexed_block(is,
+                     offset,
+                     abs_shape,
+                     5,
+                     f_start,
+                     nf,
+                     T_start,
+                     nT,
+                     ssd.abs_vec_data.empty()
+                         ? nullptr
+                         : ssd.abs_vec_data.get_c_array());
+
+  if (!is) {
+    ostringstream os;
+    os << "The indexed scattering data file " << filename
+       << " is truncated.";
+    throw runtime_error(os.str());
+  }
+
+  Vector f_grid_sub = ssd.f_grid[Range(f_start, nf)];
+  Vector T_grid_sub = ssd.T_grid[Range(T_start, nT)];
+  ssd.f_grid = std::move(f_grid_sub);
+  ssd.T_grid = std::move(T_grid_sub);
+}
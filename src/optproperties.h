@@ -338,4 +338,44 @@ ParticleSSDMethod ParticleSSDMethodFromString(
 String ParticleSSDMethodToString(
     const ParticleSSDMethod& particle_ssdmethod_type);
 
+// Reading subsets of single scattering data:
+// ========================================================
+
+void ssd_subset_ranges(  //Output
+    Index& f_start,
+    Index& nf,
+    Index& T_start,
+    Index& nT,
+    //Input
+    ConstVectorView ssd_f_grid,
+    ConstVectorView ssd_T_grid,
+    ConstVectorView f_grid,
+    const Index& interp_order,
+    ConstVectorView T_range,
+    const Index& T_interp_order);
+
+void ssd_subset(  //Output and Input
+    SingleScatteringData& ssd,
+    //Input
+    const Index& f_start,
+    const Index& nf,
+    const Index& T_start,
+    const Index& nT);
+
+void ssd_write_indexed(const SingleScatteringData& ssd,
+                       const String& filename,
+                       const String& source_filename);
+
+bool ssd_indexed_is_current(const String& filename,
+                            const String& source_filename);
+
+void ssd_read_indexed(  //Output
+    SingleScatteringData& ssd,
+    //Input
+    const String& filename,
+    ConstVectorView f_grid,
+    const Index& interp_order,
+    ConstVectorView T_range,
+    const Index& T_interp_order);
+
 #endif  //optproperties_h
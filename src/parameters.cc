@@ -117,6 +117,7 @@ bool get_parameters(int argc, char **argv) {
   struct option longopts[] = {
       {"basename", required_argument, NULL, 'b'},
 #ifdef ENABLE_DOCSERVER
+      {"computeserver", optional_argument, NULL, 'c'},
       {"check-docs", no_argument, NULL, 'C'},
 #endif
       {"describe", required_argument, NULL, 'd'},
@@ -129,6 +130,7 @@ bool get_parameters(int argc, char **argv) {
       {"numthreads", required_argument, NULL, 'n'},
       {"outdir", required_argument, NULL, 'o'},
       {"plain", no_argument, NULL, 'p'},
+      {"profile", no_argument, NULL, 'P'},
       {"reporting", required_argument, NULL, 'r'},
 #ifdef ENABLE_DOCSERVER
       {"docserver", optional_argument, NULL, 's'},
@@ -140,8 +142,11 @@ bool get_parameters(int argc, char **argv) {
       {NULL, no_argument, NULL, 0}};
 
   parameters.usage =
-      "Usage: arts [-bBdghimnrsSvw]\n"
+      "Usage: arts [-bBcdghimnpPrsSvw]\n"
       "       [--basename <name>]\n"
+#ifdef ENABLE_DOCSERVER
+      "       [--computeserver[=<port>]]\n"
+#endif
       "       [--describe <method or variable>]\n"
       "       [--groups]\n"
       "       [--help]\n"
@@ -152,6 +157,7 @@ bool get_parameters(int argc, char **argv) {
       "       [--numthreads <#>\n"
       "       [--outdir <name>]\n"
       "       [--plain]\n"
+      "       [--profile]\n"
       "       [--reporting <xyz>]\n"
 #ifdef ENABLE_DOCSERVER
       "       [--docserver[=<port>] --baseurl=BASEURL]\n"
@@ -164,6 +170,23 @@ bool get_parameters(int argc, char **argv) {
       "The Atmospheric Radiative Transfer Simulator.\n\n"
       "-b, --basename      Set the basename for the report\n"
       "                    file and for other output files.\n"
+#ifdef ENABLE_DOCSERVER
+      "-c, --computeserver Execute the control file and keep its workspace\n"
+      "                    in memory to serve requests on localhost.\n"
+      "                    Optionally, specify the port number, e.g.\n"
+      "                    arts -c9999 or arts --computeserver=9999.\n"
+      "                    Default is 9001. Requests are:\n"
+      "                    PUT /variables/<name> sets a variable from XML,\n"
+      "                    GET /variables/<name>[?format=binary] returns\n"
+      "                    a variable as XML, POST /agendas/<name>\n"
+      "                    executes an agenda. For binary XML, the header\n"
+      "                    X-ARTS-XML-Length gives the length of the XML\n"
+      "                    part before the binary data. Every request\n"
+      "                    must send the access token printed at startup\n"
+      "                    in the header X-ARTS-Token. The token can be\n"
+      "                    set with ARTS_COMPUTESERVER_TOKEN. Stop the\n"
+      "                    server with SIGINT or SIGTERM.\n"
+#endif
       "-d, --describe      Print the description String of the given\n"
       "                    workspace variable or method.\n"
       "-g  --groups        List all workspace variable groups.\n"
@@ -198,6 +221,10 @@ bool get_parameters(int argc, char **argv) {
       "                    Default is the current directory.\n"
       "-p  --plain         Generate plain help output suitable for\n"
       "                    script processing.\n"
+      "-P  --profile       Record wall time and call count of all agendas\n"
+      "                    and workspace methods. A flat profile and a\n"
+      "                    trace in Chrome trace format are written to\n"
+      "                    <basename>.profile.txt and <basename>.trace.json.\n"
       "-r, --reporting     Three digit integer. Sets the reporting\n"
       "                    level for agenda calls (first digit),\n"
       "                    screen (second digit) and file (third \n"
@@ -271,6 +298,18 @@ bool get_parameters(int argc, char **argv) {
       case 'C':
         parameters.check_docs = true;
         break;
+      case 'c': {
+        if (optarg) {
+          istringstream iss(optarg);
+          iss >> std::dec >> parameters.computeserver;
+          if (iss.bad() || !iss.eof()) {
+            cerr << "Argument to --computeserver (-c) must be an integer!\n";
+            arts_exit();
+          }
+        } else
+          parameters.computeserver = -1;
+        break;
+      }
       case 'b':
         parameters.basename = optarg;
         break;
@@ -310,6 +349,9 @@ bool get_parameters(int argc, char **argv) {
       case 'p':
         parameters.plain = true;
         break;
+      case 'P':
+        parameters.profile = true;
+        break;
       case 'r': {
         //      cout << "optarg = " << optarg << endl;
         istringstream iss(optarg);
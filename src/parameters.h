@@ -61,9 +61,11 @@ class Parameters {
         describe(""),
         groups(false),
         plain(false),
+        profile(false),
         docserver(0),
         baseurl(""),
         daemon(false),
+        computeserver(0),
         gui(false),
         check_docs(false) { /* Nothing to be done here */
     }
@@ -121,12 +123,16 @@ class Parameters {
   bool groups;
   /** Generate plain help out suitable for script processing. */
   bool plain;
+  /** Profile agenda and workspace method execution. */
+  bool profile;
   /** Port to use for the docserver. */
   Index docserver;
   /** Baseurl for the docserver. */
   String baseurl;
   /** Flag to run the docserver in the background. */
   bool daemon;
+  /** Port to use for the compute server. */
+  Index computeserver;
   /** Flag to run with graphical user interface. */
   bool gui;
   /** Flag to check built-in documentation */
@@ -34,7 +34,11 @@
 
 #include "ppath.h"
 #include <cmath>
+#include <deque>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include "agenda_class.h"
 #include "array.h"
 #include "arts_omp.h"
@@ -3376,6 +3380,38 @@ void ppath_step_geom_3d(Ppath& ppath,
   === Core functions for refraction *ppath_step* functions
   ===========================================================================*/
 
+/** Length of the next ray tracing step, for adaptive steps.
+
+   The ray tracing functions update the zenith angle with the bending rate
+   (change of direction per length) at the end point of each step. The
+   difference to using the mean of the bending rates at the start and end
+   points, a scheme of one order higher, gives the error estimate
+   0.5 * lstep * dbend. The step length is scaled to bring this estimate
+   to *za_tolerance*, changing by at most a factor of 4 per step. The
+   refractive index is evaluated once per step, as for fixed steps.
+
+   @param[in]   lstep          Length of the step just taken.
+   @param[in]   dbend          Change of the bending rate over the step
+                               [deg/m].
+   @param[in]   za_tolerance   Allowed error of the direction per step [deg].
+   @param[in]   lraytrace_min  Shortest allowed step length.
+   @param[in]   lraytrace_max  Longest allowed step length.
+
+   @return  Length of the next step.
+
+   @date   2026-10-15
+ */
+Numeric raytrace_adapt_lstep(const Numeric& lstep,
+                             const Numeric& dbend,
+                             const Numeric& za_tolerance,
+                             const Numeric& lraytrace_min,
+                             const Numeric& lraytrace_max) {
+  const Numeric err = 0.5 * lstep * dbend;
+  Numeric factor = 4;
+  if (err > 0) factor = min(4.0, max(0.25, 0.9 * sqrt(za_tolerance / err)));
+  return min(lraytrace_max, max(lraytrace_min, factor * lstep));
+}
+
 /** Performs ray tracing for 1D with linear steps.
 
    A geometrical step with length of *lraytrace* is taken from each
@@ -3431,6 +3467,8 @@ void raytrace_1d_linear_basic(Workspace& ws,
                               const Numeric& lmax,
                               const Agenda& refr_index_air_agenda,
                               const Numeric& lraytrace,
+                              const Numeric& za_tolerance,
+                              const Numeric& lraytrace_max,
                               const Numeric& rsurface,
                               const Numeric& r1,
                               const Numeric& r3,
@@ -3440,6 +3478,12 @@ void raytrace_1d_linear_basic(Workspace& ws,
   // Loop boolean
   bool ready = false;
 
+  // Length of ray tracing steps. With za_tolerance > 0, it is adapted
+  // after each step, see raytrace_adapt_lstep.
+  Numeric lraytrace_now = lraytrace;
+  Numeric bend_old = 0;
+  bool has_bend = false;
+
   // Store first point
   Numeric refr_index_air, refr_index_air_group;
   get_refr_index_1d(ws,
@@ -3464,6 +3508,11 @@ void raytrace_1d_linear_basic(Workspace& ws,
   Numeric lstep, lcum = 0, dlat;
 
   while (!ready) {
+    // An adapted step can be longer than lmax. Shorten it to end at lmax,
+    // so that points are never more than lmax apart.
+    if (za_tolerance > 0 && lmax > 0)
+      lraytrace_now = min(lraytrace_now, lmax - lcum);
+
     // Constant for the geometrical step to make
     const Numeric ppc_step = geometrical_ppc(r, za);
 
@@ -3489,7 +3538,7 @@ void raytrace_1d_linear_basic(Workspace& ws,
 
     Numeric za_flagside = za;
 
-    if (lstep <= lraytrace) {
+    if (lstep <= lraytrace_now) {
       r = r_v[1];
       dlat = lat_v[1] - lat;
       lat = lat_v[1];
@@ -3498,9 +3547,9 @@ void raytrace_1d_linear_basic(Workspace& ws,
     } else {
       Numeric l;
       if (za <= 90) {
-        l = geompath_l_at_r(ppc_step, r) + lraytrace;
+        l = geompath_l_at_r(ppc_step, r) + lraytrace_now;
       } else {
-        l = geompath_l_at_r(ppc_step, r) - lraytrace;
+        l = geompath_l_at_r(ppc_step, r) - lraytrace_now;
         if (l < 0) {
           za_flagside = 180 - za_flagside;
         }  // Tangent point passed!
@@ -3512,8 +3561,8 @@ void raytrace_1d_linear_basic(Workspace& ws,
           za, lat, geompath_za_at_r(ppc_step, za_flagside, r));
       dlat = lat_new - lat;
       lat = lat_new;
-      lstep = lraytrace;
-      lcum += lraytrace;
+      lstep = lraytrace_now;
+      lcum += lraytrace_now;
     }
 
     // Refractive index at new point
@@ -3538,6 +3587,19 @@ void raytrace_1d_linear_basic(Workspace& ws,
     //
     za += (RAD2DEG * lstep / refr_index_air) * (-sin(za_rad) * dndr);
 
+    // Adapt step length to change of bending rate
+    if (za_tolerance > 0) {
+      const Numeric bend = (RAD2DEG / refr_index_air) * (-sin(za_rad) * dndr);
+      if (has_bend)
+        lraytrace_now = raytrace_adapt_lstep(lstep,
+                                             abs(bend - bend_old),
+                                             za_tolerance,
+                                             lraytrace,
+                                             lraytrace_max);
+      bend_old = bend;
+      has_bend = true;
+    }
+
     // Make sure that obtained *za* is inside valid range
     if (za < 0) {
       za = -za;
@@ -3546,7 +3608,7 @@ void raytrace_1d_linear_basic(Workspace& ws,
     }
 
     // Store found point?
-    if (ready || (lmax > 0 && lcum + lraytrace > lmax)) {
+    if (ready || (lmax > 0 && lcum + lraytrace_now > lmax)) {
       r_array.push_back(r);
       lat_array.push_back(lat);
       za_array.push_back(za);
@@ -3570,7 +3632,9 @@ void ppath_step_refr_1d(Workspace& ws,
                         const Numeric& lmax,
                         const Agenda& refr_index_air_agenda,
                         const String& rtrace_method,
-                        const Numeric& lraytrace) {
+                        const Numeric& lraytrace,
+                        const Numeric& za_tolerance,
+                        const Numeric& lraytrace_max) {
   // Starting radius, zenith angle and latitude
   Numeric r_start, lat_start, za_start;
 
@@ -3637,6 +3701,8 @@ void ppath_step_refr_1d(Workspace& ws,
                              lmax,
                              refr_index_air_agenda,
                              lraytrace,
+                             za_tolerance,
+                             lraytrace_max,
                              refellipsoid[0] + z_surface,
                              refellipsoid[0] + z_field(ip, 0, 0),
                              refellipsoid[0] + z_field(ip + 1, 0, 0),
@@ -3738,6 +3804,8 @@ void raytrace_2d_linear_basic(Workspace& ws,
                               const Numeric& lmax,
                               const Agenda& refr_index_air_agenda,
                               const Numeric& lraytrace,
+                              const Numeric& za_tolerance,
+                              const Numeric& lraytrace_max,
                               const Numeric& lat1,
                               const Numeric& lat3,
                               const Numeric& rsurface1,
@@ -3752,6 +3820,12 @@ void raytrace_2d_linear_basic(Workspace& ws,
   // Loop boolean
   bool ready = false;
 
+  // Length of ray tracing steps. With za_tolerance > 0, it is adapted
+  // after each step, see raytrace_adapt_lstep.
+  Numeric lraytrace_now = lraytrace;
+  Numeric bend_old = 0;
+  bool has_bend = false;
+
   // Store first point
   Numeric refr_index_air, refr_index_air_group;
   get_refr_index_2d(ws,
@@ -3778,6 +3852,11 @@ void raytrace_2d_linear_basic(Workspace& ws,
   Numeric lstep, lcum = 0, dlat;
 
   while (!ready) {
+    // An adapted step can be longer than lmax. Shorten it to end at lmax,
+    // so that points are never more than lmax apart.
+    if (za_tolerance > 0 && lmax > 0)
+      lraytrace_now = min(lraytrace_now, lmax - lcum);
+
     // Constant for the geometrical step to make
     const Numeric ppc_step = geometrical_ppc(r, za);
 
@@ -3790,7 +3869,7 @@ void raytrace_2d_linear_basic(Workspace& ws,
                            r,
                            lat,
                            za,
-                           lraytrace,
+                           lraytrace_now,
                            0,
                            ppc_step,
                            -1,
@@ -3810,7 +3889,7 @@ void raytrace_2d_linear_basic(Workspace& ws,
 
     Numeric za_flagside = za;
 
-    if (lstep <= lraytrace) {
+    if (lstep <= lraytrace_now) {
       r = r_v[1];
       dlat = lat_v[1] - lat;
       lat = lat_v[1];
@@ -3819,9 +3898,9 @@ void raytrace_2d_linear_basic(Workspace& ws,
     } else {
       Numeric l;
       if (abs(za) <= 90) {
-        l = geompath_l_at_r(ppc_step, r) + lraytrace;
+        l = geompath_l_at_r(ppc_step, r) + lraytrace_now;
       } else {
-        l = geompath_l_at_r(ppc_step, r) - lraytrace;
+        l = geompath_l_at_r(ppc_step, r) - lraytrace_now;
         if (l < 0)  // Tangent point passed!
         {
           za_flagside = sign(za) * 180 - za_flagside;
@@ -3834,8 +3913,8 @@ void raytrace_2d_linear_basic(Workspace& ws,
           za, lat, geompath_za_at_r(ppc_step, za_flagside, r));
       dlat = lat_new - lat;
       lat = lat_new;
-      lstep = lraytrace;
-      lcum += lraytrace;
+      lstep = lraytrace_now;
+      lcum += lraytrace_now;
 
       // For paths along the latitude end faces we can end up outside the
       // grid cell. We simply look for points outisde the grid cell.
@@ -3872,6 +3951,20 @@ void raytrace_2d_linear_basic(Workspace& ws,
     za += (RAD2DEG * lstep / refr_index_air) *
           (-sin(za_rad) * dndr + cos(za_rad) * dndlat);
 
+    // Adapt step length to change of bending rate
+    if (za_tolerance > 0) {
+      const Numeric bend = (RAD2DEG / refr_index_air) *
+                           (-sin(za_rad) * dndr + cos(za_rad) * dndlat);
+      if (has_bend)
+        lraytrace_now = raytrace_adapt_lstep(lstep,
+                                             abs(bend - bend_old),
+                                             za_tolerance,
+                                             lraytrace,
+                                             lraytrace_max);
+      bend_old = bend;
+      has_bend = true;
+    }
+
     // Make sure that obtained *za* is inside valid range
     if (za < -180) {
       za += 360;
@@ -3890,7 +3983,7 @@ void raytrace_2d_linear_basic(Workspace& ws,
     }
 
     // Store found point?
-    if (ready || (lmax > 0 && lcum + lraytrace > lmax)) {
+    if (ready || (lmax > 0 && lcum + lraytrace_now > lmax)) {
       r_array.push_back(r);
       lat_array.push_back(lat);
       za_array.push_back(za);
@@ -3915,7 +4008,9 @@ void ppath_step_refr_2d(Workspace& ws,
                         const Numeric& lmax,
                         const Agenda& refr_index_air_agenda,
                         const String& rtrace_method,
-                        const Numeric& lraytrace) {
+                        const Numeric& lraytrace,
+                        const Numeric& za_tolerance,
+                        const Numeric& lraytrace_max) {
   // Radius, zenith angle and latitude of start point.
   Numeric r_start, lat_start, za_start;
 
@@ -3973,6 +4068,8 @@ void ppath_step_refr_2d(Workspace& ws,
                              lmax,
                              refr_index_air_agenda,
                              lraytrace,
+                             za_tolerance,
+                             lraytrace_max,
                              lat1,
                              lat3,
                              rsurface1,
@@ -4098,6 +4195,8 @@ void raytrace_3d_linear_basic(Workspace& ws,
                               const Numeric& lmax,
                               const Agenda& refr_index_air_agenda,
                               const Numeric& lraytrace,
+                              const Numeric& za_tolerance,
+                              const Numeric& lraytrace_max,
                               const Numeric& lat1,
                               const Numeric& lat3,
                               const Numeric& lon5,
@@ -4122,6 +4221,12 @@ void raytrace_3d_linear_basic(Workspace& ws,
   // Loop boolean
   bool ready = false;
 
+  // Length of ray tracing steps. With za_tolerance > 0, it is adapted
+  // after each step, see raytrace_adapt_lstep.
+  Numeric lraytrace_now = lraytrace;
+  Numeric bend_old = 0;
+  bool has_bend = false;
+
   // Store first point
   Numeric refr_index_air, refr_index_air_group;
   get_refr_index_3d(ws,
@@ -4153,6 +4258,11 @@ void raytrace_3d_linear_basic(Workspace& ws,
   Numeric za_new, aa_new;
 
   while (!ready) {
+    // An adapted step can be longer than lmax. Shorten it to end at lmax,
+    // so that points are never more than lmax apart.
+    if (za_tolerance > 0 && lmax > 0)
+      lraytrace_now = min(lraytrace_now, lmax - lcum);
+
     // Constant for the geometrical step to make
     const Numeric ppc_step = geometrical_ppc(r, za);
 
@@ -4169,7 +4279,7 @@ void raytrace_3d_linear_basic(Workspace& ws,
                            lon,
                            za,
                            aa,
-                           lraytrace,
+                           lraytrace_now,
                            0,
                            ppc_step,
                            -1,
@@ -4194,7 +4304,7 @@ void raytrace_3d_linear_basic(Workspace& ws,
     // If *lstep* is <= *lraytrace*, extract the found end point.
     // Otherwise, we make a geometrical step with length *lraytrace*.
 
-    if (lstep <= lraytrace) {
+    if (lstep <= lraytrace_now) {
       r = r_v[1];
       lat = lat_v[1];
       lon = lon_v[1];
@@ -4207,7 +4317,7 @@ void raytrace_3d_linear_basic(Workspace& ws,
       Numeric x, y, z, dx, dy, dz, lat_new, lon_new;
       //
       poslos2cart(x, y, z, dx, dy, dz, r, lat, lon, za, aa);
-      lstep = lraytrace;
+      lstep = lraytrace_now;
       cart2poslos(r,
                   lat_new,
                   lon_new,
@@ -4278,6 +4388,26 @@ void raytrace_3d_linear_basic(Workspace& ws,
       los[1] += aterm * sinza * (cosaa * dndlon - sinaa * dndlat);
     }
     //
+    // Adapt step length to change of bending rate. The rate is taken as
+    // the angular deviation of the direction per length, with the zenith
+    // and azimuth components combined.
+    if (za_tolerance > 0) {
+      const Numeric bend_za =
+          (RAD2DEG / refr_index_air) *
+          (-sinza * dndr + cos(za_rad) * (cosaa * dndlat + sinaa * dndlon));
+      const Numeric bend_aa = (RAD2DEG / refr_index_air) * sinza * sinza *
+                              (cosaa * dndlon - sinaa * dndlat);
+      const Numeric bend = sqrt(bend_za * bend_za + bend_aa * bend_aa);
+      if (has_bend)
+        lraytrace_now = raytrace_adapt_lstep(lstep,
+                                             abs(bend - bend_old),
+                                             za_tolerance,
+                                             lraytrace,
+                                             lraytrace_max);
+      bend_old = bend;
+      has_bend = true;
+    }
+    //
     adjust_los(los, 3);
     //
     za = los[0];
@@ -4303,7 +4433,7 @@ void raytrace_3d_linear_basic(Workspace& ws,
     }
 
     // Store found point?
-    if (ready || (lmax > 0 && lcum + lraytrace > lmax)) {
+    if (ready || (lmax > 0 && lcum + lraytrace_now > lmax)) {
       r_array.push_back(r);
       lat_array.push_back(lat);
       lon_array.push_back(lon);
@@ -4331,7 +4461,9 @@ void ppath_step_refr_3d(Workspace& ws,
                         const Numeric& lmax,
                         const Agenda& refr_index_air_agenda,
                         const String& rtrace_method,
-                        const Numeric& lraytrace) {
+                        const Numeric& lraytrace,
+                        const Numeric& za_tolerance,
+                        const Numeric& lraytrace_max) {
   // Radius, zenith angle and latitude of start point.
   Numeric r_start, lat_start, lon_start, za_start, aa_start;
 
@@ -4408,6 +4540,8 @@ void ppath_step_refr_3d(Workspace& ws,
                              lmax,
                              refr_index_air_agenda,
                              lraytrace,
+                             za_tolerance,
+                             lraytrace_max,
                              lat1,
                              lat3,
                              lon5,
@@ -5566,3 +5700,131 @@ void ppath_calc(Workspace& ws,
 }
 
 
+
+namespace {
+
+/** Process-wide cache of propagation paths, see ppath_calc_cached. */
+class PpathCache {
+ public:
+  bool get(Ppath& ppath, const std::string& key) {
+    std::lock_guard<std::mutex> lock(mmutex);
+    const auto it = mpaths.find(key);
+    if (it == mpaths.end()) return false;
+    ppath = it->second;
+    return true;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(mmutex);
+    mpaths.clear();
+    morder.clear();
+  }
+
+  Index size() {
+    std::lock_guard<std::mutex> lock(mmutex);
+    return Index(mpaths.size());
+  }
+
+  void put(const std::string& key, const Ppath& ppath) {
+    std::lock_guard<std::mutex> lock(mmutex);
+    if (!mpaths.emplace(key, ppath).second) return;
+    morder.push_back(key);
+    // Drop the oldest paths when the cache is full
+    while (morder.size() > max_entries) {
+      mpaths.erase(morder.front());
+      morder.pop_front();
+    }
+  }
+
+ private:
+  static constexpr size_t max_entries = 1000;
+  std::mutex mmutex;
+  std::unordered_map<std::string, Ppath> mpaths;
+  std::deque<std::string> morder;
+};
+
+PpathCache ppath_cache;
+
+void ppath_cache_key_add(std::string& key, Numeric x) {
+  key.append(reinterpret_cast<const char*>(&x), sizeof(Numeric));
+}
+
+void ppath_cache_key_add(std::string& key, ConstVectorView x) {
+  ppath_cache_key_add(key, Numeric(x.nelem()));
+  for (Index i = 0; i < x.nelem(); i++) ppath_cache_key_add(key, x[i]);
+}
+
+}  // namespace
+
+void ppath_cache_clear() { ppath_cache.clear(); }
+
+Index ppath_cache_size() { return ppath_cache.size(); }
+
+void ppath_calc_cached(Workspace& ws,
+                       Ppath& ppath,
+                       const Agenda& ppath_step_agenda,
+                       const Index& atmosphere_dim,
+                       const Vector& p_grid,
+                       const Vector& lat_grid,
+                       const Vector& lon_grid,
+                       const Tensor3& z_field,
+                       const Vector& f_grid,
+                       const Vector& refellipsoid,
+                       const Matrix& z_surface,
+                       const Index& cloudbox_on,
+                       const ArrayOfIndex& cloudbox_limits,
+                       const Vector& rte_pos,
+                       const Vector& rte_los,
+                       const Numeric& ppath_lmax,
+                       const Numeric& ppath_lraytrace,
+                       const bool& ppath_inside_cloudbox_do,
+                       const Verbosity& verbosity) {
+  // With refraction, the path depends on the complete atmospheric state,
+  // and is not cached
+  const bool use_cache =
+      atmosphere_dim == 1 &&
+      ppath_step_agenda.has_method("ppath_stepGeometric") &&
+      !ppath_step_agenda.has_method("ppath_stepRefractionBasic");
+
+  std::string key;
+  if (use_cache) {
+    ppath_cache_key_add(key, p_grid);
+    ppath_cache_key_add(key, z_field(joker, 0, 0));
+    ppath_cache_key_add(key, refellipsoid);
+    ppath_cache_key_add(key, z_surface(0, 0));
+    ppath_cache_key_add(key, Numeric(cloudbox_on));
+    if (cloudbox_on) {
+      ppath_cache_key_add(key, Numeric(cloudbox_limits[0]));
+      ppath_cache_key_add(key, Numeric(cloudbox_limits[1]));
+    }
+    ppath_cache_key_add(key, rte_pos);
+    ppath_cache_key_add(key, rte_los);
+    ppath_cache_key_add(key, ppath_lmax);
+    ppath_cache_key_add(key, ppath_lraytrace);
+    ppath_cache_key_add(key, Numeric(ppath_inside_cloudbox_do));
+
+    if (ppath_cache.get(ppath, key)) return;
+  }
+
+  ppath_calc(ws,
+             ppath,
+             ppath_step_agenda,
+             atmosphere_dim,
+             p_grid,
+             lat_grid,
+             lon_grid,
+             z_field,
+             f_grid,
+             refellipsoid,
+             z_surface,
+             cloudbox_on,
+             cloudbox_limits,
+             rte_pos,
+             rte_los,
+             ppath_lmax,
+             ppath_lraytrace,
+             ppath_inside_cloudbox_do,
+             verbosity);
+
+  if (use_cache) ppath_cache.put(key, ppath);
+}
@@ -525,6 +525,56 @@ void ppath_calc(Workspace& ws,
                 const bool& ppath_inside_cloudbox_do,
                 const Verbosity& verbosity);
 
+/** As ppath_calc, but paths are taken from a cache when possible.
+
+   The cache is shared by all threads of the process. Only 1D geometric
+   paths, where *ppath_step_agenda* uses ppath_stepGeometric, are cached.
+   The key consists of all input that such a path depends on: p_grid,
+   z_field, refellipsoid, z_surface, the cloudbox, rte_pos, rte_los,
+   ppath_lmax, ppath_lraytrace and ppath_inside_cloudbox_do. Other paths
+   are calculated as by ppath_calc. At most 1000 paths are kept, and the
+   oldest path is dropped when a new one is added to a full cache. The
+   cache lives until the end of the process or until ppath_cache_clear
+   is called.
+
+   The arguments are the same as for ppath_calc.
+
+   @date   2026-10-15
+ */
+void ppath_calc_cached(Workspace& ws,
+                       Ppath& ppath,
+                       const Agenda& ppath_step_agenda,
+                       const Index& atmosphere_dim,
+                       const Vector& p_grid,
+                       const Vector& lat_grid,
+                       const Vector& lon_grid,
+                       const Tensor3& z_field,
+                       const Vector& f_grid,
+                       const Vector& refellipsoid,
+                       const Matrix& z_surface,
+                       const Index& cloudbox_on,
+                       const ArrayOfIndex& cloudbox_limits,
+                       const Vector& rte_pos,
+                       const Vector& rte_los,
+                       const Numeric& ppath_lmax,
+                       const Numeric& ppath_lraytrace,
+                       const bool& ppath_inside_cloudbox_do,
+                       const Verbosity& verbosity);
+
+/** Removes all paths from the cache of ppath_calc_cached.
+
+   @date   2026-10-15
+ */
+void ppath_cache_clear();
+
+/** The number of paths in the cache of ppath_calc_cached.
+
+   @return The number of cached paths.
+
+   @date   2026-10-15
+ */
+Index ppath_cache_size();
+
 /** Copy the content in ppath2 to ppath1.
 
    The ppath1 structure must be allocated before calling the function. The
@@ -735,6 +785,12 @@ void ppath_step_geom_3d(Ppath& ppath,
    @param[in]   rtrace_method     String giving which ray tracing method to use.
                               See the function for options.
    @param[in]   lraytrace         Maximum allowed length for ray tracing steps.
+                              With adaptive steps, the initial and shortest
+                              step length.
+   @param[in]   za_tolerance      If > 0, the ray tracing step length is
+                              adapted to keep the estimated error of the
+                              direction below this value [deg] per step.
+   @param[in]   lraytrace_max     Longest step length with adaptive steps.
 
    @author Patrick Eriksson
    @date   2002-11-26
@@ -751,7 +807,9 @@ void ppath_step_refr_1d(Workspace& ws,
                         const Numeric& lmax,
                         const Agenda& refr_index_agenda,
                         const String& rtrace_method,
-                        const Numeric& lraytrace);
+                        const Numeric& lraytrace,
+                        const Numeric& za_tolerance,
+                        const Numeric& lraytrace_max);
 
 /** Calculates 2D propagation path steps, with refraction, using a simple
    and fast ray tracing scheme.
@@ -774,6 +832,12 @@ void ppath_step_refr_1d(Workspace& ws,
    @param[in]   rtrace_method     String giving which ray tracing method to use.
                               See the function for options.
    @param[in]   lraytrace         Maximum allowed length for ray tracing steps.
+                              With adaptive steps, the initial and shortest
+                              step length.
+   @param[in]   za_tolerance      If > 0, the ray tracing step length is
+                              adapted to keep the estimated error of the
+                              direction below this value [deg] per step.
+   @param[in]   lraytrace_max     Longest step length with adaptive steps.
 
    @author Patrick Eriksson
    @date   2002-12-02
@@ -791,7 +855,9 @@ void ppath_step_refr_2d(Workspace& ws,
                         const Numeric& lmax,
                         const Agenda& refr_index_agenda,
                         const String& rtrace_method,
-                        const Numeric& lraytrace);
+                        const Numeric& lraytrace,
+                        const Numeric& za_tolerance,
+                        const Numeric& lraytrace_max);
 
 /** Calculates 3D propagation path steps, with refraction, using a simple
    and fast ray tracing scheme.
@@ -815,6 +881,12 @@ void ppath_step_refr_2d(Workspace& ws,
    @param[in]   rtrace_method     String giving which ray tracing method to use.
                               See the function for options.
    @param[in]   lraytrace         Maximum allowed length for ray tracing steps.
+                              With adaptive steps, the initial and shortest
+                              step length.
+   @param[in]   za_tolerance      If > 0, the ray tracing step length is
+                              adapted to keep the estimated error of the
+                              direction below this value [deg] per step.
+   @param[in]   lraytrace_max     Longest step length with adaptive steps.
 
    @author Patrick Eriksson
    @date   2003-01-08
@@ -833,7 +905,9 @@ void ppath_step_refr_3d(Workspace& ws,
                         const Numeric& lmax,
                         const Agenda& refr_index_agenda,
                         const String& rtrace_method,
-                        const Numeric& lraytrace);
+                        const Numeric& lraytrace,
+                        const Numeric& za_tolerance,
+                        const Numeric& lraytrace_max);
 
 /** Returns the case number for the radiative background.
 
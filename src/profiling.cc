@@ -0,0 +1,213 @@
+/** Opt-in profiler for agenda and workspace method execution.
+ *
+ * @file   profiling.cc
+ * @date   2026-10-15
+ */
+
+#include "profiling.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "arts.h"
+#include "arts_omp.h"
+#include "file.h"
+
+extern String out_basename;
+
+namespace Profiling {
+
+namespace {
+
+/** Maximum number of trace events kept per thread.
+ *
+ * The flat profile counts every region, but long runs would otherwise
+ * grow the trace without bound.
+ */
+constexpr std::size_t max_trace_events = 100000;
+
+/** A finished region. Times are in microseconds since profiling started. */
+struct Event {
+  String name;
+  Kind kind;
+  Index thread;
+  double start;
+  double duration;
+};
+
+/** Accumulated times of all regions of one name and kind. */
+struct Stat {
+  Index calls{0};
+  double total{0.};
+  double self{0.};
+};
+
+using StatMap = std::map<std::pair<Kind, String>, Stat>;
+
+/** Events recorded by one thread.
+ *
+ * Each thread only ever appends to its own log, so no locking is
+ * necessary while recording. The stack holds the accumulated time of
+ * the children of all currently open regions to compute self times.
+ */
+struct ThreadLog {
+  StatMap stats;
+  std::vector<Event> events;
+  Index dropped{0};
+  std::vector<double> children;
+};
+
+std::mutex logs_mutex;
+std::vector<std::unique_ptr<ThreadLog>> logs;
+std::chrono::steady_clock::time_point epoch;
+thread_local ThreadLog* this_thread_log = nullptr;
+
+ThreadLog& thread_log() {
+  if (!this_thread_log) {
+    std::lock_guard<std::mutex> lock(logs_mutex);
+    logs.push_back(std::make_unique<ThreadLog>());
+    this_thread_log = logs.back().get();
+  }
+  return *this_thread_log;
+}
+
+const char* kind_name(Kind kind) {
+  return kind == Kind::Agenda ? "agenda" : "method";
+}
+
+String json_escape(const String& s) {
+  String r;
+  for (char c : s) {
+    if (c == '"' || c == '\\') r += '\\';
+    r += c;
+  }
+  return r;
+}
+
+void write_reports_at_exit() {
+  try {
+    write_reports();
+  } catch (const std::exception& e) {
+    std::cerr << "Writing profiling reports failed:\n" << e.what() << "\n";
+  }
+}
+
+}  // namespace
+
+namespace detail {
+std::atomic<bool> enabled{false};
+
+void enter() { thread_log().children.push_back(0.); }
+
+void record(const String& name,
+            Kind kind,
+            std::chrono::steady_clock::time_point start,
+            std::chrono::steady_clock::time_point end) {
+  using us = std::chrono::duration<double, std::micro>;
+  ThreadLog& log = thread_log();
+
+  const double duration = us(end - start).count();
+  const double children = log.children.back();
+  log.children.pop_back();
+  if (!log.children.empty()) log.children.back() += duration;
+
+  Stat& s = log.stats[{kind, name}];
+  s.calls++;
+  s.total += duration;
+  s.self += duration - children;
+
+  if (log.events.size() < max_trace_events)
+    log.events.push_back(Event{name,
+                               kind,
+                               arts_omp_get_thread_num(),
+                               us(start - epoch).count(),
+                               duration});
+  else
+    log.dropped++;
+}
+}  // namespace detail
+
+void enable() {
+  std::lock_guard<std::mutex> lock(logs_mutex);
+  if (detail::enabled) return;
+
+  epoch = std::chrono::steady_clock::now();
+  std::atexit(write_reports_at_exit);
+  detail::enabled = true;
+}
+
+void write_reports() {
+  std::lock_guard<std::mutex> lock(logs_mutex);
+  if (logs.empty()) return;
+
+  StatMap stats;
+  Index dropped = 0;
+
+  std::ofstream trace(add_basedir(out_basename + ".trace.json").c_str());
+  if (!trace)
+    throw std::runtime_error("Cannot open " + out_basename + ".trace.json");
+
+  trace << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  trace << std::fixed << std::setprecision(3);
+  bool first = true;
+  for (const auto& log : logs) {
+    for (const auto& entry : log->stats) {
+      Stat& s = stats[entry.first];
+      s.calls += entry.second.calls;
+      s.total += entry.second.total;
+      s.self += entry.second.self;
+    }
+    dropped += log->dropped;
+
+    for (const Event& e : log->events) {
+      trace << (first ? "\n" : ",\n") << "{\"name\": \""
+            << json_escape(e.name) << "\", \"cat\": \"" << kind_name(e.kind)
+            << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << e.thread
+            << ", \"ts\": " << e.start << ", \"dur\": " << e.duration << "}";
+      first = false;
+    }
+  }
+  trace << "\n]}\n";
+
+  std::vector<std::pair<std::pair<Kind, String>, Stat>> sorted(stats.begin(),
+                                                               stats.end());
+  std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+    return a.second.self > b.second.self;
+  });
+
+  std::ofstream flat(add_basedir(out_basename + ".profile.txt").c_str());
+  if (!flat)
+    throw std::runtime_error("Cannot open " + out_basename + ".profile.txt");
+
+  flat << "Flat profile of " << logs.size() << " thread(s).\n"
+       << "Times are wall times summed over all threads. Self time excludes\n"
+       << "the time spent in nested agendas and methods.\n";
+  if (dropped)
+    flat << dropped << " region(s) are counted here but missing in the trace,\n"
+         << "which keeps at most " << max_trace_events
+         << " events per thread.\n";
+  flat << "\n";
+  flat << std::setw(10) << "calls" << std::setw(14) << "self [s]"
+       << std::setw(14) << "total [s]" << std::setw(14) << "mean [ms]"
+       << "  " << std::setw(8) << std::left << "type" << "name\n"
+       << std::right << std::fixed;
+  for (const auto& entry : sorted) {
+    const Stat& s = entry.second;
+    flat << std::setw(10) << s.calls << std::setprecision(6) << std::setw(14)
+         << s.self * 1e-6 << std::setw(14) << s.total * 1e-6
+         << std::setprecision(3) << std::setw(14)
+         << s.total * 1e-3 / (double)s.calls << "  " << std::setw(8)
+         << std::left << kind_name(entry.first.first) << std::right
+         << entry.first.second << "\n";
+  }
+}
+
+}  // namespace Profiling
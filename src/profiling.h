@@ -0,0 +1,93 @@
+/** Opt-in profiler for agenda and workspace method execution.
+ *
+ * When enabled, every agenda execution and every workspace method call
+ * made through Agenda::execute is recorded with its wall time and the
+ * OpenMP thread number it ran on. At program exit, a flat profile is
+ * written to <basename>.profile.txt and a trace in the Chrome trace event
+ * format (viewable in chrome://tracing or Perfetto) to
+ * <basename>.trace.json. The flat profile is accumulated while running;
+ * the trace keeps a limited number of events per thread.
+ *
+ * When the profiler is disabled, the cost of a Scope is a single
+ * atomic load.
+ *
+ * @file   profiling.h
+ * @date   2026-10-15
+ */
+
+#ifndef PROFILING_INCLUDED
+#define PROFILING_INCLUDED
+
+#include <atomic>
+#include <chrono>
+
+#include "mystring.h"
+
+namespace Profiling {
+
+/** Kind of a profiled region. */
+enum class Kind { Agenda, Method };
+
+namespace detail {
+extern std::atomic<bool> enabled;
+
+void record(const String& name,
+            Kind kind,
+            std::chrono::steady_clock::time_point start,
+            std::chrono::steady_clock::time_point end);
+
+void enter();
+}  // namespace detail
+
+/** Switch profiling on.
+ *
+ * The first call registers an exit handler that writes the reports.
+ * Subsequent calls have no effect.
+ */
+void enable();
+
+/** Return true if profiling is switched on. */
+inline bool is_enabled() {
+  return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/** Write flat profile and Chrome trace.
+ *
+ * The output file names are derived from the basename of the ARTS run
+ * (see out_basename). Called automatically at exit if profiling is on.
+ */
+void write_reports();
+
+/** Record the wall time of a region for the lifetime of this object.
+ *
+ * The name is only copied when the scope ends, so it must stay valid
+ * until then.
+ */
+class Scope {
+ public:
+  Scope(const String& name, Kind kind) : mname(name), mkind(kind) {
+    if (is_enabled()) {
+      mactive = true;
+      detail::enter();
+      mstart = std::chrono::steady_clock::now();
+    }
+  }
+
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+  ~Scope() {
+    if (mactive)
+      detail::record(mname, mkind, mstart, std::chrono::steady_clock::now());
+  }
+
+ private:
+  const String& mname;
+  Kind mkind;
+  bool mactive{false};
+  std::chrono::steady_clock::time_point mstart;
+};
+
+}  // namespace Profiling
+
+#endif  // PROFILING_INCLUDED
@@ -31,14 +31,18 @@
 
 #include "rte.h"
 #include <cmath>
+#include <set>
 #include <stdexcept>
 #include "auto_md.h"
 #include "check_input.h"
 #include "legacy_continua.h"
+#include "gas_abs_lookup.h"
 #include "geodetic.h"
+#include "global_data.h"
 #include "lin_alg.h"
 #include "logic.h"
 #include "math_funcs.h"
+#include "matpack_pool.h"
 #include "montecarlo.h"
 #include "physics_funcs.h"
 #include "ppath.h"
@@ -1268,6 +1272,98 @@ void get_stepwise_clearsky_propmat(
   }
 }
 
+std::unique_ptr<GasAbsLookupPrefetch> abs_lookup_prefetch(
+    Workspace& ws,
+    const Agenda& propmat_clearsky_agenda,
+    const ArrayOfRetrievalQuantity& jacobian_quantities,
+    ConstVectorView f_grid,
+    ConstVectorView p,
+    ConstVectorView T,
+    ConstMatrixView vmrs) {
+  using global_data::md_data;
+
+  // Find the table lookup among the methods of the agenda. What it reads
+  // must not be set by the methods before it.
+  const MRecord* lookup = nullptr;
+  std::set<Index> set_vars;
+  for (const auto& mr : propmat_clearsky_agenda.Methods()) {
+    if (md_data[mr.Id()].Name() == "propmat_clearskyAddFromLookup") {
+      lookup = &mr;
+      break;
+    }
+    for (Index out : mr.Out()) set_vars.insert(out);
+  }
+  if (!lookup) return nullptr;
+
+  const MdRecord& mdd = md_data[lookup->Id()];
+  const ArrayOfIndex& in_only = mdd.InOnly();
+  auto input = [&](Index wsv) -> const void* {
+    if (set_vars.count(wsv) || !ws.is_initialized(wsv)) return nullptr;
+    return ws[wsv];
+  };
+  auto named_input = [&](const String& name) -> const void* {
+    for (Index i = 0; i < in_only.nelem(); i++)
+      if (Workspace::wsv_data[in_only[i]].Name() == name)
+        return input(lookup->In()[i]);
+    return nullptr;
+  };
+
+  const auto* abs_lookup =
+      static_cast<const GasAbsLookup*>(named_input("abs_lookup"));
+  const auto* is_adapted =
+      static_cast<const Index*>(named_input("abs_lookup_is_adapted"));
+  const auto* p_order =
+      static_cast<const Index*>(named_input("abs_p_interp_order"));
+  const auto* t_order =
+      static_cast<const Index*>(named_input("abs_t_interp_order"));
+  const auto* nls_order =
+      static_cast<const Index*>(named_input("abs_nls_interp_order"));
+  const auto* f_order =
+      static_cast<const Index*>(named_input("abs_f_interp_order"));
+  // The generic input extpolfac follows the specific inputs
+  const auto* extpolfac =
+      static_cast<const Numeric*>(input(lookup->In()[in_only.nelem()]));
+  if (!abs_lookup || !is_adapted || *is_adapted != 1 || !p_order ||
+      !t_order || !nls_order || !f_order || !extpolfac)
+    return nullptr;
+
+  // The temperature Jacobian of the table lookup takes the absorption at
+  // the perturbed temperatures as well
+  const Index np = p.nelem();
+  Vector p_points = p, t_points = T;
+  Matrix vmr_points = vmrs;
+  if (do_temperature_jacobian(jacobian_quantities)) {
+    const Numeric dt = temperature_perturbation(jacobian_quantities);
+    p_points.resize(2 * np);
+    t_points.resize(2 * np);
+    vmr_points.resize(vmrs.nrows(), 2 * np);
+    for (Index ip = 0; ip < np; ip++) {
+      p_points[ip] = p_points[np + ip] = p[ip];
+      t_points[ip] = T[ip];
+      t_points[np + ip] = T[ip] + dt;
+    }
+    vmr_points(joker, Range(0, np)) = vmrs;
+    vmr_points(joker, Range(np, np)) = vmrs;
+  }
+
+  try {
+    return std::make_unique<GasAbsLookupPrefetch>(*abs_lookup,
+                                                  *p_order,
+                                                  *t_order,
+                                                  *nls_order,
+                                                  *f_order,
+                                                  p_points,
+                                                  t_points,
+                                                  vmr_points,
+                                                  f_grid,
+                                                  *extpolfac);
+  } catch (const std::exception&) {
+    // The points are then extracted one by one, which reports the error
+    // for the point it concerns
+    return nullptr;
+  }
+}
+
 void get_stepwise_effective_source(
     MatrixView J,
     Tensor3View dJ_dx,
@@ -1788,6 +1884,10 @@ void iyb_calc_body(bool& failed,
   // The try block here is necessary to correctly handle
   // exceptions inside the parallel region.
   try {
+    // Storage of matpack temporaries is recycled on this thread until the
+    // LOS is done
+    MatpackScratchScope matpack_scratch;
+
     //--- LOS of interest
     //
     Vector los(sensor_los.ncols());
@@ -1924,72 +2024,77 @@ void iyb_calc(Workspace& ws,
   // all outout
   ArrayOfArrayOfMatrix iy_aux_array(nlos);
 
-  // We have to make a local copy of the Workspace and the agendas because
-  // only non-reference types can be declared firstprivate in OpenMP
-  Workspace l_ws(ws);
-  Agenda l_iy_main_agenda(iy_main_agenda);
-  Agenda l_geo_pos_agenda(geo_pos_agenda);
-
   String fail_msg;
   bool failed = false;
   if (nlos >= arts_omp_get_max_threads() || nlos * 10 >= nf) {
     out3 << "  Parallelizing los loop (" << nlos << " iterations, " << nf
          << " frequencies)\n";
 
-    // Start of actual calculations
-#pragma omp parallel for if (!arts_omp_in_parallel()) \
-    firstprivate(l_ws, l_iy_main_agenda, l_geo_pos_agenda)
-    for (Index ilos = 0; ilos < nlos; ilos++) {
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
+    // Each thread gets its own workspace, which is reused by all agenda
+    // calls inside the loop body
+    ThreadWorkspaces thread_ws(ws, nlos);
 
-      Ppath ppath;
-      iyb_calc_body(failed,
-                    fail_msg,
-                    iy_aux_array,
-                    l_ws,
-                    ppath,
-                    iyb,
-                    diyb_dx,
-                    mblock_index,
-                    atmosphere_dim,
-                    nlte_field,
-                    cloudbox_on,
-                    stokes_dim,
-                    sensor_pos,
-                    sensor_los,
-                    transmitter_pos,
-                    mblock_dlos_grid,
-                    iy_unit,
-                    l_iy_main_agenda,
-                    j_analytical_do,
-                    jacobian_quantities,
-                    jacobian_indices,
-                    f_grid,
-                    iy_aux_vars,
-                    ilos,
-                    nf);
-
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
-
-      // Note that this code is found in two places inside the function
-      Vector geo_pos;
-      try {
-        geo_pos_agendaExecute(l_ws, geo_pos, ppath, l_geo_pos_agenda);
-        if (geo_pos.nelem()) {
-          if (geo_pos.nelem() != 5)
-            throw runtime_error(
-                "Wrong size of *geo_pos* obtained from *geo_pos_agenda*.\n"
-                "The length of *geo_pos* must be zero or five.");
-
-          geo_pos_matrix(ilos, joker) = geo_pos;
-        }
-      } catch (const std::exception& e) {
+    // Start of actual calculations. Each thread recycles the storage of
+    // its own temporaries over all its LOS.
+#pragma omp parallel if (thread_ws.parallel()) \
+    num_threads(thread_ws.nthreads())
+    {
+      MatpackScratchScope thread_scratch;
+
+#pragma omp for
+      for (Index ilos = 0; ilos < nlos; ilos++) {
+        // Skip remaining iterations if an error occurred
+        if (failed) continue;
+
+        Ppath ppath;
+        iyb_calc_body(failed,
+                      fail_msg,
+                      iy_aux_array,
+                      thread_ws.get(),
+                      ppath,
+                      iyb,
+                      diyb_dx,
+                      mblock_index,
+                      atmosphere_dim,
+                      nlte_field,
+                      cloudbox_on,
+                      stokes_dim,
+                      sensor_pos,
+                      sensor_los,
+                      transmitter_pos,
+                      mblock_dlos_grid,
+                      iy_unit,
+                      iy_main_agenda,
+                      j_analytical_do,
+                      jacobian_quantities,
+                      jacobian_indices,
+                      f_grid,
+                      iy_aux_vars,
+                      ilos,
+                      nf);
+
+        // Skip remaining iterations if an error occurred
+        if (failed) continue;
+
+        // Note that this code is found in two places inside the function
+        Vector geo_pos;
+        try {
+          geo_pos_agendaExecute(
+              thread_ws.get(), geo_pos, ppath, geo_pos_agenda);
+          if (geo_pos.nelem()) {
+            if (geo_pos.nelem() != 5)
+              throw runtime_error(
+                  "Wrong size of *geo_pos* obtained from *geo_pos_agenda*.\n"
+                  "The length of *geo_pos* must be zero or five.");
+
+            geo_pos_matrix(ilos, joker) = geo_pos;
+          }
+        } catch (const std::exception& e) {
 #pragma omp critical(iyb_calc_fail)
-        {
-          fail_msg = e.what();
-          failed = true;
+          {
+            fail_msg = e.what();
+            failed = true;
+          }
         }
       }
     }
@@ -2005,7 +2110,7 @@ void iyb_calc(Workspace& ws,
       iyb_calc_body(failed,
                     fail_msg,
                     iy_aux_array,
-                    l_ws,
+                    ws,
                     ppath,
                     iyb,
                     diyb_dx,
@@ -2019,7 +2124,7 @@ void iyb_calc(Workspace& ws,
                     transmitter_pos,
                     mblock_dlos_grid,
                     iy_unit,
-                    l_iy_main_agenda,
+                    iy_main_agenda,
                     j_analytical_do,
                     jacobian_quantities,
                     jacobian_indices,
@@ -2034,7 +2139,7 @@ void iyb_calc(Workspace& ws,
       // Note that this code is found in two places inside the function
       Vector geo_pos;
       try {
-        geo_pos_agendaExecute(l_ws, geo_pos, ppath, l_geo_pos_agenda);
+        geo_pos_agendaExecute(ws, geo_pos, ppath, geo_pos_agenda);
         if (geo_pos.nelem()) {
           if (geo_pos.nelem() != 5)
             throw runtime_error(
@@ -2078,6 +2183,154 @@ void iyb_calc(Workspace& ws,
   }
 }
 
+void iyb_calc_chunked(Workspace& ws,
+                      ArrayOfVector& iyb,
+                      ArrayOfArrayOfVector& iyb_aux,
+                      ArrayOfArrayOfMatrix& diyb_dx,
+                      ArrayOfMatrix& geo_pos_matrix,
+                      const Index& atmosphere_dim,
+                      const EnergyLevelMap& nlte_field,
+                      const Index& cloudbox_on,
+                      const Index& stokes_dim,
+                      ConstVectorView f_grid,
+                      ConstMatrixView sensor_pos,
+                      ConstMatrixView sensor_los,
+                      ConstMatrixView transmitter_pos,
+                      ConstMatrixView mblock_dlos_grid,
+                      const String& iy_unit,
+                      const Agenda& iy_main_agenda,
+                      const Agenda& geo_pos_agenda,
+                      const Index& j_analytical_do,
+                      const ArrayOfRetrievalQuantity& jacobian_quantities,
+                      const ArrayOfArrayOfIndex& jacobian_indices,
+                      const ArrayOfString& iy_aux_vars,
+                      const Index& f_chunk_size,
+                      const Verbosity& verbosity) {
+  assert(f_chunk_size > 0);
+
+  // Sizes
+  const Index nf = f_grid.nelem();
+  const Index nlos = mblock_dlos_grid.nrows();
+  const Index nmblock = sensor_pos.nrows();
+  const Index niyb = nf * nlos * stokes_dim;
+  const Index nchunk = (nf + f_chunk_size - 1) / f_chunk_size;
+  const Index nitem = nmblock * nchunk;
+
+  iyb.resize(nmblock);
+  iyb_aux.resize(nmblock);
+  diyb_dx.resize(nmblock);
+  geo_pos_matrix.resize(nmblock);
+  for (Index imblock = 0; imblock < nmblock; imblock++) {
+    iyb[imblock].resize(niyb);
+    if (j_analytical_do) {
+      diyb_dx[imblock].resize(jacobian_indices.nelem());
+      FOR_ANALYTICAL_JACOBIANS_DO2(diyb_dx[imblock][iq].resize(
+          niyb, jacobian_indices[iq][1] - jacobian_indices[iq][0] + 1);)
+    }
+  }
+
+  // The number of auxiliary quantities is not known beforehand, so they
+  // are kept per work item and compiled afterwards
+  ArrayOfArrayOfVector iyb_aux_item(nitem);
+
+  String fail_msg;
+  bool failed = false;
+
+  // Each thread gets its own workspace, which is reused by all agenda
+  // calls inside the loop body
+  ThreadWorkspaces thread_ws(ws, nitem);
+
+#pragma omp parallel for if (thread_ws.parallel()) \
+    num_threads(thread_ws.nthreads()) schedule(dynamic)
+  for (Index item = 0; item < nitem; item++) {
+    // Skip remaining iterations if an error occurred
+    if (failed) continue;
+
+    const Index imblock = item / nchunk;
+    const Index f0 = (item % nchunk) * f_chunk_size;
+    const Index nfc = min(f_chunk_size, nf - f0);
+
+    try {
+      Vector iyb_chunk;
+      ArrayOfMatrix diyb_dx_chunk;
+      Matrix geo_pos_chunk;
+
+      iyb_calc(thread_ws.get(),
+               iyb_chunk,
+               iyb_aux_item[item],
+               diyb_dx_chunk,
+               geo_pos_chunk,
+               imblock,
+               atmosphere_dim,
+               nlte_field,
+               cloudbox_on,
+               stokes_dim,
+               f_grid[Range(f0, nfc)],
+               sensor_pos,
+               sensor_los,
+               transmitter_pos,
+               mblock_dlos_grid,
+               iy_unit,
+               iy_main_agenda,
+               geo_pos_agenda,
+               j_analytical_do,
+               jacobian_quantities,
+               jacobian_indices,
+               iy_aux_vars,
+               verbosity);
+
+      // Copy to the rows of the chunk, which are disjoint between the
+      // work items of a measurement block
+      for (Index ilos = 0; ilos < nlos; ilos++) {
+        const Range rows(
+            (ilos * nf + f0) * stokes_dim, nfc * stokes_dim);
+        const Range rows_chunk(ilos * nfc * stokes_dim, nfc * stokes_dim);
+        iyb[imblock][rows] = iyb_chunk[rows_chunk];
+        if (j_analytical_do) {
+          FOR_ANALYTICAL_JACOBIANS_DO2(diyb_dx[imblock][iq](rows, joker) =
+                                           diyb_dx_chunk[iq](rows_chunk,
+                                                             joker);)
+        }
+      }
+
+      // The propagation paths are the same for all chunks
+      if (f0 == 0) geo_pos_matrix[imblock] = geo_pos_chunk;
+    } catch (const std::exception& e) {
+#pragma omp critical(iyb_calc_chunked_fail)
+      {
+        fail_msg = e.what();
+        failed = true;
+      }
+    }
+  }
+
+  if (failed)
+    throw runtime_error(
+        "Run-time error in function: iyb_calc_chunked\n" + fail_msg +
+        "\nThe agendas were called with chunks of f_grid. If some input has\n"
+        "one value per frequency of the full f_grid, set f_chunk_size to 0.\n");
+
+  // Compile iyb_aux
+  //
+  for (Index imblock = 0; imblock < nmblock; imblock++) {
+    const Index nq = iyb_aux_item[imblock * nchunk].nelem();
+    iyb_aux[imblock].resize(nq);
+    for (Index q = 0; q < nq; q++) {
+      iyb_aux[imblock][q].resize(niyb);
+      for (Index ichunk = 0; ichunk < nchunk; ichunk++) {
+        const Index f0 = ichunk * f_chunk_size;
+        const Index nfc = min(f_chunk_size, nf - f0);
+        const Vector& aux_chunk = iyb_aux_item[imblock * nchunk + ichunk][q];
+        for (Index ilos = 0; ilos < nlos; ilos++) {
+          iyb_aux[imblock][q][Range((ilos * nf + f0) * stokes_dim,
+                                    nfc * stokes_dim)] =
+              aux_chunk[Range(ilos * nfc * stokes_dim, nfc * stokes_dim)];
+        }
+      }
+    }
+  }
+}
+
 void iy_transmittance_mult(Tensor3& iy_trans_total,
                           ConstTensor3View iy_trans_old,
                           ConstTensor3View iy_trans_new) {
@@ -2392,7 +2645,7 @@ void yCalc_mblock_loop_body(bool& failed,
   try {
     // Calculate monochromatic pencil beam data for 1 measurement block
     //
-    Vector iyb, iyb_error, yb(n1y);
+    Vector iyb;
     ArrayOfMatrix diyb_dx;
     Matrix geo_pos_matrix;
     //
@@ -2420,76 +2673,132 @@ void yCalc_mblock_loop_body(bool& failed,
              iy_aux_vars,
              verbosity);
 
-    // Apply sensor response matrix on iyb, and put into y
-    //
-    const Range rowind = get_rowindex_for_mblock(sensor_response, mblock_index);
-    const Index row0 = rowind.get_start();
-    //
-    mult(yb, sensor_response, iyb);
-    //
-    y[rowind] = yb;  // *yb* also used below, as input to jacobian_agenda
+    yCalc_mblock_apply_sensor(ws,
+                              y,
+                              y_f,
+                              y_pol,
+                              y_pos,
+                              y_los,
+                              y_geo,
+                              jacobian,
+                              stokes_dim,
+                              f_grid,
+                              sensor_pos,
+                              sensor_los,
+                              sensor_response,
+                              sensor_response_f,
+                              sensor_response_pol,
+                              sensor_response_dlos,
+                              jacobian_agenda,
+                              jacobian_do,
+                              jacobian_quantities,
+                              jacobian_indices,
+                              iyb,
+                              diyb_dx,
+                              geo_pos_matrix,
+                              mblock_index,
+                              n1y,
+                              j_analytical_do);
+  }
 
-    // Fill information variables. And search for NaNs in *y*.
-    //
-    for (Index i = 0; i < n1y; i++) {
-      const Index ii = row0 + i;
-      if (std::isnan(y[ii]))
-        throw runtime_error("One or several NaNs found in *y*.");
-      y_f[ii] = sensor_response_f[i];
-      y_pol[ii] = sensor_response_pol[i];
-      y_pos(ii, joker) = sensor_pos(mblock_index, joker);
-      y_los(ii, joker) = sensor_los(mblock_index, joker);
-      y_los(ii, 0) += sensor_response_dlos(i, 0);
-      if (sensor_response_dlos.ncols() > 1) {
-        y_los(ii, 1) += sensor_response_dlos(i, 1);
-      }
+  catch (const std::exception& e) {
+#pragma omp critical(yCalc_fail)
+    {
+      fail_msg = e.what();
+      failed = true;
     }
+  }
+}
 
-    // Apply sensor response matrix on diyb_dx, and put into jacobian
-    // (that is, analytical jacobian part)
-    //
-    if (j_analytical_do) {
-      FOR_ANALYTICAL_JACOBIANS_DO2(
-          mult(jacobian(rowind,
-                        Range(jacobian_indices[iq][0],
-                              jacobian_indices[iq][1] -
-                                  jacobian_indices[iq][0] + 1)),
-               sensor_response,
-               diyb_dx[iq]);)
-    }
+void yCalc_mblock_apply_sensor(Workspace& ws,
+                               Vector& y,
+                               Vector& y_f,
+                               ArrayOfIndex& y_pol,
+                               Matrix& y_pos,
+                               Matrix& y_los,
+                               Matrix& y_geo,
+                               Matrix& jacobian,
+                               const Index& stokes_dim,
+                               const Vector& f_grid,
+                               const Matrix& sensor_pos,
+                               const Matrix& sensor_los,
+                               const Sparse& sensor_response,
+                               const Vector& sensor_response_f,
+                               const ArrayOfIndex& sensor_response_pol,
+                               const Matrix& sensor_response_dlos,
+                               const Agenda& jacobian_agenda,
+                               const Index& jacobian_do,
+                               const ArrayOfRetrievalQuantity& jacobian_quantities,
+                               const ArrayOfArrayOfIndex& jacobian_indices,
+                               const Vector& iyb,
+                               const ArrayOfMatrix& diyb_dx,
+                               const Matrix& geo_pos_matrix,
+                               const Index& mblock_index,
+                               const Index& n1y,
+                               const Index& j_analytical_do) {
+  Vector yb(n1y);
+
+  // Apply sensor response matrix on iyb, and put into y
+  //
+  const Range rowind = get_rowindex_for_mblock(sensor_response, mblock_index);
+  const Index row0 = rowind.get_start();
+  //
+  mult(yb, sensor_response, iyb);
+  //
+  y[rowind] = yb;  // *yb* also used below, as input to jacobian_agenda
 
-    // Calculate remaining parts of *jacobian*
-    //
-    if (jacobian_do) {
-      jacobian_agendaExecute(
-          ws, jacobian, mblock_index, iyb, yb, jacobian_agenda);
+  // Fill information variables. And search for NaNs in *y*.
+  //
+  for (Index i = 0; i < n1y; i++) {
+    const Index ii = row0 + i;
+    if (std::isnan(y[ii]))
+      throw runtime_error("One or several NaNs found in *y*.");
+    y_f[ii] = sensor_response_f[i];
+    y_pol[ii] = sensor_response_pol[i];
+    y_pos(ii, joker) = sensor_pos(mblock_index, joker);
+    y_los(ii, joker) = sensor_los(mblock_index, joker);
+    y_los(ii, 0) += sensor_response_dlos(i, 0);
+    if (sensor_response_dlos.ncols() > 1) {
+      y_los(ii, 1) += sensor_response_dlos(i, 1);
     }
+  }
 
-    // Handle geo-positioning
-    if (!std::isnan(geo_pos_matrix(0, 0)))  // No data are flagged as NaN
-    {
-      // We set geo_pos based on the max value in sensor_response
-      const Index nfs = f_grid.nelem() * stokes_dim;
-      for (Index i = 0; i < n1y; i++) {
-        Index jmax = -1;
-        Numeric rmax = -99e99;
-        for (Index j = 0; j < sensor_response.ncols(); j++) {
-          if (sensor_response(i, j) > rmax) {
-            rmax = sensor_response(i, j);
-            jmax = j;
-          }
-        }
-        const Index jhit = Index(floor(jmax / nfs));
-        y_geo(row0 + i, joker) = geo_pos_matrix(jhit, joker);
-      }
-    }
+  // Apply sensor response matrix on diyb_dx, and put into jacobian
+  // (that is, analytical jacobian part)
+  //
+  if (j_analytical_do) {
+    FOR_ANALYTICAL_JACOBIANS_DO2(
+        mult(jacobian(rowind,
+                      Range(jacobian_indices[iq][0],
+                            jacobian_indices[iq][1] -
+                                jacobian_indices[iq][0] + 1)),
+             sensor_response,
+             diyb_dx[iq]);)
   }
 
-  catch (const std::exception& e) {
-#pragma omp critical(yCalc_fail)
-    {
-      fail_msg = e.what();
-      failed = true;
+  // Calculate remaining parts of *jacobian*
+  //
+  if (jacobian_do) {
+    jacobian_agendaExecute(
+        ws, jacobian, mblock_index, iyb, yb, jacobian_agenda);
+  }
+
+  // Handle geo-positioning
+  if (!std::isnan(geo_pos_matrix(0, 0)))  // No data are flagged as NaN
+  {
+    // We set geo_pos based on the max value in sensor_response
+    const Index nfs = f_grid.nelem() * stokes_dim;
+    for (Index i = 0; i < n1y; i++) {
+      Index jmax = -1;
+      Numeric rmax = -99e99;
+      for (Index j = 0; j < sensor_response.ncols(); j++) {
+        if (sensor_response(i, j) > rmax) {
+          rmax = sensor_response(i, j);
+          jmax = j;
+        }
+      }
+      const Index jhit = Index(floor(jmax / nfs));
+      y_geo(row0 + i, joker) = geo_pos_matrix(jhit, joker);
     }
   }
 }
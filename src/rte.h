@@ -39,7 +39,9 @@
 #include "agenda_class.h"
 #include "arts.h"
 #include "auto_md.h"
+#include <memory>
 #include "complex.h"
+#include "gas_abs_lookup.h"
 #include "jacobian.h"
 #include "matpackI.h"
 #include "matpackII.h"
@@ -547,6 +549,35 @@ void get_stepwise_clearsky_propmat(
   const ArrayOfIndex& jacobian_species,
   const bool& jacobian_do);
 
+/** Extracts the lookup table absorption of a set of points in advance
+ * 
+ * If propmat_clearsky_agenda takes the gas absorption from an adapted
+ * lookup table with propmat_clearskyAddFromLookup, the absorption of all
+ * points is extracted with one call of the batched GasAbsLookup::Extract.
+ * The calls of the agenda for these points then take their absorption
+ * from the returned object, as long as it exists.
+ * 
+ * @param[in] ws The workspace
+ * @param[in] propmat_clearsky_agenda As WSA
+ * @param[in] jacobian_quantities As WSV, as passed to the agenda
+ * @param[in] f_grid Frequency grid, the same for all points
+ * @param[in] p Pressure of the points
+ * @param[in] T Temperature of the points
+ * @param[in] vmrs Volume mixing ratios of the points [species, points]
+ * @return The extracted absorption, or nullptr if the agenda does not
+ * use the table or the extraction failed
+ * 
+ * @date   2026-10-16
+ */
+std::unique_ptr<GasAbsLookupPrefetch> abs_lookup_prefetch(
+    Workspace& ws,
+    const Agenda& propmat_clearsky_agenda,
+    const ArrayOfRetrievalQuantity& jacobian_quantities,
+    ConstVectorView f_grid,
+    ConstVectorView p,
+    ConstVectorView T,
+    ConstMatrixView vmrs);
+
 /** Gets the effective source at propagation path point
  * 
  *  Computes
@@ -760,6 +791,58 @@ void iyb_calc(Workspace& ws,
               const ArrayOfString& iy_aux_vars,
               const Verbosity& verbosity);
 
+/** Performs the calculations of iyb_calc for all measurement blocks, in
+ * frequency chunks
+ *
+ * The work items are all combinations of measurement block and chunk of
+ * f_grid, and are processed in parallel. Each item runs iyb_calc with its
+ * part of f_grid. The results are assembled to the same output as iyb_calc
+ * gives for each measurement block.
+ *
+ * This is only valid if the agendas derive all frequency dependent
+ * quantities from the f_grid they are called with. Workspace variables
+ * sized to the full f_grid, e.g. a per-frequency surface_reflectivity, do
+ * not match a chunk.
+ *
+ * Absorption and radiative transfer of a chunk are both done inside its
+ * iy_main_agenda call and are not staged separately. The sensor response
+ * is not applied here, the callers apply it to the assembled iyb.
+ *
+ * @param[in,out] ws Current workspace
+ * @param[out] iyb iyb of each measurement block
+ * @param[out] iyb_aux iyb_aux of each measurement block
+ * @param[out] diyb_dx diyb_dx of each measurement block
+ * @param[out] geo_pos_matrix geo_pos_matrix of each measurement block
+ * @param[in] f_chunk_size Number of frequencies per chunk
+ *
+ * The other parameters are as for iyb_calc.
+ *
+ * @date 2026-10-15
+ */
+void iyb_calc_chunked(Workspace& ws,
+                      ArrayOfVector& iyb,
+                      ArrayOfArrayOfVector& iyb_aux,
+                      ArrayOfArrayOfMatrix& diyb_dx,
+                      ArrayOfMatrix& geo_pos_matrix,
+                      const Index& atmosphere_dim,
+                      const EnergyLevelMap& nlte_field,
+                      const Index& cloudbox_on,
+                      const Index& stokes_dim,
+                      ConstVectorView f_grid,
+                      ConstMatrixView sensor_pos,
+                      ConstMatrixView sensor_los,
+                      ConstMatrixView transmitter_pos,
+                      ConstMatrixView mblock_dlos_grid,
+                      const String& iy_unit,
+                      const Agenda& iy_main_agenda,
+                      const Agenda& geo_pos_agenda,
+                      const Index& j_analytical_do,
+                      const ArrayOfRetrievalQuantity& jacobian_quantities,
+                      const ArrayOfArrayOfIndex& jacobian_indices,
+                      const ArrayOfString& iy_aux_vars,
+                      const Index& f_chunk_size,
+                      const Verbosity& verbosity);
+
 /** Multiplicates iy_transmittance with transmissions.
 
     That is, a multiplication of *iy_transmittance* with another
@@ -942,6 +1025,41 @@ void yCalc_mblock_loop_body(bool& failed,
                             const Index& n1y,
                             const Index& j_analytical_do);
 
+/** Applies the sensor response to the pencil beam data of one measurement
+ * block, on y-level
+ *
+ * This is the part of yCalc_mblock_loop_body that follows iyb_calc. Errors
+ * are thrown.
+ *
+ * The parameters mainly matches WSVs.
+ */
+void yCalc_mblock_apply_sensor(Workspace& ws,
+                               Vector& y,
+                               Vector& y_f,
+                               ArrayOfIndex& y_pol,
+                               Matrix& y_pos,
+                               Matrix& y_los,
+                               Matrix& y_geo,
+                               Matrix& jacobian,
+                               const Index& stokes_dim,
+                               const Vector& f_grid,
+                               const Matrix& sensor_pos,
+                               const Matrix& sensor_los,
+                               const Sparse& sensor_response,
+                               const Vector& sensor_response_f,
+                               const ArrayOfIndex& sensor_response_pol,
+                               const Matrix& sensor_response_dlos,
+                               const Agenda& jacobian_agenda,
+                               const Index& jacobian_do,
+                               const ArrayOfRetrievalQuantity& jacobian_quantities,
+                               const ArrayOfArrayOfIndex& jacobian_indices,
+                               const Vector& iyb,
+                               const ArrayOfMatrix& diyb_dx,
+                               const Matrix& geo_pos_matrix,
+                               const Index& mblock_index,
+                               const Index& n1y,
+                               const Index& j_analytical_do);
+
 /** Calculates factor to convert back-scattering to Ze
 
    The vector *fac* shall be sized to match f_grid, before calling the
@@ -0,0 +1,643 @@
+/*!
+  \file   sensor_cache.cc
+  \date   2026-10-15
+
+  \brief  On-disk cache of sensor responses.
+*/
+
+#include "sensor_cache.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "config.h"
+#include "file.h"
+#include "global_data.h"
+#include "workspace_ng.h"
+#include "wsv_aux.h"
+#include "xml_io_types.h"
+
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+//! 128 bit FNV-1a hash
+/*!
+  The hash is kept as two 64 bit halves, since not all compilers have a
+  128 bit integer type.
+*/
+class Fnv1a128 {
+ public:
+  void add(const String& s) {
+    // Separate consecutive strings, so that "ab","c" and "a","bc" differ
+    add_bytes(s.c_str(), s.size() + 1);
+  }
+
+  String hex() const {
+    std::ostringstream os;
+    os << std::hex << std::setfill('0') << std::setw(16) << mhi
+       << std::setw(16) << mlo;
+    return os.str();
+  }
+
+ private:
+  void add_bytes(const char* p, size_t n) {
+    // The prime is 2^88 + 0x13B, so h * prime = h * 0x13B + (h << 88)
+    constexpr std::uint64_t prime_lo = 0x13B;
+    for (size_t i = 0; i < n; i++) {
+      mlo ^= static_cast<unsigned char>(p[i]);
+
+      const std::uint64_t lo_lo = (mlo & 0xFFFFFFFF) * prime_lo;
+      const std::uint64_t lo_hi = (mlo >> 32) * prime_lo;
+      const std::uint64_t lo = lo_lo + (lo_hi << 32);
+      const std::uint64_t carry = (lo_hi >> 32) + (lo < lo_lo ? 1 : 0);
+
+      mhi = mhi * prime_lo + carry + (mlo << 24);
+      mlo = lo;
+    }
+  }
+
+  std::uint64_t mhi{0x6c62272e07bb0142};
+  std::uint64_t mlo{0x62b821756295c58d};
+};
+
+//! Adds the XML representation of a workspace variable to the hash
+template <typename T>
+void hash_xml(Fnv1a128& hash, const T& x, const Verbosity& verbosity) {
+  std::ostringstream os;
+  xml_write_to_stream(os, x, NULL, "", verbosity);
+  hash.add(os.str());
+}
+
+//! Adds numbers to the hash
+/*!
+  The numbers are written with 17 significant digits, so that all doubles
+  are told apart. The XML output only has DBL_DIG digits.
+*/
+void hash_numeric(Fnv1a128& hash,
+                  const String& shape,
+                  const Numeric* x,
+                  Index n) {
+  std::ostringstream os;
+  os << shape << std::setprecision(17);
+  for (Index i = 0; i < n; i++) os << ' ' << x[i];
+  hash.add(os.str());
+}
+
+//! Adds the value of a workspace variable to the hash
+/*!
+  Groups without numbers of their own are hashed by their XML
+  representation.
+*/
+template <typename T>
+void hash_value(Fnv1a128& hash, const T& x, const Verbosity& verbosity) {
+  hash_xml(hash, x, verbosity);
+}
+
+void hash_value(Fnv1a128& hash, const Numeric& x, const Verbosity&) {
+  hash_numeric(hash, "Numeric", &x, 1);
+}
+
+void hash_value(Fnv1a128& hash, const Vector& x, const Verbosity&) {
+  std::ostringstream os;
+  os << "Vector " << x.nelem();
+  hash_numeric(hash, os.str(), x.get_c_array(), x.nelem());
+}
+
+void hash_value(Fnv1a128& hash, const Matrix& x, const Verbosity&) {
+  std::ostringstream os;
+  os << "Matrix " << x.nrows() << ' ' << x.ncols();
+  hash_numeric(hash, os.str(), x.get_c_array(), x.nrows() * x.ncols());
+}
+
+void hash_value(Fnv1a128& hash, const Tensor3& x, const Verbosity&) {
+  std::ostringstream os;
+  os << "Tensor3 " << x.npages() << ' ' << x.nrows() << ' ' << x.ncols();
+  hash_numeric(
+      hash, os.str(), x.get_c_array(), x.npages() * x.nrows() * x.ncols());
+}
+
+void hash_value(Fnv1a128& hash, const Tensor4& x, const Verbosity&) {
+  std::ostringstream os;
+  os << "Tensor4 " << x.nbooks() << ' ' << x.npages() << ' ' << x.nrows()
+     << ' ' << x.ncols();
+  hash_numeric(hash,
+               os.str(),
+               x.get_c_array(),
+               x.nbooks() * x.npages() * x.nrows() * x.ncols());
+}
+
+void hash_value(Fnv1a128& hash, const Tensor5& x, const Verbosity&) {
+  std::ostringstream os;
+  os << "Tensor5 " << x.nshelves() << ' ' << x.nbooks() << ' ' << x.npages()
+     << ' ' << x.nrows() << ' ' << x.ncols();
+  hash_numeric(hash,
+               os.str(),
+               x.get_c_array(),
+               x.nshelves() * x.nbooks() * x.npages() * x.nrows() * x.ncols());
+}
+
+void hash_value(Fnv1a128& hash, const Tensor6& x, const Verbosity&) {
+  std::ostringstream os;
+  os << "Tensor6 " << x.nvitrines() << ' ' << x.nshelves() << ' '
+     << x.nbooks() << ' ' << x.npages() << ' ' << x.nrows() << ' '
+     << x.ncols();
+  hash_numeric(hash,
+               os.str(),
+               x.get_c_array(),
+               x.nvitrines() * x.nshelves() * x.nbooks() * x.npages() *
+                   x.nrows() * x.ncols());
+}
+
+void hash_value(Fnv1a128& hash, const Tensor7& x, const Verbosity&) {
+  std::ostringstream os;
+  os << "Tensor7 " << x.nlibraries() << ' ' << x.nvitrines() << ' '
+     << x.nshelves() << ' ' << x.nbooks() << ' ' << x.npages() << ' '
+     << x.nrows() << ' ' << x.ncols();
+  hash_numeric(hash,
+               os.str(),
+               x.get_c_array(),
+               x.nlibraries() * x.nvitrines() * x.nshelves() * x.nbooks() *
+                   x.npages() * x.nrows() * x.ncols());
+}
+
+void hash_value(Fnv1a128& hash, const Sparse& x, const Verbosity& verbosity) {
+  Vector values;
+  ArrayOfIndex rows, cols;
+  x.list_elements(values, rows, cols);
+  std::ostringstream os;
+  os << "Sparse " << x.nrows() << ' ' << x.ncols();
+  hash.add(os.str());
+  hash_value(hash, values, verbosity);
+  hash_xml(hash, rows, verbosity);
+  hash_xml(hash, cols, verbosity);
+}
+
+//! Adds the names and grids of a gridded field and its data to the hash
+template <typename GF>
+void hash_value_gridded(Fnv1a128& hash,
+                        const GF& x,
+                        const Verbosity& verbosity) {
+  // The XML has the names and the string grids, the numbers are added
+  // separately
+  hash_xml(hash, x, verbosity);
+  for (Index i = 0; i < x.get_dim(); i++)
+    if (x.get_grid_type(i) == GRID_TYPE_NUMERIC)
+      hash_value(hash, x.get_numeric_grid(i), verbosity);
+  hash_value(hash, x.data, verbosity);
+}
+
+void hash_value(Fnv1a128& hash,
+                const GriddedField1& x,
+                const Verbosity& verbosity) {
+  hash_value_gridded(hash, x, verbosity);
+}
+
+void hash_value(Fnv1a128& hash,
+                const GriddedField2& x,
+                const Verbosity& verbosity) {
+  hash_value_gridded(hash, x, verbosity);
+}
+
+void hash_value(Fnv1a128& hash,
+                const GriddedField3& x,
+                const Verbosity& verbosity) {
+  hash_value_gridded(hash, x, verbosity);
+}
+
+void hash_value(Fnv1a128& hash,
+                const GriddedField4& x,
+                const Verbosity& verbosity) {
+  hash_value_gridded(hash, x, verbosity);
+}
+
+//! MCAntenna has no XML output, its members are hashed one by one
+void hash_value(Fnv1a128& hash,
+                const MCAntenna& x,
+                const Verbosity& verbosity) {
+  MCAntenna a = x;
+  std::ostringstream os;
+  os << "MCAntenna " << Index(a.Type());
+  hash.add(os.str());
+  hash_value(hash, a.saa(), verbosity);
+  hash_value(hash, a.sza(), verbosity);
+  hash_value(hash, a.aag(), verbosity);
+  hash_value(hash, a.zag(), verbosity);
+  hash_value(hash, a.G(), verbosity);
+}
+
+template <typename T>
+void hash_value(Fnv1a128& hash,
+                const Array<T>& x,
+                const Verbosity& verbosity) {
+  std::ostringstream os;
+  os << "Array " << x.nelem();
+  hash.add(os.str());
+  for (const T& y : x) hash_value(hash, y, verbosity);
+}
+
+void hash_agenda(Fnv1a128& hash,
+                 Workspace& ws,
+                 const Agenda& agenda,
+                 std::set<Index>& set_vars,
+                 const Verbosity& verbosity);
+
+//! Adds size and modification time of a file to the hash
+/*!
+  Methods like *ReadXML* take the name of the file they read as a String.
+  If a String names an existing file, found as by *ReadXML*, a changed file
+  thus gives a different hash.
+*/
+void hash_file(Fnv1a128& hash, const String& name) {
+  String filename = name;
+  if (filename.empty() || !find_xml_file_existence(filename)) return;
+
+  struct stat st;
+  if (stat(filename.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) return;
+
+  std::ostringstream os;
+  os << "<file " << filename << " " << st.st_size << " " << st.st_mtime
+     << ">";
+  hash.add(os.str());
+}
+
+//! Adds the value of a workspace variable to the hash
+void hash_wsv(Fnv1a128& hash,
+              Workspace& ws,
+              Index wsv,
+              std::set<Index>& set_vars,
+              const Verbosity& verbosity) {
+  using global_data::wsv_group_names;
+
+  const WsvRecord& wr = Workspace::wsv_data[wsv];
+  hash.add(wr.Name());
+
+  if (!ws.is_initialized(wsv)) {
+    hash.add("<uninitialized>");
+    return;
+  }
+
+  void* p = ws[wsv];
+  const String& group = wsv_group_names[wr.Group()];
+
+  if (is_agenda_group_id(wr.Group())) {
+    hash_agenda(hash, ws, *static_cast<Agenda*>(p), set_vars, verbosity);
+    return;
+  }
+
+  if (group == "String") {
+    const String& s = *static_cast<const String*>(p);
+    hash_xml(hash, s, verbosity);
+    hash_file(hash, s);
+    return;
+  }
+  if (group == "ArrayOfString") {
+    const ArrayOfString& a = *static_cast<const ArrayOfString*>(p);
+    hash_xml(hash, a, verbosity);
+    for (const String& s : a) hash_file(hash, s);
+    return;
+  }
+
+#define HASH_GROUP(G)                                       \
+  if (group == #G) {                                        \
+    hash_value(hash, *static_cast<const G*>(p), verbosity); \
+    return;                                                 \
+  }
+  HASH_GROUP(Index)
+  HASH_GROUP(Numeric)
+  HASH_GROUP(Vector)
+  HASH_GROUP(Matrix)
+  HASH_GROUP(Sparse)
+  HASH_GROUP(Tensor3)
+  HASH_GROUP(Tensor4)
+  HASH_GROUP(Tensor5)
+  HASH_GROUP(Tensor6)
+  HASH_GROUP(Tensor7)
+  HASH_GROUP(ArrayOfIndex)
+  HASH_GROUP(ArrayOfArrayOfIndex)
+  HASH_GROUP(ArrayOfVector)
+  HASH_GROUP(ArrayOfMatrix)
+  HASH_GROUP(ArrayOfSparse)
+  HASH_GROUP(ArrayOfTensor3)
+  HASH_GROUP(GriddedField1)
+  HASH_GROUP(GriddedField2)
+  HASH_GROUP(GriddedField3)
+  HASH_GROUP(GriddedField4)
+  HASH_GROUP(ArrayOfGriddedField1)
+  HASH_GROUP(ArrayOfGriddedField4)
+  HASH_GROUP(MCAntenna)
+#undef HASH_GROUP
+
+  std::ostringstream os;
+  os << "The sensor response can not be cached, since the agenda reads\n"
+     << "*" << wr.Name() << "*, and variables of group " << group
+     << " are not supported as key of the cache.";
+  throw std::runtime_error(os.str());
+}
+
+//! Adds the methods of an agenda and the variables it reads to the hash
+/*!
+  Variables that are set by an earlier method of the agenda are not part of
+  the input. They are tracked in set_vars.
+*/
+void hash_agenda(Fnv1a128& hash,
+                 Workspace& ws,
+                 const Agenda& agenda,
+                 std::set<Index>& set_vars,
+                 const Verbosity& verbosity) {
+  using global_data::md_data;
+
+  for (const auto& mr : agenda.Methods()) {
+    const MdRecord& mdd = md_data[mr.Id()];
+    hash.add(mdd.Name());
+
+    if (mdd.SetMethod()) {
+      std::ostringstream os;
+      os << std::setprecision(17) << mr.SetValue();
+      hash.add(os.str());
+    }
+
+    for (Index in : mr.In())
+      if (set_vars.find(in) == set_vars.end())
+        hash_wsv(hash, ws, in, set_vars, verbosity);
+
+    if (mr.Tasks().nelem()) {
+      hash.add("{");
+      hash_agenda(hash, ws, mr.Tasks(), set_vars, verbosity);
+      hash.add("}");
+    }
+
+    for (Index out : mr.Out()) set_vars.insert(out);
+  }
+}
+
+//! Reads consecutive values from a memory mapped file
+class MappedReader {
+ public:
+  MappedReader(const char* data, size_t size) : mdata(data), msize(size) {}
+
+  bool read(void* dest, size_t n) {
+    if (n > msize - mpos) return false;
+    std::memcpy(dest, mdata + mpos, n);
+    mpos += n;
+    return true;
+  }
+
+  bool read(Index& x) { return read(&x, sizeof(Index)); }
+
+  //! Number of elements of the given size that remain in the file
+  size_t remaining(size_t element_size) const {
+    return (msize - mpos) / element_size;
+  }
+
+  bool read(Vector& x) {
+    Index n;
+    if (!read(n) || n < 0 || size_t(n) > remaining(sizeof(Numeric)))
+      return false;
+    x.resize(n);
+    for (Index i = 0; i < n; i++)
+      if (!read(&x[i], sizeof(Numeric))) return false;
+    return true;
+  }
+
+  bool read(ArrayOfIndex& x) {
+    Index n;
+    if (!read(n) || n < 0 || size_t(n) > remaining(sizeof(Index)))
+      return false;
+    x.resize(n);
+    return n == 0 || read(x.data(), n * sizeof(Index));
+  }
+
+  bool read(Matrix& x) {
+    Index nr, nc;
+    if (!read(nr) || !read(nc) || nr < 0 || nc < 0 ||
+        (nc > 0 && size_t(nr) > remaining(sizeof(Numeric)) / size_t(nc)))
+      return false;
+    x.resize(nr, nc);
+    for (Index r = 0; r < nr; r++)
+      for (Index c = 0; c < nc; c++)
+        if (!read(&x(r, c), sizeof(Numeric))) return false;
+    return true;
+  }
+
+  bool at_end() const { return mpos == msize; }
+
+ private:
+  const char* mdata;
+  size_t msize;
+  size_t mpos{0};
+};
+
+//! Read-only content of a file
+/*!
+  The file is memory mapped where mmap is available, and read into memory
+  otherwise. data() is NULL if the file does not exist or is empty.
+*/
+class FileContent {
+ public:
+  explicit FileContent(const String& filename) {
+#ifdef HAVE_SYS_MMAN_H
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      void* map = mmap(NULL, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+      if (map != MAP_FAILED) {
+        mdata = static_cast<const char*>(map);
+        msize = size_t(st.st_size);
+      }
+    }
+    close(fd);
+#else
+    std::ifstream is(filename, std::ios::binary);
+    mbuffer.assign(std::istreambuf_iterator<char>(is),
+                   std::istreambuf_iterator<char>());
+    if (!mbuffer.empty()) {
+      mdata = mbuffer.data();
+      msize = mbuffer.size();
+    }
+#endif
+  }
+
+  FileContent(const FileContent&) = delete;
+  FileContent& operator=(const FileContent&) = delete;
+
+  ~FileContent() {
+#ifdef HAVE_SYS_MMAN_H
+    if (mdata) munmap(const_cast<char*>(mdata), msize);
+#endif
+  }
+
+  const char* data() const { return mdata; }
+  size_t size() const { return msize; }
+
+ private:
+  const char* mdata{NULL};
+  size_t msize{0};
+#ifndef HAVE_SYS_MMAN_H
+  std::vector<char> mbuffer;
+#endif
+};
+
+//! Magic string at the start of a cache file
+constexpr char cache_magic[8] = {'A', 'R', 'T', 'S', 'S', 'R', 'C', '2'};
+
+//! Byte order marker, follows the magic string
+constexpr Index cache_byte_order = 0x0102030405060708;
+
+void write_index(std::ofstream& os, Index x) {
+  os.write(reinterpret_cast<const char*>(&x), sizeof(Index));
+}
+
+void write_vector(std::ofstream& os, ConstVectorView x) {
+  write_index(os, x.nelem());
+  for (Index i = 0; i < x.nelem(); i++) {
+    const Numeric v = x[i];
+    os.write(reinterpret_cast<const char*>(&v), sizeof(Numeric));
+  }
+}
+
+void write_array(std::ofstream& os, const ArrayOfIndex& x) {
+  write_index(os, x.nelem());
+  for (Index v : x) write_index(os, v);
+}
+
+void write_matrix(std::ofstream& os, ConstMatrixView x) {
+  write_index(os, x.nrows());
+  write_index(os, x.ncols());
+  for (Index r = 0; r < x.nrows(); r++)
+    for (Index c = 0; c < x.ncols(); c++) {
+      const Numeric v = x(r, c);
+      os.write(reinterpret_cast<const char*>(&v), sizeof(Numeric));
+    }
+}
+
+}  // namespace
+
+String agenda_input_hash(Workspace& ws,
+                         const Agenda& agenda,
+                         const Verbosity& verbosity) {
+  Fnv1a128 hash;
+  std::set<Index> set_vars;
+  hash_agenda(hash, ws, agenda, set_vars, verbosity);
+  return hash.hex();
+}
+
+bool sensor_response_cache_read(Sparse& sensor_response,
+                                Vector& sensor_response_f,
+                                Vector& sensor_response_f_grid,
+                                ArrayOfIndex& sensor_response_pol,
+                                ArrayOfIndex& sensor_response_pol_grid,
+                                Matrix& sensor_response_dlos,
+                                Matrix& sensor_response_dlos_grid,
+                                Matrix& mblock_dlos_grid,
+                                const String& filename) {
+  const FileContent content(filename);
+  if (!content.data()) return false;
+
+  MappedReader in(content.data(), content.size());
+
+  // Files written with another byte order are not used, and are then
+  // replaced by a file written with the byte order of this machine
+  char magic[sizeof(cache_magic)];
+  Index byte_order = 0;
+  bool ok = in.read(magic, sizeof(magic)) &&
+            std::memcmp(magic, cache_magic, sizeof(magic)) == 0 &&
+            in.read(byte_order) && byte_order == cache_byte_order;
+
+  Index nrows = 0, ncols = 0, nnz = 0;
+  ok = ok && in.read(nrows) && in.read(ncols) && in.read(nnz) &&
+       nrows >= 0 && ncols >= 0 && nnz >= 0;
+
+  ArrayOfIndex rowind, colind;
+  Vector values;
+  ok = ok && in.read(rowind) && in.read(colind) && in.read(values) &&
+       rowind.nelem() == nnz && colind.nelem() == nnz &&
+       values.nelem() == nnz;
+
+  ok = ok && in.read(sensor_response_f) && in.read(sensor_response_f_grid) &&
+       in.read(sensor_response_pol) && in.read(sensor_response_pol_grid) &&
+       in.read(sensor_response_dlos) && in.read(sensor_response_dlos_grid) &&
+       in.read(mblock_dlos_grid) && in.at_end();
+
+  if (!ok) return false;
+
+  for (Index i = 0; i < nnz; i++)
+    if (rowind[i] < 0 || rowind[i] >= nrows || colind[i] < 0 ||
+        colind[i] >= ncols)
+      return false;
+
+  sensor_response.resize(nrows, ncols);
+  sensor_response.insert_elements(nnz, rowind, colind, values);
+
+  return true;
+}
+
+void sensor_response_cache_write(const Sparse& sensor_response,
+                                 ConstVectorView sensor_response_f,
+                                 ConstVectorView sensor_response_f_grid,
+                                 const ArrayOfIndex& sensor_response_pol,
+                                 const ArrayOfIndex& sensor_response_pol_grid,
+                                 ConstMatrixView sensor_response_dlos,
+                                 ConstMatrixView sensor_response_dlos_grid,
+                                 ConstMatrixView mblock_dlos_grid,
+                                 const String& filename) {
+  // Write to a name unique to this process and rename when complete
+  std::ostringstream tmpname;
+  tmpname << filename << ".tmp" << getpid();
+
+  {
+    std::ofstream os(tmpname.str(), std::ios::binary);
+    if (!os) {
+      std::ostringstream err;
+      err << "Cannot open sensor response cache file for writing:\n"
+          << tmpname.str();
+      throw std::runtime_error(err.str());
+    }
+
+    Vector values;
+    ArrayOfIndex rowind, colind;
+    sensor_response.list_elements(values, rowind, colind);
+
+    os.write(cache_magic, sizeof(cache_magic));
+    write_index(os, cache_byte_order);
+    write_index(os, sensor_response.nrows());
+    write_index(os, sensor_response.ncols());
+    write_index(os, values.nelem());
+    write_array(os, rowind);
+    write_array(os, colind);
+    write_vector(os, values);
+    write_vector(os, sensor_response_f);
+    write_vector(os, sensor_response_f_grid);
+    write_array(os, sensor_response_pol);
+    write_array(os, sensor_response_pol_grid);
+    write_matrix(os, sensor_response_dlos);
+    write_matrix(os, sensor_response_dlos_grid);
+    write_matrix(os, mblock_dlos_grid);
+
+    if (!os) {
+      std::ostringstream err;
+      err << "Error writing sensor response cache file:\n" << tmpname.str();
+      throw std::runtime_error(err.str());
+    }
+  }
+
+  if (std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    std::remove(tmpname.str().c_str());
+    std::ostringstream err;
+    err << "Cannot move sensor response cache file into place:\n" << filename;
+    throw std::runtime_error(err.str());
+  }
+}
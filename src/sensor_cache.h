@@ -0,0 +1,87 @@
+/*!
+  \file   sensor_cache.h
+  \date   2026-10-15
+
+  \brief  On-disk cache of sensor responses.
+
+  A cached sensor response is stored in a file named after a hash of the
+  values of all workspace variables that the sensor response agenda reads.
+  The file contains the raw binary data of all outputs of
+  *sensor_response_agenda*, in the byte order of the machine that wrote it,
+  which is marked in the header. It is read through a memory map where mmap is available. Files are
+  written to a temporary name and then renamed, so that processes sharing a
+  cache directory never see incomplete files.
+*/
+
+#ifndef sensor_cache_h
+#define sensor_cache_h
+
+#include "agenda_class.h"
+#include "array.h"
+#include "matpackI.h"
+#include "matpackII.h"
+#include "messages.h"
+#include "mystring.h"
+
+class Workspace;
+
+//! Hash of the input of an agenda
+/*!
+  Collects all workspace variables that are read by the methods of the
+  agenda before being set by them, including the control values of set
+  methods and the content of nested agendas, and hashes the names of the
+  methods together with the values of these variables. Strings that name an
+  existing file add the size and modification time of that file.
+
+  \param   ws         The workspace.
+  \param   agenda     The agenda.
+  \param   verbosity  Verbosity setting.
+
+  \return  The hash as a hexadecimal string.
+
+  \date   2026-10-15
+*/
+String agenda_input_hash(Workspace& ws,
+                         const Agenda& agenda,
+                         const Verbosity& verbosity);
+
+//! Reads a cached sensor response
+/*!
+  The arguments match the outputs of *sensor_response_agenda*.
+
+  \param   filename  Name of the cache file.
+
+  \return  False if the file does not exist or is not a valid cache
+           file, in which case the output is undefined.
+
+  \date   2026-10-15
+*/
+bool sensor_response_cache_read(Sparse& sensor_response,
+                                Vector& sensor_response_f,
+                                Vector& sensor_response_f_grid,
+                                ArrayOfIndex& sensor_response_pol,
+                                ArrayOfIndex& sensor_response_pol_grid,
+                                Matrix& sensor_response_dlos,
+                                Matrix& sensor_response_dlos_grid,
+                                Matrix& mblock_dlos_grid,
+                                const String& filename);
+
+//! Writes a sensor response to the cache
+/*!
+  The arguments match the outputs of *sensor_response_agenda*.
+
+  \param   filename  Name of the cache file.
+
+  \date   2026-10-15
+*/
+void sensor_response_cache_write(const Sparse& sensor_response,
+                                 ConstVectorView sensor_response_f,
+                                 ConstVectorView sensor_response_f_grid,
+                                 const ArrayOfIndex& sensor_response_pol,
+                                 const ArrayOfIndex& sensor_response_pol_grid,
+                                 ConstMatrixView sensor_response_dlos,
+                                 ConstMatrixView sensor_response_dlos_grid,
+                                 ConstMatrixView mblock_dlos_grid,
+                                 const String& filename);
+
+#endif  // sensor_cache_h
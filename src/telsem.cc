@@ -25,8 +25,10 @@
 */
 
 #include "telsem.h"
+#include <algorithm>
 #include <cmath>
 #include <utility>
+#include "arts_omp.h"
 #include "check_input.h"
 #include "geodetic.h"
 
@@ -288,16 +290,12 @@ Numeric TelsemAtlas::interp_freq2(Numeric emiss19,
   return emiss;
 }
 
-std::pair<Numeric, Numeric> TelsemAtlas::emis_interp(
-    Numeric theta,
-    Numeric freq,
-    Index class1,
-    Index class2,
-    const ConstVectorView& ev,
-    const ConstVectorView& eh) const {
-  Vector emiss_scal_h(3);
-  Vector emiss_scal_v(3);
-
+void TelsemAtlas::emis_scal(Numeric* emiss_scal_v,
+                            Numeric* emiss_scal_h,
+                            Numeric theta,
+                            Index class1,
+                            const ConstVectorView& ev,
+                            const ConstVectorView& eh) const {
   for (Index i = 0; i < 3; ++i) {
     Numeric e0 = a0_k0[i + (class1 - 1) * 3] +
                  a0_k1[i + (class1 - 1) * 3] * ev[i] +
@@ -330,6 +328,18 @@ std::pair<Numeric, Numeric> TelsemAtlas::emis_interp(
         b3 * pow(theta, 3) + b2 * pow(theta, 2) + b1 * theta + b0;
     emiss_scal_h[i] = s_h * emtheta_h;
   }
+}
+
+std::pair<Numeric, Numeric> TelsemAtlas::emis_interp(
+    Numeric theta,
+    Numeric freq,
+    Index class1,
+    Index class2,
+    const ConstVectorView& ev,
+    const ConstVectorView& eh) const {
+  Numeric emiss_scal_h[3];
+  Numeric emiss_scal_v[3];
+  emis_scal(emiss_scal_v, emiss_scal_h, theta, class1, ev, eh);
 
   Numeric emiss_h = interp_freq2(
       emiss_scal_h[0], emiss_scal_h[1], emiss_scal_h[2], freq, class2);
@@ -343,6 +353,123 @@ std::pair<Numeric, Numeric> TelsemAtlas::emis_interp(
   return std::make_pair(emiss_v, emiss_h);
 }
 
+void TelsemAtlas::emis_interp(VectorView e_v,
+                              VectorView e_h,
+                              Numeric theta,
+                              ConstVectorView freq,
+                              Index class1,
+                              Index class2,
+                              const ConstVectorView& ev,
+                              const ConstVectorView& eh) const {
+  assert(e_v.nelem() == freq.nelem());
+  assert(e_h.nelem() == freq.nelem());
+
+  Numeric emiss_scal_h[3];
+  Numeric emiss_scal_v[3];
+  emis_scal(emiss_scal_v, emiss_scal_h, theta, class1, ev, eh);
+
+  for (Index i = 0; i < freq.nelem(); ++i) {
+    Numeric emiss_h = interp_freq2(
+        emiss_scal_h[0], emiss_scal_h[1], emiss_scal_h[2], freq[i], class2);
+    Numeric emiss_v = interp_freq2(
+        emiss_scal_v[0], emiss_scal_v[1], emiss_scal_v[2], freq[i], class2);
+
+    if (emiss_v < emiss_h) {
+      emiss_v = 0.5 * (emiss_v + emiss_h);
+      emiss_h = emiss_v;
+    }
+    e_v[i] = emiss_v;
+    e_h[i] = emiss_h;
+  }
+}
+
+Index TelsemAtlas::find_cell(Numeric lat, Numeric lon, Numeric d_max) const {
+  Index cellnumber = calc_cellnum(lat, lon);
+  // Check if cell is in atlas.
+  if (!contains(cellnumber)) {
+    if (d_max <= 0.0) {
+      throw std::runtime_error(
+          "Given coordinates are not contained in "
+          " TELSEM atlas. To enable nearest neighbor"
+          "interpolation set *d_max* to a positive "
+          "value.");
+    } else {
+      cellnumber = calc_cellnum_nearest_neighbor(lat, lon);
+      Numeric lat_nn, lon_nn;
+      std::tie(lat_nn, lon_nn) = get_coordinates(cellnumber);
+      Numeric d = sphdist(lat, lon, lat_nn, lon_nn);
+      if (d > d_max) {
+        std::ostringstream out{};
+        out << "Distance of nearest neighbor exceeds provided limit (";
+        out << d << " > " << d_max << ").";
+        throw std::runtime_error(out.str());
+      }
+    }
+  }
+  return cellnumber;
+}
+
+void TelsemAtlas::emis_interp_batch(Tensor3& emissivities,
+                                    ConstVectorView lat,
+                                    ConstVectorView lon,
+                                    ConstVectorView theta,
+                                    ConstVectorView freq,
+                                    Numeric d_max) const {
+  const Index np = lat.nelem();
+  if (lon.nelem() != np || theta.nelem() != np) {
+    std::ostringstream os;
+    os << "The latitudes, longitudes and zenith angles must have the same\n"
+       << "length, but have lengths " << np << ", " << lon.nelem() << " and "
+       << theta.nelem() << ".";
+    throw std::runtime_error(os.str());
+  }
+
+  emissivities.resize(np, freq.nelem(), 2);
+
+  String fail_msg;
+  bool failed = false;
+
+  // Cell lookup
+  ArrayOfIndex cells(np);
+#pragma omp parallel for if (!arts_omp_in_parallel() && np > 1)
+  for (Index ip = 0; ip < np; ++ip) {
+    if (failed) continue;
+    try {
+      cells[ip] = find_cell(lat[ip], lon[ip], d_max);
+    } catch (const std::exception& e) {
+#pragma omp critical(telsem_batch_fail)
+      {
+        failed = true;
+        fail_msg = e.what();
+      }
+    }
+  }
+  if (failed) throw std::runtime_error(fail_msg);
+
+  // Process the positions in order of cell, so that each thread works on
+  // a compact part of the atlas and consecutive positions in the same
+  // cell share the atlas data.
+  ArrayOfIndex order(np);
+  for (Index ip = 0; ip < np; ++ip) order[ip] = ip;
+  std::stable_sort(order.begin(), order.end(), [&cells](Index a, Index b) {
+    return cells[a] < cells[b];
+  });
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && np > 1)
+  for (Index i = 0; i < np; ++i) {
+    const Index ip = order[i];
+    const Index cell = cells[ip];
+    emis_interp(emissivities(ip, joker, 0),
+                emissivities(ip, joker, 1),
+                theta[ip],
+                freq,
+                get_class1(cell),
+                get_class2(cell),
+                get_emis_v(cell),
+                get_emis_h(cell));
+  }
+}
+
 std::ostream& operator<<(std::ostream& os, const TelsemAtlas& ta) {
   os << ta.name << std::endl;
   return os;
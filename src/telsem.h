@@ -279,6 +279,65 @@ class TelsemAtlas {
                                           const ConstVectorView &ev,
                                           const ConstVectorView &eh) const;
 
+  /*! Interpolate emissivities to given zenith angle and several frequencies.
+     *
+     * Gives the same result as calling the scalar version for each
+     * frequency, but the angular dependence is only evaluated once.
+     *
+     * @param[out] e_v The vertical emissivities for each frequency
+     * @param[out] e_h The horizontal emissivities for each frequency
+     * @param theta The zenith angle
+     * @param freq  The frequencies in GHz (!!!)
+     * @param class1 The surface type class
+     * @param class2 The sruface type class
+     * @param ev The vertical emissivities from the atlas
+     * @param eh The horizontal emissivities from atlas
+     */
+  void emis_interp(VectorView e_v,
+                   VectorView e_h,
+                   Numeric theta,
+                   ConstVectorView freq,
+                   Index class1,
+                   Index class2,
+                   const ConstVectorView &ev,
+                   const ConstVectorView &eh) const;
+
+  /*! Find the atlas cell to use for given coordinates.
+     *
+     * If the cell containing the coordinates is not in the atlas, the
+     * nearest cell of the atlas is used if it is within d_max. Otherwise,
+     * or if d_max is not positive, a runtime error is thrown.
+     *
+     * @param lat The latitude
+     * @param lon The longitude, in [0, 360]
+     * @param d_max Maximum distance for nearest neighbor interpolation
+     *
+     * @return The cell number
+     */
+  Index find_cell(Numeric lat, Numeric lon, Numeric d_max) const;
+
+  /*! Emissivities for many positions.
+     *
+     * Evaluates the emissivities at all positions and frequencies. The
+     * positions are sorted by atlas cell before the interpolation, and
+     * positions are processed in parallel.
+     *
+     * @param[out] emissivities Emissivities, size [position, frequency, 2],
+     *                  with the vertical and horizontal emissivity in the
+     *                  last dimension
+     * @param lat The latitude of each position
+     * @param lon The longitude of each position, in [0, 360]
+     * @param theta The zenith angle of each position
+     * @param freq The frequencies in GHz (!!!)
+     * @param d_max Maximum distance for nearest neighbor interpolation
+     */
+  void emis_interp_batch(Tensor3 &emissivities,
+                         ConstVectorView lat,
+                         ConstVectorView lon,
+                         ConstVectorView theta,
+                         ConstVectorView freq,
+                         Numeric d_max) const;
+
   friend std::ostream &operator<<(std::ostream &os, const TelsemAtlas &ta);
   friend void xml_write_to_stream(ostream &,
                                   const TelsemAtlas &,
@@ -347,6 +406,18 @@ class TelsemAtlas {
   Numeric RAPPORT54_43(Index i) {return rapport54_43[i];}
   
  private:
+  /*! Angular dependence of the emissivities at the SSMI frequencies.
+     *
+     * @param[out] emiss_scal_v The vertical emissivities at 19, 37, 85 GHz
+     * @param[out] emiss_scal_h The horizontal emissivities at 19, 37, 85 GHz
+     */
+  void emis_scal(Numeric *emiss_scal_v,
+                 Numeric *emiss_scal_h,
+                 Numeric theta,
+                 Index class1,
+                 const ConstVectorView &ev,
+                 const ConstVectorView &eh) const;
+
   // Number of lines in the Atlas.
   Index ndat;
   // Number of channels in the Atlas.
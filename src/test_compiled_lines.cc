@@ -0,0 +1,111 @@
+#include <autoarts.h>
+#include "absorptionlines.h"
+#include "linefunctions.h"
+#include "test_utils.h"
+
+//! A band of lines with three broadening species.
+/*!
+  All line shape variables are set for all species, with a different
+  temperature model for each species and different values for each line.
+*/
+Absorption::Lines three_species_band(Numeric linemixinglimit) {
+  using LineShape::ModelParameters;
+  using LineShape::TemperatureModel;
+
+  const std::array<TemperatureModel, 3> models{
+      TemperatureModel::T1, TemperatureModel::T2, TemperatureModel::DPL};
+
+  std::vector<Absorption::SingleLine> lines;
+  for (Index i = 0; i < 7; i++) {
+    std::vector<LineShape::SingleSpeciesModel> ssm(3);
+    for (Index k = 0; k < 3; k++) {
+      const Numeric x = 1 + 0.1 * Numeric(i) + 0.01 * Numeric(k);
+      for (auto& mp : ssm[k].Data())
+        mp = ModelParameters(models[k], 2e4 * x, 0.7 * x, 0.1 * x, 0.3 * x);
+    }
+    ssm[0].Y() = ModelParameters(TemperatureModel::LM_AER, 1e-5, 2e-5, 3e-5, 4e-5);
+    lines.emplace_back(60e9 + 1e9 * Numeric(i), 1e-20, 1e-21, 1, 1, 1e-3,
+                       Zeeman::Model(), LineShape::Model(ssm));
+  }
+
+  return make_band(lines,
+                   {SpeciesTag("N2"), SpeciesTag("O2"), SpeciesTag("H2O")},
+                   QuantumIdentifier(),
+                   linemixinglimit);
+}
+
+//! Compares the compiled and per line shape parameters bit for bit.
+bool same_shape_parameters(const Absorption::Lines& band,
+                           Numeric T,
+                           Numeric P,
+                           const Vector& vmrs) {
+  const Absorption::CompiledLines compiled(band);
+  std::vector<LineShape::Output> X;
+  compiled.ShapeParameters(X, band, T, P, vmrs);
+  if (Index(X.size()) != band.NumLines()) return false;
+
+  for (Index i = 0; i < band.NumLines(); i++) {
+    const LineShape::Output x = band.ShapeParameters(i, T, P, vmrs);
+    if (x.G0 != X[i].G0 or x.D0 != X[i].D0 or x.G2 != X[i].G2 or
+        x.D2 != X[i].D2 or x.FVC != X[i].FVC or x.ETA != X[i].ETA or
+        x.Y != X[i].Y or x.G != X[i].G or x.DV != X[i].DV)
+      return false;
+  }
+  return true;
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  const Vector vmrs{0.78, 0.21, 0.01};
+  for (Numeric T : {180.0, 250.0, 296.0, 320.0}) {
+    std::ostringstream os;
+    os << "T = " << T;
+    check("Line mixing, " + os.str(),
+          same_shape_parameters(three_species_band(-1), T, 5e4, vmrs));
+    check("Line mixing above the limit, " + os.str(),
+          same_shape_parameters(three_species_band(1e4), T, 5e4, vmrs));
+  }
+
+  // Line mixing off above the limit must also be zero in the compiled
+  // parameters
+  const Absorption::Lines band = three_species_band(1e4);
+  std::vector<LineShape::Output> X;
+  Absorption::CompiledLines(band).ShapeParameters(X, band, 250, 5e4, vmrs);
+  bool zero = true;
+  for (auto& x : X) zero = zero and x.Y == 0 and x.G == 0 and x.DV == 0;
+  check("No line mixing above the limit", zero);
+
+  // The line strengths as apply_linestrength_scaling_by_lte scales a line
+  std::vector<Numeric> S;
+  band.Compiled()->LineStrengths(S, 250, band.T0(), 0.9, 300, 280);
+  bool same_strength = Index(S.size()) == band.NumLines();
+  for (Index i = 0; same_strength and i < band.NumLines(); i++) {
+    Eigen::VectorXcd F = Eigen::VectorXcd::Ones(1), N(1);
+    Eigen::MatrixXcd dF(1, 0), dN(1, 0);
+    Linefunctions::apply_linestrength_scaling_by_lte(
+        F, dF, N, dN, band.Line(i), 250, band.T0(), 0.9, 300, 280, band, i,
+        {}, {}, 0);
+    same_strength = F[0].real() == S[i];
+  }
+  check("Compiled line strengths", same_strength);
+
+  // The band keeps its compiled copy until it is changed
+  Absorption::Lines changed = three_species_band(-1);
+  const auto compiled = changed.Compiled();
+  check("Compiled band is kept", changed.Compiled() == compiled);
+  changed.F0(0) = 70e9;
+  check("Compiled band is rebuilt after a change",
+        changed.Compiled() != compiled and
+            changed.Compiled()->ByFrequency() ==
+                std::vector<Index>{1, 2, 3, 4, 5, 6, 0});
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
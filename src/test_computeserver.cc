@@ -0,0 +1,106 @@
+#include <autoarts.h>
+#include "computeserver.h"
+
+namespace ARTS::Agenda {
+  Workspace& forloop_agenda_double_f_grid(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    forloop_agenda(ws, Ignore(ws, forloop_index(ws)),
+                   VectorScale(ws, f_grid(ws), f_grid(ws),
+                               NumericCreate(ws, 2, "test_factor")));
+    return ws;
+  }
+}  // namespace ARTS::Agenda
+
+//! Fails the test if the status of a request is not the expected one.
+void check_status(const String& what,
+                  unsigned int status,
+                  unsigned int expected,
+                  const String& response) {
+  std::cout << what << ": " << status << '\n';
+  if (status != expected) {
+    std::ostringstream os;
+    os << what << " returned " << status << " instead of " << expected
+       << ":\n" << response;
+    throw std::runtime_error(os.str());
+  }
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  ARTS::Agenda::forloop_agenda_double_f_grid(ws);
+
+  unsetenv("ARTS_COMPUTESERVER_TOKEN");
+  Computeserver server(ws, -1, Var::verbosity(ws).value());
+  const String token = server.token();
+  String response;
+  Index response_length;
+
+  // Access: token, host and origin
+  if (token.size() != 32)
+    throw std::runtime_error("Random token has the wrong length");
+  check_status("No token",
+               server.check_access(nullptr, "localhost:9001", nullptr, response),
+               403, response);
+  check_status("Wrong token",
+               server.check_access("0123", "localhost:9001", nullptr, response),
+               403, response);
+  check_status("Remote host",
+               server.check_access(token.c_str(), "example.com:9001", nullptr, response),
+               403, response);
+  check_status("Remote origin",
+               server.check_access(token.c_str(), "localhost:9001", "http://example.com", response),
+               403, response);
+  check_status("Local access",
+               server.check_access(token.c_str(), "127.0.0.1:9001", "http://localhost:9001", response),
+               200, response);
+
+  // PUT, POST and GET
+  const String xml =
+      "<?xml version=\"1.0\"?>\n"
+      "<arts format=\"ascii\" version=\"1\">\n"
+      "<Vector nelem=\"3\">\n1\n2\n3\n</Vector>\n"
+      "</arts>\n";
+  check_status("PUT f_grid",
+               server.handle("PUT", "/variables/f_grid", "ascii", xml, -1, response, response_length),
+               200, response);
+  check_status("POST forloop_agenda",
+               server.handle("POST", "/agendas/forloop_agenda", "ascii", "", -1, response, response_length),
+               200, response);
+  check_status("GET f_grid",
+               server.handle("GET", "/variables/f_grid", "ascii", "", -1, response, response_length),
+               200, response);
+
+  const Vector& f_grid = Var::f_grid(ws).value();
+  if (f_grid.nelem() != 3 or f_grid[0] != 2 or f_grid[1] != 4 or f_grid[2] != 6)
+    throw std::runtime_error("The agenda was not applied to f_grid");
+  if (response.find("<Vector nelem=\"3\">") == std::string::npos or response_length != -1)
+    throw std::runtime_error("GET did not return f_grid as ASCII XML");
+
+  check_status("GET binary f_grid",
+               server.handle("GET", "/variables/f_grid", "binary", "", -1, response, response_length),
+               200, response);
+  if (response_length < 0 or Index(response.size()) != response_length + 3 * 8)
+    throw std::runtime_error("GET did not return f_grid as binary XML");
+
+  check_status("GET unknown variable",
+               server.handle("GET", "/variables/no_such_variable", "ascii", "", -1, response, response_length),
+               404, response);
+  check_status("POST to a variable",
+               server.handle("POST", "/agendas/f_grid", "ascii", "", -1, response, response_length),
+               400, response);
+  check_status("PUT invalid XML",
+               server.handle("PUT", "/variables/f_grid", "ascii", "<Vector>", -1, response, response_length),
+               400, response);
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
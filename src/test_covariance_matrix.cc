@@ -309,6 +309,75 @@ Numeric test_inverse(Index n_tests) {
   return e;
 }
 
+/**
+ * Tests the inversion of covariance matrices with diagonal, banded and
+ * dense blocks, which are inverted according to their structure.
+ *
+ * @param  n_tests The number of tests to perform
+ * @return The maximum error of the product of the inverse and the matrix
+ * with respect to the identity matrix
+ */
+Numeric test_structured_inverse(Index n_tests) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<> n_dist(10, 100);
+  std::uniform_real_distribution<> dis(0.1, 1.0);
+
+  Numeric e = 0.0;
+  for (Index i = 0; i < n_tests; i++) {
+    CovarianceMatrix covmat{};
+    Index start = 0;
+    for (Index j = 0; j < 3; j++) {
+      Index n = n_dist(gen);
+      Range range(start, n);
+      auto inds = std::make_pair(j, j);
+      start += n;
+
+      if (j == 2) {
+        std::shared_ptr<Matrix> m = std::make_shared<Matrix>(n, n);
+        for (Index k = 0; k < n; k++) {
+          for (Index l = 0; l < n; l++) {
+            (*m)(k, l) = exp(-std::abs(static_cast<Numeric>(k - l)) / 5.0);
+          }
+        }
+        covmat.add_correlation(Block(range, range, inds, m));
+        continue;
+      }
+
+      // Diagonal block for j = 0, tridiagonal block for j = 1.
+      ArrayOfIndex row_indices{}, col_indices{};
+      ArrayOfNumeric elements{};
+      for (Index k = 0; k < n; k++) {
+        row_indices.push_back(k);
+        col_indices.push_back(k);
+        elements.push_back(1.0 + dis(gen));
+        if (j == 1 && k + 1 < n) {
+          Numeric c = -0.5 * dis(gen);
+          row_indices.push_back(k);
+          col_indices.push_back(k + 1);
+          elements.push_back(c);
+          row_indices.push_back(k + 1);
+          col_indices.push_back(k);
+          elements.push_back(c);
+        }
+      }
+      std::shared_ptr<Sparse> m = std::make_shared<Sparse>(n, n);
+      m->insert_elements(
+          elements.size(), row_indices, col_indices, Vector(elements));
+      covmat.add_correlation(Block(range, range, inds, m));
+    }
+
+    Index n = covmat.ncols();
+    Matrix A(covmat), B(n, n), B_ref(n, n);
+
+    covmat.compute_inverse();
+    mult_inv(B, covmat, A);
+    id_mat(B_ref);
+    e = std::max(e, get_maximum_error(B, B_ref, true));
+  }
+  return e;
+}
+
 /**
  * Test addition of covariance matrices and inverse covariance matrices.
  *
@@ -629,6 +698,13 @@ int main() {
     return -1;
   }
 
+  e = test_structured_inverse(10);
+  std::cout << "\tStructured Inverse:      " << e << std::endl;
+  e_max = std::max(e, e_max);
+  if (e_max > 1e-5) {
+    return -1;
+  }
+
   e = test_io(10);
   std::cout << "\tXML IO:                  " << e << std::endl;
   e_max = std::max(e, e_max);
@@ -0,0 +1,274 @@
+/* Copyright (C) 2026 ARTS Developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   test_doit.cc
+  \date   2026-10-15
+
+  \brief  Test of the integration weights of the DOIT scattering integral.
+
+  Integrates a reference field with the weights of
+  doit_scat_integral_weights and compares the result to
+  AngIntegrate_trapezoid, for equidistant and non-equidistant angular grids.
+  Also checks the scattering operator of doit_scat_operator against a direct
+  sum over the incoming directions, the operators kept by DoitScatOperators,
+  and the convergence of a linear
+  fixed-point iteration with and without DoitAndersonMixing.
+*/
+
+#include <cmath>
+#include <iostream>
+
+#include "arts.h"
+#include "doit.h"
+#include "math_funcs.h"
+#include "test_utils.h"
+
+extern const Numeric DEG2RAD;
+extern const Numeric PI;
+
+//! Smooth reference field without symmetries in za and aa.
+Numeric reference_field(const Numeric za, const Numeric aa) {
+  return 1 + 0.5 * cos(za * DEG2RAD) + 0.25 * sin(aa * DEG2RAD) +
+         0.1 * cos(2 * za * DEG2RAD) * cos(aa * DEG2RAD);
+}
+
+//! Sum of the weights times the reference field.
+Numeric weighted_sum(ConstVectorView za_grid, ConstVectorView aa_grid) {
+  Matrix weights;
+  doit_scat_integral_weights(weights, za_grid, aa_grid);
+
+  Numeric sum = 0;
+  for (Index i = 0; i < za_grid.nelem(); i++)
+    for (Index j = 0; j < aa_grid.nelem(); j++)
+      sum += weights(i, j) * reference_field(za_grid[i], aa_grid[j]);
+  return sum;
+}
+
+//! Compares the weighted sum to AngIntegrate_trapezoid.
+void test_weights(const String& name,
+                  ConstVectorView za_grid,
+                  ConstVectorView aa_grid) {
+  const Index nza = za_grid.nelem();
+  const Index naa = aa_grid.nelem();
+
+  Numeric reference;
+  if (naa == 1) {
+    Vector integrand(nza);
+    for (Index i = 0; i < nza; i++)
+      integrand[i] = reference_field(za_grid[i], aa_grid[0]);
+    reference = AngIntegrate_trapezoid(integrand, za_grid) / (2 * PI);
+  } else {
+    Matrix integrand(nza, naa);
+    for (Index i = 0; i < nza; i++)
+      for (Index j = 0; j < naa; j++)
+        integrand(i, j) = reference_field(za_grid[i], aa_grid[j]);
+    reference = AngIntegrate_trapezoid(integrand, za_grid, aa_grid);
+  }
+
+  const Numeric result = weighted_sum(za_grid, aa_grid);
+  std::cout << name << ": " << result << " (reference " << reference
+            << ")\n";
+  check(name, abs(result - reference) <= 1e-12 * abs(reference));
+}
+
+//! Compares doit_scat_operator to a direct sum over incoming directions.
+void test_operator(ConstVectorView za_grid, ConstVectorView aa_grid) {
+  const Index nza = za_grid.nelem();
+  const Index naa = aa_grid.nelem();
+  const Index stokes_dim = 2;
+
+  Matrix weights;
+  doit_scat_integral_weights(weights, za_grid, aa_grid);
+
+  Tensor5 pha_mat(nza, nza, naa, stokes_dim, stokes_dim);
+  for (Index o = 0; o < nza; o++)
+    for (Index i = 0; i < nza; i++)
+      for (Index j = 0; j < naa; j++)
+        for (Index s1 = 0; s1 < stokes_dim; s1++)
+          for (Index s2 = 0; s2 < stokes_dim; s2++)
+            pha_mat(o, i, j, s1, s2) =
+                reference_field(za_grid[o] + 10 * Numeric(s1), aa_grid[j]) *
+                reference_field(za_grid[i], 20 * Numeric(s2));
+
+  Vector field(nza * stokes_dim);
+  for (Index k = 0; k < field.nelem(); k++) field[k] = 1 + 0.1 * Numeric(k);
+
+  Matrix scat_operator;
+  doit_scat_operator(scat_operator, pha_mat, weights);
+  Vector scat(nza * stokes_dim);
+  mult(scat, scat_operator, field);
+
+  Numeric max_diff = 0;
+  for (Index o = 0; o < nza; o++)
+    for (Index s1 = 0; s1 < stokes_dim; s1++) {
+      Numeric direct = 0;
+      for (Index i = 0; i < nza; i++)
+        for (Index j = 0; j < naa; j++)
+          for (Index s2 = 0; s2 < stokes_dim; s2++)
+            direct += weights(i, j) * pha_mat(o, i, j, s1, s2) *
+                      field[i * stokes_dim + s2];
+      max_diff = max(max_diff, abs(scat[o * stokes_dim + s1] - direct) /
+                                   abs(direct));
+    }
+
+  std::cout << "Scattering operator: relative difference " << max_diff << '\n';
+  check("Scattering operator", max_diff <= 1e-12);
+}
+
+//! DoitScatOperators keeps the operators of all levels while in scope.
+void test_operator_cache(ConstVectorView za_grid) {
+  const Index np = 3;
+  const Index nza = za_grid.nelem();
+  const Index stokes_dim = 1;
+  const Vector aa_grid(1, 0);
+
+  Matrix weights, weights_other;
+  doit_scat_integral_weights(weights, za_grid, aa_grid);
+  weights_other = weights;
+  weights_other *= 2;
+
+  Tensor7 pha_mat_doit(np, nza, 1, nza, 1, stokes_dim, stokes_dim);
+  for (Index p = 0; p < np; p++)
+    for (Index o = 0; o < nza; o++)
+      for (Index i = 0; i < nza; i++)
+        pha_mat_doit(p, o, 0, i, 0, 0, 0) =
+            Numeric(p + 1) * reference_field(za_grid[o], za_grid[i]);
+
+  bool same_as_single = true;
+  Tensor3 local;
+  const Tensor3& uncached = DoitScatOperators::Get(local, pha_mat_doit, weights);
+  for (Index p = 0; p < np; p++) {
+    Matrix scat_operator;
+    doit_scat_operator(scat_operator,
+                       pha_mat_doit(p, joker, 0, joker, joker, joker, joker),
+                       weights);
+    for (Index r = 0; r < scat_operator.nrows(); r++)
+      for (Index c = 0; c < scat_operator.ncols(); c++)
+        same_as_single =
+            same_as_single && uncached(p, r, c) == scat_operator(r, c);
+  }
+
+  bool kept, rebuilt, restored;
+  {
+    DoitScatOperators scope;
+    Tensor3 unused;
+    const Tensor3& first = DoitScatOperators::Get(unused, pha_mat_doit, weights);
+    const Numeric first_value = first(1, 2, 3);
+    const Tensor3& second =
+        DoitScatOperators::Get(unused, pha_mat_doit, weights);
+    kept = &first == &second && unused.npages() == 0;
+    const Tensor3& other =
+        DoitScatOperators::Get(unused, pha_mat_doit, weights_other);
+    rebuilt = other(1, 2, 3) == 2 * first_value;
+  }
+  Tensor3 after;
+  DoitScatOperators::Get(after, pha_mat_doit, weights);
+  restored = after.npages() == np;
+
+  check("Operators of all levels", same_as_single);
+  check("Operators kept within the scope", kept);
+  check("Operators rebuilt for new weights", rebuilt);
+  check("No cache outside of the scope", restored);
+}
+
+//! Iterates the linear map x -> lambda * x + c until the update is below tol.
+/*!
+  The loop follows cloudbox_field_monoIterate: the convergence test comes before the
+  mixing, and depth < 0 means no DoitAndersonMixing at all.
+
+  \return The number of iterations, or -1 without convergence.
+*/
+Index iterate_linear_map(Tensor6& x,
+                         ConstVectorView lambda,
+                         ConstVectorView c,
+                         const Index depth) {
+  const Index n = lambda.nelem();
+  const Numeric tol = 1e-10;
+  x = Tensor6(1, 1, 1, n, 1, 1, 0);
+  DoitAndersonMixing anderson(max(depth, Index(0)));
+  for (Index k = 1; k <= 10000; k++) {
+    const Tensor6 x_old = x;
+    Numeric max_diff = 0;
+    for (Index i = 0; i < n; i++) {
+      const Numeric xi = x_old(0, 0, 0, i, 0, 0);
+      x(0, 0, 0, i, 0, 0) = lambda[i] * xi + c[i];
+      max_diff = max(max_diff, abs(x(0, 0, 0, i, 0, 0) - xi));
+    }
+    if (max_diff < tol) return k;
+    if (depth >= 0) anderson.update(x, x_old);
+  }
+  return -1;
+}
+
+//! Anderson mixing converges faster, and depth 0 is plain iteration.
+void test_anderson() {
+  const Index n = 40;
+  Vector lambda(n), c(n);
+  for (Index i = 0; i < n; i++) {
+    lambda[i] = 0.5 + 0.45 * Numeric(i) / Numeric(n - 1);
+    c[i] = 1 + 0.1 * Numeric(i);
+  }
+
+  Tensor6 x_plain, x_depth0, x_anderson;
+  const Index k_plain = iterate_linear_map(x_plain, lambda, c, -1);
+  const Index k_depth0 = iterate_linear_map(x_depth0, lambda, c, 0);
+  const Index k_anderson = iterate_linear_map(x_anderson, lambda, c, 5);
+
+  bool same = k_depth0 == k_plain;
+  for (Index i = 0; i < n; i++)
+    same = same && x_depth0(0, 0, 0, i, 0, 0) == x_plain(0, 0, 0, i, 0, 0);
+
+  Numeric max_err = 0;
+  for (Index i = 0; i < n; i++)
+    max_err = max(max_err, abs(x_anderson(0, 0, 0, i, 0, 0) -
+                               c[i] / (1 - lambda[i])));
+
+  std::cout << "Anderson mixing: " << k_plain << " plain iterations, "
+            << k_depth0 << " with depth 0, " << k_anderson
+            << " with depth 5 (error " << max_err << ")\n";
+  check("Plain iteration converges", k_plain > 0);
+  check("Depth 0 is plain iteration", same);
+  check("Anderson mixing converges faster",
+        k_anderson > 0 && k_anderson < k_plain);
+  check("Anderson mixing converges to the fixed point", max_err < 1e-6);
+}
+
+int main() try {
+  Vector za_equidistant, aa_equidistant;
+  nlinspace(za_equidistant, 0, 180, 19);
+  nlinspace(aa_equidistant, 0, 360, 13);
+
+  // Denser around the horizon, as the grids from za_gridOpt
+  const Vector za_irregular{0, 20, 50, 70, 80, 85, 88, 90, 92, 95, 100, 120,
+                            150, 180};
+  const Vector aa_irregular{0, 10, 45, 90, 180, 270, 300, 360};
+  const Vector aa_single(1, 0);
+
+  test_weights("Equidistant grids", za_equidistant, aa_equidistant);
+  test_weights("Irregular grids", za_irregular, aa_irregular);
+  test_weights("Single azimuth angle, equidistant", za_equidistant, aa_single);
+  test_weights("Single azimuth angle, irregular", za_irregular, aa_single);
+  test_operator(za_irregular, aa_irregular);
+  test_operator_cache(za_irregular);
+  test_anderson();
+
+  return EXIT_SUCCESS;
+} catch (const std::exception& e) {
+  std::cerr << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  return EXIT_FAILURE;
+}
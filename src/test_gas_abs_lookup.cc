@@ -0,0 +1,213 @@
+#include <autoarts.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include "gas_abs_lookup.h"
+#include "physics_funcs.h"
+#include "test_utils.h"
+
+//! Cross-section of the test tables at a point, see make_table.
+Numeric xsec_model(bool perturbations,
+                   Index si,
+                   Numeric T_offset,
+                   Numeric h2o_frac,
+                   Numeric p,
+                   Numeric fi) {
+  if (not perturbations) T_offset = 0, h2o_frac = 0;
+  return 1e-25 * (1 + 0.01 * T_offset + (si == 0 ? 0.1 * h2o_frac : 1) +
+                  0.2 * log(p) + 0.3 * fi);
+}
+
+//! A table of H2O and O2.
+/*!
+  With perturbations, H2O is a nonlinear species and there are temperature
+  perturbations, otherwise the table has neither. The cross-sections are
+  linear in the temperature offset, the fractional H2O VMR, log(p) and the
+  frequency, so the interpolation of the table reproduces xsec_model.
+*/
+GasAbsLookup make_table(bool perturbations) {
+  GasAbsLookup gal;
+  gal.Species() = {ArrayOfSpeciesTag{SpeciesTag("H2O")},
+                   ArrayOfSpeciesTag{SpeciesTag("O2")}};
+  gal.Fgrid() = Vector{100e9, 200e9, 300e9};
+  gal.Pgrid() = Vector{1000e2, 500e2, 200e2, 100e2, 50e2};
+  gal.VMRs() = Matrix(2, 5);
+  gal.VMRs()(0, joker) = 1e-2;
+  gal.VMRs()(1, joker) = 0.21;
+  gal.Tref() = Vector(5, 250);
+  if (perturbations) {
+    gal.NonLinearSpecies() = ArrayOfIndex(1, 0);
+    gal.Tpert() = Vector{-20, -10, 0, 10, 20};
+    gal.NLSPert() = Vector{0, 0.5, 1, 2, 5};
+  }
+
+  const Vector& t_pert = gal.Tpert();
+  const Vector& nls_pert = gal.NLSPert();
+  const Vector& p_grid = gal.Pgrid();
+  const Index n_nls_pert = perturbations ? nls_pert.nelem() : 1;
+  Tensor4& xsec = gal.Xsec();
+  xsec.resize(perturbations ? t_pert.nelem() : 1, n_nls_pert + 1, 3, 5);
+  for (Index it = 0; it < xsec.nbooks(); it++)
+    for (Index ix = 0; ix < xsec.npages(); ix++)
+      for (Index fi = 0; fi < xsec.nrows(); fi++)
+        for (Index ip = 0; ip < xsec.ncols(); ip++) {
+          const Index si = ix < n_nls_pert ? 0 : 1;
+          xsec(it, ix, fi, ip) = xsec_model(
+              perturbations,
+              si,
+              perturbations ? t_pert[it] : 0,
+              perturbations and si == 0 ? nls_pert[ix] : 0,
+              p_grid[ip],
+              Numeric(fi));
+        }
+  return gal;
+}
+
+//! Compares batched and per-point extraction with the table model.
+/*!
+  \return The largest relative deviation of the batched extraction from
+  xsec_model. Throws if the batched extraction differs from the single
+  point extraction.
+*/
+Numeric compare_extract(const GasAbsLookup& gal,
+                        bool perturbations,
+                        Index interp_order,
+                        Index f_interp_order,
+                        const Vector& f_grid) {
+  // Points between and on the pressure, temperature and H2O grids
+  const Vector p{1000e2, 800e2, 500e2, 300e2, 120e2, 75e2, 50e2};
+  const Vector T{250, 255, 231, 268, 249.5, 242, 270};
+  Matrix vmrs(2, p.nelem());
+  vmrs(0, joker) = Vector{1e-2, 1.5e-2, 2e-3, 0, 4.5e-2, 7e-3, 1e-2};
+  vmrs(1, joker) = 0.21;
+
+  Tensor3 sga;
+  gal.Extract(sga, interp_order, interp_order, interp_order, f_interp_order,
+              p, T, vmrs, f_grid, 0.5);
+
+  Numeric error = 0;
+  for (Index ip = 0; ip < p.nelem(); ip++) {
+    Matrix sga_point;
+    gal.Extract(sga_point, interp_order, interp_order, interp_order,
+                f_interp_order, p[ip], T[ip], vmrs(joker, ip), f_grid, 0.5);
+    if (sga_point.nrows() != sga.nrows() or sga_point.ncols() != sga.ncols())
+      throw std::runtime_error("Wrong size of single point extraction");
+
+    const Numeric n = number_density(p[ip], T[ip]);
+    for (Index si = 0; si < sga.nrows(); si++)
+      for (Index fi = 0; fi < sga.ncols(); fi++) {
+        if (sga_point(si, fi) != sga(ip, si, fi))
+          throw std::runtime_error(
+              "Batched and single point extraction differ");
+        const Numeric ref =
+            xsec_model(perturbations, si, T[ip] - 250, vmrs(0, ip) / 1e-2,
+                       p[ip], (f_grid[fi] - 100e9) / 100e9) *
+            n * vmrs(si, ip);
+        if (ref != 0)
+          error = std::max(error, std::abs(sga(ip, si, fi) / ref - 1));
+        else
+          error = std::max(error, std::abs(sga(ip, si, fi)));
+      }
+  }
+  return error;
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+  const Verbosity& verbosity = Var::verbosity(ws).value();
+
+  const GasAbsLookup table = make_table(true);
+  const String filename = "test_gas_abs_lookup.lut";
+
+  // Write, map and write the mapped table over the file it is mapped from
+  table.WriteMapped(filename, verbosity);
+  GasAbsLookup mapped;
+  mapped.ReadMapped(filename, verbosity);
+  check("Mapped cross-sections",
+        mapped.GetXsec().nbooks() == 5 and mapped.GetXsec().npages() == 6 and
+            mapped.GetXsec()(4, 5, 2, 4) == table.GetXsec()(4, 5, 2, 4));
+  mapped.WriteMapped(filename, verbosity);
+  GasAbsLookup reread;
+  reread.ReadMapped(filename, verbosity);
+  std::remove(filename.c_str());
+
+  bool same = true;
+  const ConstTensor4View x0 = table.GetXsec(), x1 = mapped.GetXsec(),
+                         x2 = reread.GetXsec();
+  for (Index it = 0; it < x0.nbooks(); it++)
+    for (Index ix = 0; ix < x0.npages(); ix++)
+      for (Index fi = 0; fi < x0.nrows(); fi++)
+        for (Index ip = 0; ip < x0.ncols(); ip++)
+          same = same and x0(it, ix, fi, ip) == x1(it, ix, fi, ip) and
+                 x0(it, ix, fi, ip) == x2(it, ix, fi, ip);
+  check("Cross-sections after rewriting the mapped file", same);
+
+  // Extraction from the mapped table
+  GasAbsLookup owned = table;
+  const ArrayOfArrayOfSpeciesTag species = owned.Species();
+  const Vector f_grid = owned.Fgrid();
+  owned.Adapt(species, f_grid, verbosity);
+  reread.Adapt(species, f_grid, verbosity);
+
+  const Vector p{800e2, 75e2};
+  const Vector T{255, 242};
+  Matrix vmrs(2, 2);
+  vmrs(0, joker) = Vector{1.5e-2, 2e-3};
+  vmrs(1, joker) = 0.21;
+  Tensor3 sga_owned, sga_mapped;
+  owned.Extract(sga_owned, 1, 1, 1, 0, p, T, vmrs, f_grid, 0.5);
+  reread.Extract(sga_mapped, 1, 1, 1, 0, p, T, vmrs, f_grid, 0.5);
+  same = true;
+  for (Index ip = 0; ip < sga_owned.npages(); ip++)
+    for (Index si = 0; si < sga_owned.nrows(); si++)
+      for (Index fi = 0; fi < sga_owned.ncols(); fi++)
+        same = same and sga_owned(ip, si, fi) == sga_mapped(ip, si, fi);
+  check("Extract from the mapped table", same);
+
+  // Points extracted in advance
+  {
+    auto find = [&](Matrix& sga, Numeric t) {
+      return GasAbsLookupPrefetch::Find(
+          sga, owned, 1, 1, 1, 0, p[1], t, vmrs(joker, 1), f_grid, 0.5);
+    };
+    Matrix found, extracted;
+    owned.Extract(
+        extracted, 1, 1, 1, 0, p[1], T[1], vmrs(joker, 1), f_grid, 0.5);
+    {
+      const GasAbsLookupPrefetch prefetch(
+          owned, 1, 1, 1, 0, p, T, vmrs, f_grid, 0.5);
+      same = find(found, T[1]) and found.nrows() == extracted.nrows() and
+             found.ncols() == extracted.ncols();
+      for (Index si = 0; same and si < found.nrows(); si++)
+        for (Index fi = 0; fi < found.ncols(); fi++)
+          same = same and found(si, fi) == extracted(si, fi);
+      check("Prefetched point", same);
+      check("Point that is not prefetched", not find(found, T[1] + 1));
+    }
+    check("Prefetch released", not find(found, T[1]));
+  }
+
+  // Batched extraction, with temperature and nonlinear H2O interpolation
+  // and for a table without perturbations
+  const Vector f_between{150e9, 250e9};
+  for (Index order = 1; order < 3; order++) {
+    std::ostringstream what;
+    what << "Batched extraction, interpolation order " << order;
+    check(what.str(), compare_extract(owned, true, order, 0, f_grid) < 1e-12);
+    check(what.str() + ", between frequencies",
+          compare_extract(owned, true, order, 1, f_between) < 1e-12);
+  }
+  GasAbsLookup simple = make_table(false);
+  simple.Adapt(species, f_grid, verbosity);
+  check("Batched extraction without perturbations",
+        compare_extract(simple, false, 1, 0, f_grid) < 1e-12);
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
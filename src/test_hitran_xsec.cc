@@ -0,0 +1,99 @@
+#include <autoarts.h>
+#include <cmath>
+#include "hitran_xsec.h"
+#include "test_utils.h"
+
+//! A cross section with a few peaks on a background.
+Vector make_xsec(Index n) {
+  Vector xsec(n);
+  for (Index i = 0; i < n; i++)
+    xsec[i] = 1e-22 * (1 + 0.5 * std::sin(0.3 * Numeric(i)) +
+                       (i % 17 == 3 ? 4 : 0));
+  return xsec;
+}
+
+//! A normalised Lorentz line shape centered on the grid.
+Vector make_lorentz(Index n, Numeric gamma) {
+  Vector lorentz(n);
+  Numeric sum = 0;
+  for (Index i = 0; i < n; i++) {
+    const Numeric x = Numeric(i - n / 2);
+    lorentz[i] = gamma / (x * x + gamma * gamma);
+    sum += lorentz[i];
+  }
+  lorentz /= sum;
+  return lorentz;
+}
+
+//! Largest difference relative to the largest value of b.
+Numeric max_rel_diff(const Vector& a, const Vector& b) {
+  if (a.nelem() != b.nelem()) return std::numeric_limits<Numeric>::infinity();
+  Numeric d = 0, m = 0;
+  for (Index i = 0; i < a.nelem(); i++) {
+    d = std::max(d, std::abs(a[i] - b[i]));
+    m = std::max(m, std::abs(b[i]));
+  }
+  return d / m;
+}
+
+//! The centered part of the full convolution, summed term by term.
+Vector reference_convolution(const Vector& xsec, const Vector& lorentz) {
+  const Index nx = xsec.nelem(), nl = lorentz.nelem();
+  Vector result(nx, 0);
+  for (Index i = 0; i < nx; i++)
+    for (Index j = 0; j < nl; j++) {
+      const Index k = i + nl / 2 - j;
+      if (k >= 0 and k < nx) result[i] += xsec[k] * lorentz[j];
+    }
+  return result;
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  // Lengths of xsec and line shape, as odd and even transform lengths
+  const ArrayOfIndex nxsec{200, 57, 200, 1000};
+  const ArrayOfIndex nlorentz{101, 57, 101, 250};
+
+  for (Index c = 0; c < nxsec.nelem(); c++) {
+    std::ostringstream os;
+    os << nxsec[c] << " values, " << nlorentz[c] << " line shape values";
+
+    const Vector xsec = make_xsec(nxsec[c]);
+    const Vector lorentz = make_lorentz(nlorentz[c], 3.5);
+
+    Vector direct;
+    convolve(direct, xsec, lorentz);
+    check("convolve, " + os.str(),
+          max_rel_diff(direct, reference_convolution(xsec, lorentz)) < 1e-14);
+
+#ifdef ENABLE_FFTW
+    // Repeated calls reuse the cached plans of the transform length, and
+    // the third case repeats the length of the first after another one
+    Vector fft(xsec.nelem());
+    VectorView fft_view = fft;
+    fftconvolve(fft_view, xsec, lorentz);
+    check("fftconvolve matches convolve, " + os.str(),
+          max_rel_diff(fft, direct) < 1e-12);
+
+    Vector again(xsec.nelem());
+    VectorView again_view = again;
+    fftconvolve(again_view, xsec, lorentz);
+    check("Cached plan gives the same result, " + os.str(),
+          max_rel_diff(again, fft) == 0);
+#endif /* ENABLE_FFTW */
+  }
+
+#ifndef ENABLE_FFTW
+  std::cout << "ARTS was compiled without FFTW, fftconvolve is not tested\n";
+#endif /* ENABLE_FFTW */
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
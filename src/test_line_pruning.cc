@@ -0,0 +1,123 @@
+#include <autoarts.h>
+#include "absorptionlines.h"
+#include "linefunctions.h"
+#include "test_utils.h"
+
+//! A band of five strong lines and one weak line far from them.
+Absorption::Lines pruning_band() {
+  using LineShape::ModelParameters;
+  using LineShape::TemperatureModel;
+
+  std::vector<Absorption::SingleLine> lines;
+  auto add_line = [&](Numeric F0, Numeric I0) {
+    std::vector<LineShape::SingleSpeciesModel> ssm(1);
+    ssm[0].G0() = ModelParameters(TemperatureModel::T1, 2e4, 0.7);
+    lines.emplace_back(F0, I0, 1e-21, 1, 1, 1e-3, Zeeman::Model(),
+                       LineShape::Model(ssm));
+  };
+  for (Index i = 0; i < 5; i++) add_line(100e9 + 2e9 * Numeric(i), 1e-20);
+  add_line(500e9, 1e-24);
+
+  return make_band(lines, {SpeciesTag("N2")});
+}
+
+//! Cross-section of the band with the current pruning tolerance.
+Eigen::VectorXcd cross_section(const Absorption::Lines& band,
+                               const Vector& f_grid,
+                               Numeric P,
+                               Numeric T) {
+  Linefunctions::InternalData scratch(f_grid.nelem(), 0), sum(f_grid.nelem(), 0);
+  const Numeric DC = Linefunctions::DopplerConstant(T, 28);
+  Linefunctions::set_cross_section_of_band(
+      scratch, sum, f_grid, band, ArrayOfRetrievalQuantity(), ArrayOfIndex(),
+      Vector(1, 1), EnergyLevelMap(), P, T, 1, 0, DC,
+      Linefunctions::dDopplerConstant_dT(T, DC), 1, 0, 1);
+  return sum.F;
+}
+
+//! Compares two cross-sections bit for bit.
+bool same(const Eigen::VectorXcd& a, const Eigen::VectorXcd& b) {
+  if (a.size() != b.size()) return false;
+  for (Index i = 0; i < a.size(); i++)
+    if (a[i] != b[i]) return false;
+  return true;
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  const Absorption::Lines band = pruning_band();
+  Vector f_grid;
+  nlinspace(f_grid, 95e9, 115e9, 201);
+  std::vector<Numeric> f_sorted(f_grid.begin(), f_grid.end());
+  const Numeric P = 1e4, T = 250;
+  const Numeric DC = Linefunctions::DopplerConstant(T, 28);
+  std::vector<LineShape::Output> X;
+  std::vector<Numeric> S;
+  band.Compiled()->ShapeParameters(X, band, T, P, Vector(1, 1));
+  band.Compiled()->LineStrengths(S, T, band.T0(), 1, 1, 1);
+
+  // Nothing is pruned by default or with a tolerance of 0
+  check("Default tolerance", Linefunctions::line_pruning_tolerance() == 0);
+  const Eigen::VectorXcd F = cross_section(band, f_grid, P, T);
+  check("No lines flagged with tolerance 0",
+        Linefunctions::find_negligible_lines(f_sorted, band, X, S, {}, {},
+                                             DC, 0)
+            .empty());
+
+  Method::SetLinePruningTolerance(ws, 1e-300);
+  check("Tiny tolerance flags no line", [&]() {
+    for (bool x : Linefunctions::find_negligible_lines(
+             f_sorted, band, X, S, {}, {}, DC, 1e-300))
+      if (x) return false;
+    return true;
+  }());
+  check("Tiny tolerance gives identical absorption",
+        same(cross_section(band, f_grid, P, T), F));
+
+  Method::SetLinePruningTolerance(ws, 0);
+  check("Tolerance 0 gives identical absorption",
+        same(cross_section(band, f_grid, P, T), F));
+
+  // The far, weak line is skipped, and the absorption changes by less than
+  // the tolerance
+  const Numeric tolerance = 1e-6;
+  const std::vector<bool> negligible = Linefunctions::find_negligible_lines(
+      f_sorted, band, X, S, {}, {}, DC, tolerance);
+  check("Only the far, weak line is flagged",
+        negligible == std::vector<bool>{false, false, false, false, false,
+                                        true});
+
+  // The same lines in decreasing frequency order
+  Absorption::Lines reversed = band;
+  reversed.ReverseLines();
+  std::vector<LineShape::Output> X_reversed;
+  std::vector<Numeric> S_reversed;
+  reversed.Compiled()->ShapeParameters(X_reversed, reversed, T, P,
+                                       Vector(1, 1));
+  reversed.Compiled()->LineStrengths(S_reversed, T, reversed.T0(), 1, 1, 1);
+  check("Lines out of frequency order",
+        Linefunctions::find_negligible_lines(f_sorted, reversed, X_reversed,
+                                             S_reversed, {}, {}, DC,
+                                             tolerance) ==
+            std::vector<bool>(negligible.crbegin(), negligible.crend()));
+
+  Method::SetLinePruningTolerance(ws, tolerance);
+  const Eigen::VectorXcd F_pruned = cross_section(band, f_grid, P, T);
+  Method::SetLinePruningTolerance(ws, 0);
+  check("Pruning changes the absorption", not same(F_pruned, F));
+  const Numeric max_abs = F.real().cwiseAbs().maxCoeff();
+  const Numeric max_diff = (F_pruned.real() - F.real()).cwiseAbs().maxCoeff();
+  std::cout << "Relative change of the absorption: " << max_diff / max_abs
+            << '\n';
+  check("Change below the tolerance", max_diff < tolerance * max_abs);
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
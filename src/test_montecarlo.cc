@@ -0,0 +1,199 @@
+#include <autoarts.h>
+#include <cmath>
+#include "test_utils.h"
+
+namespace ARTS::Agenda {
+  Workspace& iy_space_agenda_cosmic_background(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    iy_space_agenda(ws, Ignore(ws, rtp_pos(ws)), Ignore(ws, rtp_los(ws)),
+                    MatrixCBR(ws, iy(ws), f_grid(ws)));
+    return ws;
+  }
+
+  Workspace& ppath_step_agenda_geometric_path(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    ppath_step_agenda(ws, Ignore(ws, ppath_lraytrace(ws)), Ignore(ws, f_grid(ws)),
+                      ppath_stepGeometric(ws));
+    return ws;
+  }
+
+  Workspace& propmat_clearsky_agenda_no_gas(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    propmat_clearsky_agenda(ws, Ignore(ws, rtp_mag(ws)), Ignore(ws, rtp_los(ws)),
+                            Ignore(ws, rtp_pressure(ws)),
+                            Ignore(ws, rtp_temperature(ws)),
+                            Ignore(ws, rtp_nlte(ws)), Ignore(ws, rtp_vmr(ws)),
+                            propmat_clearskyInit(ws));
+    return ws;
+  }
+
+  Workspace& surface_rtprop_agenda_blackbody_from_surface(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    surface_rtprop_agenda(
+      ws, InterpSurfaceFieldToPosition(ws, surface_skin_t(ws), t_surface(ws)),
+                          surfaceBlackbody(ws));
+    return ws;
+  }
+}  // namespace ARTS::Agenda
+
+//! Compares two vectors bit for bit.
+bool same(const Vector& a, const Vector& b) {
+  if (a.nelem() != b.nelem()) return false;
+  for (Index i = 0; i < a.nelem(); i++)
+    if (a[i] != b[i]) return false;
+  return true;
+}
+
+//! An isotropically scattering, totally random scattering element.
+SingleScatteringData isotropic_scatterer(const Vector& f_grid,
+                                         const Numeric ext,
+                                         const Numeric abs) {
+  SingleScatteringData ssd;
+  ssd.ptype = PTYPE_TOTAL_RND;
+  ssd.description = "Isotropic test scatterer";
+  ssd.f_grid = f_grid;
+  ssd.T_grid = Vector{150, 350};
+  ssd.za_grid = Vector(0, 19, 10);
+  ssd.aa_grid = Vector();
+  const Index nf = f_grid.nelem(), nT = ssd.T_grid.nelem();
+  ssd.pha_mat_data = Tensor7(nf, nT, ssd.za_grid.nelem(), 1, 1, 1, 6, 0);
+  ssd.pha_mat_data(joker, joker, joker, 0, 0, 0, 0) =
+      (ext - abs) / (4 * ::Constant::pi);
+  ssd.ext_mat_data = Tensor5(nf, nT, 1, 1, 1, ext);
+  ssd.abs_vec_data = Tensor5(nf, nT, 1, 1, 1, abs);
+  return ssd;
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  ARTS::Agenda::iy_space_agenda_cosmic_background(ws);
+  ARTS::Agenda::ppath_step_agenda_geometric_path(ws);
+  ARTS::Agenda::propmat_clearsky_agenda_no_gas(ws);
+  ARTS::Agenda::surface_rtprop_agenda_blackbody_from_surface(ws);
+
+  Method::jacobianOff(ws);
+  Method::nlteOff(ws);
+  Method::abs_speciesSet(ws, ArrayOfString{"N2", "O2"});
+  Var::stokes_dim(ws) = 4;
+  Var::f_grid(ws) = Vector(1, 100e9);
+  Var::f_index(ws) = 0;
+
+  // A 3D atmosphere without gas absorption, with the cloudbox well inside
+  // the latitude and longitude grids
+  const Index np = 11, nlat = 9, nlon = 9;
+  Method::VectorNLogSpace(ws, Var::p_grid(ws).value(), np, 1000e2, 10e2);
+  Method::AtmosphereSet3D(ws);
+  Var::lat_grid(ws) = Vector(-40, nlat, 10);
+  Var::lon_grid(ws) = Vector(-40, nlon, 10);
+  Var::z_field(ws) = Tensor3(np, nlat, nlon, 0);
+  for (Index i = 0; i < np; i++)
+    Var::z_field(ws).value()(i, joker, joker) =
+        7e3 * std::log(1000e2 / Var::p_grid(ws).value()[i]);
+  Var::t_field(ws) = Tensor3(np, nlat, nlon, 250.0);
+  Var::vmr_field(ws) = Tensor4(2, np, nlat, nlon, 0.0);
+  Method::Touch(ws, Var::wind_u_field(ws));
+  Method::Touch(ws, Var::wind_v_field(ws));
+  Method::Touch(ws, Var::wind_w_field(ws));
+  Method::Touch(ws, Var::mag_u_field(ws));
+  Method::Touch(ws, Var::mag_v_field(ws));
+  Method::Touch(ws, Var::mag_w_field(ws));
+  Method::Touch(ws, Var::nlte_field(ws));
+
+  Method::refellipsoidEarth(ws, String{"Sphere"});
+  Method::z_surfaceConstantAltitude(ws);
+  Var::t_surface(ws) = Matrix(nlat, nlon, 270.0);
+
+  Var::cloudbox_on(ws) = 1;
+  Var::cloudbox_limits(ws) = ArrayOfIndex{0, 6, 2, 6, 2, 6};
+  Var::pnd_field(ws) = Tensor4(1, 7, 5, 5, 0.0);
+  Var::pnd_field(ws).value()(0, Range(0, 6), Range(1, 3), Range(1, 3)) = 1.0;
+  Var::dpnd_field_dx(ws) = ArrayOfTensor4();
+  Method::Touch(ws, Var::scat_species(ws));
+  Method::Touch(ws, Var::particle_masses(ws));
+  Var::scat_data(ws) = ArrayOfArrayOfSingleScatteringData(
+      1, ArrayOfSingleScatteringData(
+             1, isotropic_scatterer(Var::f_grid(ws).value(), 1e-4, 5e-5)));
+
+  Method::atmfields_checkedCalc(ws);
+  Method::atmgeom_checkedCalc(ws);
+  Method::cloudbox_checkedCalc(ws);
+  Method::scat_data_checkedCalc(ws);
+  // The gas is transparent, which propmat_clearsky_agenda_checkedCalc would
+  // not accept without an absorption method in the agenda
+  Var::propmat_clearsky_agenda_checked(ws) = 1;
+
+  Var::sensor_pos(ws) = Matrix(1, 3, 0);
+  Var::sensor_pos(ws).value()(0, 0) = 30e3;
+  Var::sensor_los(ws) = Matrix(1, 2, 0);
+  Var::sensor_los(ws).value()(0, 0) = 170;
+  Var::sensor_los(ws).value()(0, 1) = 30;
+  Method::mc_antennaSetPencilBeam(ws);
+
+  Var::iy_unit(ws) = "RJBT";
+  Var::ppath_lmax(ws) = 3e3;
+  Var::ppath_lraytrace(ws) = 1e3;
+  Var::mc_seed(ws) = 42;
+  Var::mc_std_err(ws) = -1;
+  Var::mc_max_time(ws) = -1;
+  Var::mc_max_iter(ws) = 400;
+  Var::mc_min_iter(ws) = 100;
+  Var::mc_taustep_limit(ws) = 0.1;
+
+  // The serial algorithm, as reference
+  Method::MCGeneral(ws, 11, 1, 1);
+  const Vector y_serial = Var::y(ws).value();
+  check("Serial run traces mc_max_iter photons",
+        Var::mc_iteration_count(ws).value() == 400);
+
+  // Four photon streams on four threads
+  Method::SetNumberOfThreads(ws, 4);
+  Method::MCGeneral(ws, 11, 1, 4);
+  const Vector y_streams = Var::y(ws).value();
+  check("Streamed run traces mc_max_iter photons",
+        Var::mc_iteration_count(ws).value() == 400);
+  check("Streams give a radiance close to the serial one",
+        std::abs(y_streams[0] - y_serial[0]) <
+            5 * (Var::mc_error(ws).value()[0] + 1e-3));
+  Method::MCGeneral(ws, 11, 1, 4);
+  check("Streamed run is reproducible", same(Var::y(ws).value(), y_streams));
+
+  // Called from inside a parallel region, the streams are traced one by one
+  // on the calling thread, and still give the same y
+  std::vector<Workspace> l_ws(2, ws);
+  for (auto& w : l_ws) {
+    // Copies share the variables, so each call needs its own outputs
+    w.duplicate(Var::y(w).pos());
+    w.duplicate(Var::mc_iteration_count(w).pos());
+    w.duplicate(Var::mc_error(w).pos());
+    w.duplicate(Var::mc_points(w).pos());
+    w.duplicate(Var::mc_source_domain(w).pos());
+    w.duplicate(Var::mc_scat_order(w).pos());
+  }
+  ArrayOfVector l_y(2);
+#pragma omp parallel for num_threads(2)
+  for (Index i = 0; i < 2; i++) {
+    Method::MCGeneral(l_ws[i], 11, 1, 4);
+    l_y[i] = Var::y(l_ws[i]).value();
+  }
+  for (Index i = 0; i < 2; i++)
+    check("Streams inside a parallel region give the same y",
+          same(l_y[i], y_streams));
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,93 @@
+#include <autoarts.h>
+
+namespace ARTS::Agenda {
+  Workspace& ppath_agenda_follow_sensor_los(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    ppath_agenda(ws, Ignore(ws, rte_pos2(ws)), ppathStepByStep(ws));
+    return ws;
+  }
+
+  Workspace& ppath_step_agenda_refracted_path_adaptive(Workspace& ws,
+                                                       const Numeric za_tolerance) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    ppath_step_agenda(
+      ws,
+      ppath_stepRefractionAdaptive(
+        ws, Var::NumericCreate(ws, za_tolerance, "test_za_tolerance")));
+    return ws;
+  }
+
+  Workspace& refr_index_air_agenda_microwaves_earth(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    const auto one = NumericCreate(ws, 1.0, "test_one");
+    refr_index_air_agenda(ws, Ignore(ws, f_grid(ws)),
+                          NumericSet(ws, refr_index_air(ws), one),
+                          NumericSet(ws, refr_index_air_group(ws), one),
+                          refr_index_airMicrowavesEarth(ws));
+    return ws;
+  }
+}  // namespace ARTS::Agenda
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  ARTS::Agenda::ppath_agenda_follow_sensor_los(ws);
+  ARTS::Agenda::ppath_step_agenda_refracted_path_adaptive(ws, 1e-4);
+  ARTS::Agenda::refr_index_air_agenda_microwaves_earth(ws);
+
+  Method::abs_speciesSet(ws, ArrayOfString{"H2O"});
+  Method::VectorNLogSpace(ws, Var::p_grid(ws).value(), 41, 1000e2, 1);
+  Method::AtmosphereSet1D(ws);
+
+  Var::t_field(ws) = Tensor3(41, 1, 1, 250.0);
+  Var::vmr_field(ws) = Tensor4(1, 41, 1, 1, 1e-3);
+  Var::z_field(ws) = Tensor3(41, 1, 1, 0);
+  for (Index i=0; i<41; i++) Var::z_field(ws).value()(i, 0, 0) = 2e3 * Numeric(i);
+  Method::Touch(ws, Var::wind_u_field(ws));
+  Method::Touch(ws, Var::wind_v_field(ws));
+  Method::Touch(ws, Var::wind_w_field(ws));
+  Method::Touch(ws, Var::mag_u_field(ws));
+  Method::Touch(ws, Var::mag_v_field(ws));
+  Method::Touch(ws, Var::mag_w_field(ws));
+  Method::Touch(ws, Var::nlte_field(ws));
+
+  Method::refellipsoidEarth(ws, String{"Sphere"});
+  Method::z_surfaceConstantAltitude(ws);
+  Var::f_grid(ws) = Vector(1, 10e9);
+  Method::cloudboxOff(ws);
+  Method::atmgeom_checkedCalc(ws);
+  Method::atmfields_checkedCalc(ws);
+  Method::cloudbox_checkedCalc(ws);
+
+  // Adaptive steps grow far beyond ppath_lmax above the tangent point, but
+  // the points of the path must still be at most ppath_lmax apart
+  Var::ppath_lraytrace(ws) = 100;
+  Var::ppath_lmax(ws) = 2e3;
+  Var::rte_pos(ws) = Vector(1, 600e3);
+  Var::rte_los(ws) = Vector(1, 113);
+  Method::Touch(ws, Var::rte_pos2(ws));
+  Method::ppathCalc(ws);
+
+  const Ppath& ppath = Var::ppath(ws).value();
+  Numeric lstep_max = 0;
+  for (auto& l: ppath.lstep) lstep_max = std::max(lstep_max, l);
+  std::cout << "Number of points: " << ppath.np << '\n'
+            << "Longest step: " << lstep_max << " m\n";
+  if (ppath.np < 3 or lstep_max > 2e3 * (1 + 1e-12)) {
+    std::cerr << "Point spacing exceeds ppath_lmax\n";
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,137 @@
+#include <autoarts.h>
+#include "ppath.h"
+#include "test_utils.h"
+
+namespace ARTS::Agenda {
+  Workspace& ppath_step_agenda_geometric_path(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    ppath_step_agenda(ws, Ignore(ws, ppath_lraytrace(ws)), Ignore(ws, f_grid(ws)),
+                      ppath_stepGeometric(ws));
+    return ws;
+  }
+
+  Workspace& ppath_step_agenda_refracted_path(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    ppath_step_agenda(ws, ppath_stepRefractionBasic(ws));
+    return ws;
+  }
+
+  Workspace& refr_index_air_agenda_microwaves_earth(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    const auto one = NumericCreate(ws, 1.0, "test_one");
+    refr_index_air_agenda(ws, Ignore(ws, f_grid(ws)),
+                          NumericSet(ws, refr_index_air(ws), one),
+                          NumericSet(ws, refr_index_air_group(ws), one),
+                          refr_index_airMicrowavesEarth(ws));
+    return ws;
+  }
+}  // namespace ARTS::Agenda
+
+//! Compares the points of two paths bit for bit.
+bool same_path(const Ppath& a, const Ppath& b) {
+  if (a.np != b.np or a.background != b.background) return false;
+  for (Index i = 0; i < a.np; i++) {
+    for (Index j = 0; j < a.pos.ncols(); j++)
+      if (a.pos(i, j) != b.pos(i, j)) return false;
+    for (Index j = 0; j < a.los.ncols(); j++)
+      if (a.los(i, j) != b.los(i, j)) return false;
+  }
+  for (Index i = 0; i < a.lstep.nelem(); i++)
+    if (a.lstep[i] != b.lstep[i]) return false;
+  return true;
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  ARTS::Agenda::ppath_step_agenda_geometric_path(ws);
+
+  Method::VectorNLogSpace(ws, Var::p_grid(ws).value(), 41, 1000e2, 1);
+  Method::AtmosphereSet1D(ws);
+  Var::z_field(ws) = Tensor3(41, 1, 1, 0);
+  for (Index i=0; i<41; i++) Var::z_field(ws).value()(i, 0, 0) = 2e3 * Numeric(i);
+  const Tensor3 z_field = Var::z_field(ws).value();
+
+  Method::refellipsoidEarth(ws, String{"Sphere"});
+  Method::z_surfaceConstantAltitude(ws);
+  Var::f_grid(ws) = Vector(1, 10e9);
+  Method::cloudboxOff(ws);
+  Var::ppath_inside_cloudbox_do(ws) = 0;
+  Var::ppath_lraytrace(ws) = 1e3;
+  Var::ppath_lmax(ws) = 10e3;
+  Var::rte_pos(ws) = Vector(1, 600e3);
+  Var::rte_los(ws) = Vector(1, 113);
+
+  Method::ppathCacheClear(ws);
+  check("Empty cache", ppath_cache_size() == 0);
+
+  // A miss calculates the path as ppathStepByStep
+  Method::ppathStepByStep(ws);
+  const Ppath uncached = Var::ppath(ws).value();
+  check("ppathStepByStep does not use the cache", ppath_cache_size() == 0);
+  Method::ppathStepByStepCached(ws);
+  const Ppath first = Var::ppath(ws).value();
+  check("Miss adds the path", ppath_cache_size() == 1);
+  check("Missed path equals the uncached path", same_path(first, uncached));
+
+  // A hit returns the same path
+  Var::ppath(ws) = Ppath();
+  Method::ppathStepByStepCached(ws);
+  check("Hit does not add a path", ppath_cache_size() == 1);
+  check("Hit returns the cached path", same_path(Var::ppath(ws).value(), first));
+
+  // Changed geometry must not return the cached path
+  Var::rte_los(ws) = Vector(1, 120);
+  Method::ppathStepByStepCached(ws);
+  check("Changed rte_los misses", ppath_cache_size() == 2);
+  check("Changed rte_los gives another path",
+        not same_path(Var::ppath(ws).value(), first));
+  Var::rte_los(ws) = Vector(1, 113);
+
+  Var::z_field(ws).value() *= 1.01;
+  Method::ppathStepByStep(ws);
+  const Ppath stretched = Var::ppath(ws).value();
+  Method::ppathStepByStepCached(ws);
+  check("Changed z_field misses", ppath_cache_size() == 3);
+  check("Changed z_field gives the uncached path",
+        same_path(Var::ppath(ws).value(), stretched) and
+            not same_path(stretched, first));
+  Var::z_field(ws) = z_field;
+
+  Var::ppath_lmax(ws) = 5e3;
+  Method::ppathStepByStepCached(ws);
+  check("Changed ppath_lmax misses", ppath_cache_size() == 4);
+  Var::ppath_lmax(ws) = 10e3;
+
+  // Back to the first geometry
+  Method::ppathStepByStepCached(ws);
+  check("First geometry hits", ppath_cache_size() == 4);
+  check("First geometry returns the first path",
+        same_path(Var::ppath(ws).value(), first));
+
+  Method::ppathCacheClear(ws);
+  check("ppathCacheClear empties the cache", ppath_cache_size() == 0);
+
+  // Refracted paths depend on the atmosphere and are not cached
+  ARTS::Agenda::ppath_step_agenda_refracted_path(ws);
+  ARTS::Agenda::refr_index_air_agenda_microwaves_earth(ws);
+  Method::abs_speciesSet(ws, ArrayOfString{"H2O"});
+  Var::t_field(ws) = Tensor3(41, 1, 1, 250.0);
+  Var::vmr_field(ws) = Tensor4(1, 41, 1, 1, 1e-3);
+  Method::ppathStepByStepCached(ws);
+  check("Refracted path is not cached", ppath_cache_size() == 0);
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
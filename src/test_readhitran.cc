@@ -0,0 +1,61 @@
+#include <autoarts.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include "constants.h"
+#include "test_utils.h"
+
+//! A HITRAN 2004 record of a H2O-like line at a wavenumber in cm-1.
+String hitran_record(Index mo, Numeric wavenumber) {
+  char start[16];
+  std::snprintf(start, sizeof(start), "%2d1%12.6f", int(mo), wavenumber);
+  return String(start) +
+         " 1.000E-22 1.000E-09.09920.440  446.51090.63-.006570"
+         "          0 0 0          0 0 0  6  5  2        5  2  3      "
+         "444444 4 4 4 4 4 4    39.0   33.0";
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  // A comment line and a molecule unknown to ARTS inside the frequency
+  // range must not end the reading
+  const String hitran_file = "test_readhitran.par";
+  {
+    std::ofstream os(hitran_file);
+    os << hitran_record(1, 0.5) << '\n'
+       << hitran_record(1, 1.0) << '\n'
+       << "   A comment line inside the frequency range\n"
+       << hitran_record(1, 2.5) << '\n'
+       << hitran_record(99, 2.7) << '\n'
+       << hitran_record(1, 3.0) << '\n'
+       << hitran_record(1, 5.0) << '\n';
+  }
+
+  const Numeric w2Hz = ::Constant::c * 100;
+  Method::ReadHITRAN(ws, hitran_file, 20e9, 100e9);
+  std::remove(hitran_file.c_str());
+
+  std::vector<Numeric> f0;
+  for (auto& band : Var::abs_lines(ws).value())
+    for (Index i = 0; i < band.NumLines(); i++) f0.push_back(band.F0(i));
+  std::sort(f0.begin(), f0.end());
+
+  std::cout << "Number of lines: " << f0.size() << '\n';
+  check("All lines in the range are read", f0.size() == 3);
+  check("Line before the comment",
+        std::abs(f0[0] - 1.0 * w2Hz) < 1);
+  check("Line after the comment",
+        std::abs(f0[1] - 2.5 * w2Hz) < 1);
+  check("Line after the unknown molecule",
+        std::abs(f0[2] - 3.0 * w2Hz) < 1);
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,193 @@
+#include <autoarts.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include "sensor_cache.h"
+#include "test_utils.h"
+
+namespace ARTS::Agenda {
+  Workspace& sensor_response_agenda_read_f_grid(Workspace& ws,
+                                                const String& filename) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    sensor_response_agenda(
+        ws,
+        Ignore(ws, f_backend(ws)),
+        ReadXML(ws, sensor_response_f_grid(ws),
+                StringCreate(ws, filename, "test_filename")),
+        Touch(ws, sensor_response(ws)),
+        Touch(ws, sensor_response_f(ws)),
+        Touch(ws, sensor_response_pol(ws)),
+        Touch(ws, sensor_response_pol_grid(ws)),
+        Touch(ws, sensor_response_dlos(ws)),
+        Touch(ws, sensor_response_dlos_grid(ws)),
+        Touch(ws, mblock_dlos_grid(ws)));
+    return ws;
+  }
+
+  Workspace& sensor_response_agenda_set_dlos(Workspace& ws,
+                                             const Matrix& dlos,
+                                             const Var::Numeric& f0,
+                                             const String& suffix) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    sensor_response_agenda(
+        ws,
+        Ignore(ws, f_backend(ws)),
+        VectorSetConstant(ws, sensor_response_f_grid(ws), f0),
+        Copy(ws, sensor_response_f(ws), sensor_response_f_grid(ws)),
+        Touch(ws, sensor_response(ws)),
+        Touch(ws, sensor_response_pol(ws)),
+        Touch(ws, sensor_response_pol_grid(ws)),
+        Touch(ws, sensor_response_dlos(ws)),
+        Touch(ws, sensor_response_dlos_grid(ws)),
+        MatrixSet(ws, mblock_dlos_grid(ws),
+                  MatrixCreate(ws, dlos, "test_dlos" + suffix)));
+    return ws;
+  }
+}  // namespace ARTS::Agenda
+
+//! Writes a file with the given content.
+void write_file(const String& filename, const String& content) {
+  std::ofstream os(filename, std::ios::binary);
+  os << content;
+}
+
+//! Writes a Vector as ASCII XML.
+void write_vector_xml(const String& filename, const String& values) {
+  write_file(filename,
+             "<?xml version=\"1.0\"?>\n"
+             "<arts format=\"ascii\" version=\"1\">\n"
+             "<Vector nelem=\"2\">\n" + values + "\n</Vector>\n"
+             "</arts>\n");
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+  const Verbosity& verbosity = Var::verbosity(ws).value();
+
+  const String cache_file = "test_sensor_cache.bin";
+  const String xml_file = "test_sensor_cache.f_grid.xml";
+
+  // Output of a sensor response agenda
+  Sparse H(3, 4);
+  H.rw(0, 0) = 0.5;
+  H.rw(0, 1) = 0.5;
+  H.rw(2, 3) = 1;
+  const Vector f{1e9, 2e9, 3e9};
+  const Vector f_grid{1e9, 2e9, 3e9, 4e9};
+  const ArrayOfIndex pol{1, 1, 1};
+  const ArrayOfIndex pol_grid{1};
+  const Matrix dlos(3, 1, 0);
+  const Matrix dlos_grid(1, 1, 0);
+  const Matrix mblock_dlos(1, 1, 0);
+
+  Sparse H2;
+  Vector f2, f_grid2;
+  ArrayOfIndex pol2, pol_grid2;
+  Matrix dlos2, dlos_grid2, mblock_dlos2;
+  auto read = [&](const String& filename) {
+    return sensor_response_cache_read(H2, f2, f_grid2, pol2, pol_grid2, dlos2,
+                                      dlos_grid2, mblock_dlos2, filename);
+  };
+
+  // Miss
+  std::remove(cache_file.c_str());
+  check("Missing file", not read(cache_file));
+
+  // Hit
+  sensor_response_cache_write(H, f, f_grid, pol, pol_grid, dlos, dlos_grid,
+                              mblock_dlos, cache_file);
+  bool same = read(cache_file) and H2.nrows() == 3 and H2.ncols() == 4 and
+              H2.nnz() == 3 and H2(0, 0) == 0.5 and H2(0, 1) == 0.5 and
+              H2(2, 3) == 1 and f2.nelem() == 3 and f2[2] == 3e9 and
+              f_grid2.nelem() == 4 and f_grid2[3] == 4e9 and
+              pol2 == pol and pol_grid2 == pol_grid and
+              dlos2.nrows() == 3 and dlos_grid2.nrows() == 1 and
+              mblock_dlos2.nrows() == 1;
+  check("Cached file", same);
+
+  // Corrupt files
+  String content;
+  {
+    std::ifstream is(cache_file, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(is),
+                   std::istreambuf_iterator<char>());
+  }
+  write_file(cache_file, content.substr(0, content.size() - 1));
+  check("Truncated file", not read(cache_file));
+  write_file(cache_file, content + '\0');
+  check("File with trailing data", not read(cache_file));
+  write_file(cache_file, "X" + content.substr(1));
+  check("Wrong magic", not read(cache_file));
+  String swapped = content;
+  std::reverse(swapped.begin() + 8, swapped.begin() + 8 + sizeof(Index));
+  write_file(cache_file, swapped);
+  check("Other byte order", not read(cache_file));
+  String bad_size = content;
+  const Index huge = Index(1) << 60;
+  bad_size.replace(8 + 4 * sizeof(Index), sizeof(Index),
+                   reinterpret_cast<const char*>(&huge), sizeof(Index));
+  write_file(cache_file, bad_size);
+  check("Wrong element count", not read(cache_file));
+  write_file(cache_file, "");
+  check("Empty file", not read(cache_file));
+  std::remove(cache_file.c_str());
+
+  // Key of the cache: files read by the agenda
+  write_vector_xml(xml_file, "1e9 2e9");
+  Agenda::sensor_response_agenda_read_f_grid(ws, xml_file);
+  const ::Agenda& agenda = Var::sensor_response_agenda(ws).value();
+  const String key1 = agenda_input_hash(ws, agenda, verbosity);
+  const String key2 = agenda_input_hash(ws, agenda, verbosity);
+  write_vector_xml(xml_file, "1e9 20e9");
+  const String key3 = agenda_input_hash(ws, agenda, verbosity);
+  std::remove(xml_file.c_str());
+  check("Same key for unchanged input", key1 == key2);
+  check("New key for changed file", key1 != key3);
+
+  // Key of the cache: values of set methods and of Numeric input
+  auto f0 = Var::NumericCreate(ws, 1e9, "test_f0");
+  Var::nelem(ws) = 2;
+  Agenda::sensor_response_agenda_set_dlos(ws, Matrix(1, 1, 0), f0, "_a");
+  const ::Agenda set_agenda = Var::sensor_response_agenda(ws).value();
+  const String key_set1 = agenda_input_hash(ws, set_agenda, verbosity);
+  Agenda::sensor_response_agenda_set_dlos(ws, Matrix(1, 1, 0.1), f0, "_b");
+  const String key_set2 =
+      agenda_input_hash(ws, Var::sensor_response_agenda(ws).value(), verbosity);
+  check("New key for changed MatrixSet value", key_set1 != key_set2);
+  f0.value() = std::nextafter(1e9, 2e9);
+  const String key_set3 = agenda_input_hash(ws, set_agenda, verbosity);
+  check("New key for a Numeric changed in the last digit",
+        key_set1 != key_set3);
+  f0.value() = 1e9;
+
+  // The cached method itself, with the agenda setting mblock_dlos_grid
+  Var::sensor_response_agenda(ws) = set_agenda;
+  Var::f_backend(ws) = Vector(2, 1e9);
+  Method::sensor_responseFromAgendaCached(ws, String{"."});
+  const String cached_file =
+      "./sensor_response_" + agenda_input_hash(ws, set_agenda, verbosity) +
+      ".bin";
+  check("Cache file written", read(cached_file));
+  check("Cached mblock_dlos_grid", mblock_dlos2.nrows() == 1 and
+                                       mblock_dlos2.ncols() == 1 and
+                                       mblock_dlos2(0, 0) == 0);
+  Method::sensor_responseFromAgendaCached(ws, String{"."});
+  check("Response read from the cache",
+        Var::mblock_dlos_grid(ws).value().nrows() == 1 and
+            Var::sensor_response_f_grid(ws).value().nelem() == 2);
+  std::remove(cached_file.c_str());
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
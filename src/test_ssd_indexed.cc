@@ -0,0 +1,149 @@
+/* Copyright (C) 2026 ARTS Developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   test_ssd_indexed.cc
+  \date   2026-10-15
+
+  \brief  Test of the indexed single scattering data format.
+
+  Writes single scattering data as XML, converts the XML file to the indexed
+  format, and checks that the full data and a subset read from the indexed
+  file are the same as the data read from the XML file. Finally checks that
+  the indexed file is detected as outdated after the XML file has changed.
+*/
+
+#include <cstdio>
+#include <iostream>
+#include "optproperties.h"
+#include "test_utils.h"
+#include "xml_io.h"
+
+//! Check that two single scattering data are identical.
+bool equal(const SingleScatteringData& a, const SingleScatteringData& b) {
+  if (a.ptype != b.ptype || a.description != b.description) return false;
+
+  const ConstVectorView grids_a[4] = {a.f_grid, a.T_grid, a.za_grid, a.aa_grid};
+  const ConstVectorView grids_b[4] = {b.f_grid, b.T_grid, b.za_grid, b.aa_grid};
+  for (Index g = 0; g < 4; g++) {
+    if (grids_a[g].nelem() != grids_b[g].nelem()) return false;
+    for (Index i = 0; i < grids_a[g].nelem(); i++)
+      if (grids_a[g][i] != grids_b[g][i]) return false;
+  }
+
+  if (a.pha_mat_data.nlibraries() != b.pha_mat_data.nlibraries() ||
+      a.pha_mat_data.nvitrines() != b.pha_mat_data.nvitrines() ||
+      a.pha_mat_data.nshelves() != b.pha_mat_data.nshelves() ||
+      a.ext_mat_data.nshelves() != b.ext_mat_data.nshelves() ||
+      a.ext_mat_data.nbooks() != b.ext_mat_data.nbooks() ||
+      a.abs_vec_data.nshelves() != b.abs_vec_data.nshelves() ||
+      a.abs_vec_data.nbooks() != b.abs_vec_data.nbooks())
+    return false;
+
+  for (Index f = 0; f < a.pha_mat_data.nlibraries(); f++)
+    for (Index t = 0; t < a.pha_mat_data.nvitrines(); t++) {
+      for (Index z = 0; z < a.pha_mat_data.nshelves(); z++)
+        for (Index i = 0; i < a.pha_mat_data.ncols(); i++)
+          if (a.pha_mat_data(f, t, z, 0, 0, 0, i) !=
+              b.pha_mat_data(f, t, z, 0, 0, 0, i))
+            return false;
+      if (a.ext_mat_data(f, t, 0, 0, 0) != b.ext_mat_data(f, t, 0, 0, 0) ||
+          a.abs_vec_data(f, t, 0, 0, 0) != b.abs_vec_data(f, t, 0, 0, 0))
+        return false;
+    }
+  return true;
+}
+
+int main() try {
+  const Verbosity verbosity;
+  const String xml_file = "test_ssd_indexed.xml";
+  const String indexed_file = "test_ssd_indexed.ssdi";
+
+  // The indexed file is written from the XML file, as by
+  // ScatElementsWriteIndexed
+  xml_write_to_file(xml_file, make_ssd(0), FILE_TYPE_ASCII, 0, verbosity);
+  SingleScatteringData ssd_xml;
+  xml_read_from_file(xml_file, ssd_xml, verbosity);
+  ssd_write_indexed(ssd_xml, indexed_file, xml_file);
+
+  bool ok = true;
+
+  // Full data
+  SingleScatteringData ssd_indexed;
+  ssd_read_indexed(ssd_indexed, indexed_file, Vector(0), 1, Vector(0), 1);
+  std::cout << "Full data:           "
+            << (equal(ssd_xml, ssd_indexed) ? "ok" : "FAILED") << '\n';
+  ok = ok && equal(ssd_xml, ssd_indexed);
+
+  // Subset in frequency and temperature
+  const Vector f_grid{50e9, 150e9};
+  const Vector T_range{235, 255};
+  Index f_start, nf, T_start, nT;
+  ssd_subset_ranges(f_start,
+                    nf,
+                    T_start,
+                    nT,
+                    ssd_xml.f_grid,
+                    ssd_xml.T_grid,
+                    f_grid,
+                    1,
+                    T_range,
+                    1);
+  SingleScatteringData ssd_xml_subset = ssd_xml;
+  ssd_subset(ssd_xml_subset, f_start, nf, T_start, nT);
+  ssd_read_indexed(ssd_indexed, indexed_file, f_grid, 1, T_range, 1);
+  const bool subset_ok = nf == 3 && nT == 2 &&
+                         equal(ssd_xml_subset, ssd_indexed);
+  std::cout << "Subset:              " << (subset_ok ? "ok" : "FAILED")
+            << '\n';
+  ok = ok && subset_ok;
+
+  // Quadratic interpolation in temperature needs a third grid point
+  ssd_subset_ranges(f_start,
+                    nf,
+                    T_start,
+                    nT,
+                    ssd_xml.f_grid,
+                    ssd_xml.T_grid,
+                    f_grid,
+                    1,
+                    T_range,
+                    2);
+  ssd_xml_subset = ssd_xml;
+  ssd_subset(ssd_xml_subset, f_start, nf, T_start, nT);
+  ssd_read_indexed(ssd_indexed, indexed_file, f_grid, 1, T_range, 2);
+  const bool order_ok = nT == 3 && equal(ssd_xml_subset, ssd_indexed);
+  std::cout << "Subset, T order 2:   " << (order_ok ? "ok" : "FAILED")
+            << '\n';
+  ok = ok && order_ok;
+
+  // Change of the XML file
+  const bool current = ssd_indexed_is_current(indexed_file, xml_file);
+  xml_write_to_file(xml_file, make_ssd(1000), FILE_TYPE_ASCII, 0, verbosity);
+  const bool outdated = !ssd_indexed_is_current(indexed_file, xml_file);
+  std::cout << "Outdated index:      "
+            << (current && outdated ? "ok" : "FAILED") << '\n';
+  ok = ok && current && outdated;
+
+  std::remove(xml_file.c_str());
+  std::remove(indexed_file.c_str());
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+} catch (const std::exception& e) {
+  std::cerr << "Error: " << e.what() << '\n';
+  return EXIT_FAILURE;
+}
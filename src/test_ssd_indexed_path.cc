@@ -0,0 +1,59 @@
+#include <autoarts.h>
+#include <filesystem>
+#include "file.h"
+#include "parameters.h"
+#include "test_utils.h"
+
+extern Parameters parameters;
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+  const Verbosity& verbosity = Var::verbosity(ws).value();
+
+  // The scattering data are only found through the include path
+  const String dir = "test_ssd_indexed_path.d";
+  const String name = "test_ssd_indexed_path";
+  std::filesystem::create_directory(dir);
+  xml_write_to_file(dir + "/" + name + ".xml", make_ssd(0), FILE_TYPE_ASCII, 0,
+                    verbosity);
+  ScatteringMetaData smd;
+  smd.description = "Test meta data";
+  smd.source = "Test";
+  smd.refr_index = "None";
+  smd.mass = 1e-9;
+  smd.diameter_max = 1e-4;
+  smd.diameter_volume_equ = 1e-4;
+  smd.diameter_area_equ_aerodynamical = 1e-4;
+  xml_write_to_file(dir + "/" + name + ".meta.xml", smd, FILE_TYPE_ASCII, 0,
+                    verbosity);
+  parameters.includepath.push_back(dir);
+
+  Method::ScatElementsWriteIndexed(ws, ArrayOfString(1, name + ".xml"));
+  check("Indexed file is written next to the XML file",
+        file_exists(dir + "/" + name + ".ssdi") and
+            not file_exists(name + ".ssdi"));
+
+  // Indexed data that differ from the XML file show which file was read
+  ssd_write_indexed(make_ssd(1000), dir + "/" + name + ".ssdi",
+                    dir + "/" + name + ".xml");
+  Var::f_grid(ws) = Vector{50e9, 150e9};
+  Method::ScatSpeciesInit(ws);
+  Method::ScatSpeciesScatAndMetaReadSubset(
+      ws, ArrayOfString(1, name + ".xml"), 1, Vector{235, 255}, 1);
+  const auto& ssd = Var::scat_data_raw(ws).value()[0][0];
+  check("Subset is read", ssd.f_grid.nelem() == 3 and ssd.T_grid.nelem() == 2);
+  check("Indexed file next to the XML file is read",
+        ssd.ext_mat_data(0, 0, 0, 0, 0) > 1000);
+
+  parameters.includepath.pop_back();
+  std::filesystem::remove_all(dir);
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
@@ -30,6 +30,7 @@
 #include <string>
 
 #include "arts.h"
+#include "auto_md.h"
 #include "telsem.h"
 
 /** Test reading of TELSEM emissivity interpolation
@@ -200,6 +201,101 @@ Numeric test_telsem_read(String atlas_file,
   return error;
 }
 
+/** Test batched interpolation of TELSEM emissivities
+ *
+ * This function compares the emissivities of TelsemAtlas::emis_interp_batch
+ * and telsemStandaloneBatch with those of TelsemAtlas::emis_interp and
+ * telsemStandalone on a lat/lon map that includes cells without data in the
+ * atlas. The empty cells use nearest neighbor interpolation, and without it
+ * the batched method must fail.
+ *
+ * @param atlas_file The path to the atlas file
+ * @param resolution The resolution of the lat/lon map.
+ * @param frequencies The frequencies [GHz] (!!!) for which to interpolate the emissivities
+ *
+ * @return The number of emissivities that differ by more than 1e-12.
+ */
+Index test_telsem_batch(std::string atlas_file,
+                        Numeric resolution,
+                        Vector frequencies) {
+  TelsemAtlas atlas(atlas_file);
+  const Verbosity verbosity;
+  const Numeric d_max = 1e9;
+
+  Index n_lat = static_cast<Index>(180.0 / resolution);
+  Index n_lon = static_cast<Index>(360.0 / resolution);
+  Index np = n_lat * n_lon;
+
+  Vector lat(np), lon(np), theta(np);
+  Index n_empty = 0;
+  for (Index i = 0; i < n_lat; ++i) {
+    for (Index j = 0; j < n_lon; ++j) {
+      Index ip = i * n_lon + j;
+      lat[ip] = 0.125 + resolution / 2.0 - 90.0 +
+                static_cast<Numeric>(i) * resolution;
+      lon[ip] = 0.125 + resolution / 2.0 + static_cast<Numeric>(j) * resolution;
+      theta[ip] = static_cast<Numeric>(ip % 60);
+      if (!atlas.contains(atlas.calc_cellnum(lat[ip], lon[ip]))) ++n_empty;
+    }
+  }
+  std::cout << "Positions in empty cells: " << n_empty << " of " << np
+            << std::endl;
+
+  Vector f(frequencies);
+  f *= 1e9;
+  Tensor3 emis_batch, emis_standalone_batch;
+  atlas.emis_interp_batch(emis_batch, lat, lon, theta, frequencies, d_max);
+  telsemStandaloneBatch(
+      emis_standalone_batch, lat, lon, theta, f, atlas, d_max, verbosity);
+
+  Index n_diff = 0;
+  Index n_freqs = frequencies.nelem();
+  for (Index ip = 0; ip < np; ++ip) {
+    Index cellnumber = atlas.find_cell(lat[ip], lon[ip], d_max);
+    Index class1 = atlas.get_class1(cellnumber);
+    Index class2 = atlas.get_class2(cellnumber);
+    Vector emis_v(n_freqs), emis_h(n_freqs);
+    for (Index k = 0; k < n_freqs; ++k) {
+      std::tie(emis_v[k], emis_h[k]) =
+          atlas.emis_interp(theta[ip],
+                            frequencies[k],
+                            class1,
+                            class2,
+                            atlas.get_emis_v(cellnumber),
+                            atlas.get_emis_h(cellnumber));
+    }
+
+    Matrix emis_standalone;
+    telsemStandalone(emis_standalone,
+                     lat[ip],
+                     lon[ip],
+                     theta[ip],
+                     f,
+                     atlas,
+                     d_max,
+                     verbosity);
+
+    for (Index k = 0; k < n_freqs; ++k) {
+      if (std::fabs(emis_batch(ip, k, 0) - emis_v[k]) > 1e-12) ++n_diff;
+      if (std::fabs(emis_batch(ip, k, 1) - emis_h[k]) > 1e-12) ++n_diff;
+      if (emis_standalone_batch(ip, k, 0) != emis_standalone(k, 0)) ++n_diff;
+      if (emis_standalone_batch(ip, k, 1) != emis_standalone(k, 1)) ++n_diff;
+    }
+  }
+
+  // Without nearest neighbor interpolation, empty cells are an error.
+  if (n_empty > 0) {
+    bool failed = false;
+    try {
+      atlas.emis_interp_batch(emis_batch, lat, lon, theta, frequencies, 0.0);
+    } catch (const std::runtime_error&) {
+      failed = true;
+    }
+    if (!failed) ++n_diff;
+  }
+  return n_diff;
+}
+
 int main(int argc, const char** argv) {
   if (argc != 4) {
     std::cout
@@ -235,5 +331,11 @@ int main(int argc, const char** argv) {
       atlas_file, result_path, resolution, theta, frequencies);
   std::cout << "Maximum error interpolating emissivities: " << error
             << std::endl;
-  return 0;
+
+  // Batched interpolation of emissivities.
+
+  Index n_diff = test_telsem_batch(atlas_file, resolution, frequencies);
+  std::cout << "Differences of batched emissivities:      " << n_diff
+            << std::endl;
+  return n_diff == 0 ? 0 : 1;
 }
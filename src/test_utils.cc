@@ -23,6 +23,8 @@
 
 #include "test_utils.h"
 #include <cmath>
+#include <iostream>
+#include <stdexcept>
 #include "arts.h"
 #include "lin_alg.h"
 #include "matpackII.h"
@@ -390,3 +392,71 @@ Numeric get_maximum_error(ConstComplexMatrixView A1,
 
   return max;
 }
+
+//! Fail the test if a condition does not hold.
+/*!
+  Prints the outcome of the check and throws if it failed.
+
+  \param[in] what Description of the checked condition.
+  \param[in] ok Whether the condition holds.
+*/
+void check(const String& what, bool ok) {
+  std::cout << what << ": " << (ok ? "ok" : "FAILED") << '\n';
+  if (not ok) throw std::runtime_error(what + " failed");
+}
+
+//! Band of lines with a Voigt line shape and no cutoff.
+/*!
+  The band is in LTE, without normalization, self or bath broadening,
+  and has a reference temperature of 296 K.
+
+  \param[in] lines The lines of the band.
+  \param[in] broadeningspecies The broadening species of the line shape
+                               models of the lines.
+  \param[in] quantumidentity The identity of the band.
+  \param[in] linemixinglimit Pressure limit of line mixing, negative for
+                             none.
+  \return The band.
+*/
+Absorption::Lines make_band(const std::vector<Absorption::SingleLine>& lines,
+                            const ArrayOfSpeciesTag& broadeningspecies,
+                            const QuantumIdentifier& quantumidentity,
+                            Numeric linemixinglimit) {
+  return Absorption::Lines(
+      false, false, Absorption::CutoffType::None,
+      Absorption::MirroringType::None, Absorption::PopulationType::ByLTE,
+      Absorption::NormalizationType::None, LineShape::Type::VP, 296, -1,
+      linemixinglimit, quantumidentity, {}, broadeningspecies, lines);
+}
+
+//! Single scattering data of totally random orientation with unique values.
+/*!
+  The data have 5 frequencies, 4 temperatures and 5 zenith angles. The
+  data values increase in steps of 0.125, starting above offset.
+
+  \param[in] offset Offset of the data values.
+  \return The single scattering data.
+*/
+SingleScatteringData make_ssd(Numeric offset) {
+  SingleScatteringData ssd;
+  ssd.ptype = PTYPE_TOTAL_RND;
+  ssd.description = "Test data";
+  ssd.f_grid = {1e9, 10e9, 100e9, 200e9, 300e9};
+  ssd.T_grid = {200, 230, 260, 290};
+  ssd.za_grid = {0, 45, 90, 135, 180};
+  ssd.aa_grid = {0};
+  ssd.pha_mat_data.resize(5, 4, 5, 1, 1, 1, 6);
+  ssd.ext_mat_data.resize(5, 4, 1, 1, 1);
+  ssd.abs_vec_data.resize(5, 4, 1, 1, 1);
+
+  Numeric x = offset;
+  for (Index f = 0; f < 5; f++)
+    for (Index t = 0; t < 4; t++) {
+      for (Index z = 0; z < 5; z++)
+        for (Index i = 0; i < 6; i++)
+          ssd.pha_mat_data(f, t, z, 0, 0, 0, i) = x += 0.125;
+      ssd.ext_mat_data(f, t, 0, 0, 0) = x += 0.125;
+      ssd.abs_vec_data(f, t, 0, 0, 0) = x += 0.125;
+    }
+  return ssd;
+}
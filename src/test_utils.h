@@ -27,8 +27,11 @@
 
 #include <stdlib.h>
 #include <time.h>
+#include <vector>
+#include "absorptionlines.h"
 #include "complex.h"
 #include "matpackI.h"
+#include "optproperties.h"
 
 /** Random number class.
 
@@ -122,4 +125,17 @@ Numeric get_maximum_error(ConstVectorView v1,
                           ConstVectorView v2,
                           bool relative);
 
+// Fail the test if a condition does not hold.
+void check(const String& what, bool ok);
+
+// Band of lines with a Voigt line shape and no cutoff.
+Absorption::Lines make_band(
+    const std::vector<Absorption::SingleLine>& lines,
+    const ArrayOfSpeciesTag& broadeningspecies,
+    const QuantumIdentifier& quantumidentity = QuantumIdentifier(),
+    Numeric linemixinglimit = -1);
+
+// Single scattering data of totally random orientation with unique values.
+SingleScatteringData make_ssd(Numeric offset);
+
 #endif  // test_utils_h
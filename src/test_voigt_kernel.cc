@@ -0,0 +1,112 @@
+/* Copyright (C) 2026 ARTS Developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   test_voigt_kernel.cc
+  \date   2026-10-15
+
+  \brief  Test of the Weideman kernel of the Faddeeva function.
+
+  Compares faddeeva_weideman with Faddeeva::w on a grid of arguments that
+  covers the line center, the line wings, the lower half-plane and the
+  switch to the Gauss-Hermite quadrature, against the accuracy bound given
+  in voigt_kernel.h.
+*/
+
+#include <Faddeeva/Faddeeva.hh>
+#include <iostream>
+#include <vector>
+
+#include "arts.h"
+#include "voigt_kernel.h"
+
+//! Largest relative errors of w and of its real and imaginary parts
+struct Errors {
+  Numeric w{0};
+  Numeric re{0};
+  Numeric im{0};
+};
+
+//! Evaluates both kernels for all combinations of x and y.
+Errors compare(const std::vector<Numeric>& x, const std::vector<Numeric>& y) {
+  std::vector<Complex> z;
+  for (auto yi : y)
+    for (auto xi : x) z.emplace_back(xi, yi);
+
+  // The size is not a multiple of the block length of the kernel
+  std::vector<Complex> w(z.size());
+  Linefunctions::faddeeva_weideman(w.data(), z.data(), Index(z.size()));
+
+  Errors e;
+  for (std::size_t i = 0; i < z.size(); i++) {
+    const Complex ref = Faddeeva::w(z[i]);
+    e.w = std::max(e.w, std::abs(w[i] - ref) / std::abs(ref));
+    e.re = std::max(e.re,
+                    std::abs(w[i].real() - ref.real()) / std::abs(ref.real()));
+    if (ref.imag() != 0)
+      e.im = std::max(
+          e.im, std::abs(w[i].imag() - ref.imag()) / std::abs(ref.imag()));
+  }
+  return e;
+}
+
+//! Prints the result of a check and returns if it passed.
+bool check(const String& what, Numeric error, Numeric limit) {
+  const bool ok = error <= limit;
+  std::cout << what << ": " << error << " (limit " << limit << ") "
+            << (ok ? "ok" : "FAILED") << '\n';
+  return ok;
+}
+
+int main() {
+  // Logarithmic x on both sides of the line center, including 0 and the
+  // switch at |x| + y = 8
+  std::vector<Numeric> x{0, 7.9, 8.1, -7.9, -8.1};
+  for (Numeric a = 1e-4; a <= 1e5; a *= 1.7) {
+    x.push_back(a);
+    x.push_back(-a);
+  }
+
+  std::vector<Numeric> y_pressure;
+  for (Numeric b = 1e-4; b <= 1e5; b *= 3.1) y_pressure.push_back(b);
+  const std::vector<Numeric> y_doppler{1e-8, 1e-6, 1e-5};
+  const std::vector<Numeric> y_lower{-1e-3, -0.5, -2};
+
+  bool ok = true;
+
+  const Errors pressure = compare(x, y_pressure);
+  ok = check("Relative error of w, y >= 1e-4", pressure.w, 1e-12) && ok;
+  ok = check("Relative error of Re w, y >= 1e-4", pressure.re, 1e-7) && ok;
+  ok = check("Relative error of Im w, y >= 1e-4", pressure.im, 1e-7) && ok;
+
+  const Errors doppler = compare(x, y_doppler);
+  ok = check("Relative error of w, y < 1e-4", doppler.w, 1e-12) && ok;
+
+  const Errors lower = compare(x, y_lower);
+  ok = check("Relative error of w, y < 0", lower.w, 0) && ok;
+
+  bool thrown = false;
+  try {
+    Linefunctions::toVoigtKernelOrThrow("NoSuchKernel");
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  std::cout << "Unknown kernel name: " << (thrown ? "ok" : "FAILED") << '\n';
+  ok = thrown && ok;
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
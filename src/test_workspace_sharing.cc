@@ -0,0 +1,105 @@
+#include <autoarts.h>
+#include "test_utils.h"
+
+namespace ARTS::Agenda {
+  Workspace& forloop_agenda_double_f_grid(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    forloop_agenda(ws, Ignore(ws, forloop_index(ws)),
+                   VectorScale(ws, f_grid(ws), f_grid(ws),
+                               NumericCreate(ws, 2, "test_factor")));
+    return ws;
+  }
+
+  Workspace& forloop_agenda_copy_f_grid(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    forloop_agenda(ws, Ignore(ws, forloop_index(ws)),
+                   Copy(ws, p_grid(ws), f_grid(ws)));
+    return ws;
+  }
+
+  Workspace& ybatch_calc_agenda_double_f_grid(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    ybatch_calc_agenda(ws, Ignore(ws, ybatch_index(ws)),
+                       VectorScale(ws, f_grid(ws), f_grid(ws),
+                                   NumericCreate(ws, 2, "test_factor")),
+                       Copy(ws, y(ws), f_grid(ws)),
+                       Touch(ws, y_aux(ws)),
+                       Touch(ws, jacobian(ws)));
+    return ws;
+  }
+}  // namespace ARTS::Agenda
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  const Index i_f_grid = Var::f_grid(ws).pos();
+  const Index i_p_grid = Var::p_grid(ws).pos();
+  const Vector f_grid{1, 2, 3};
+  Var::f_grid(ws) = f_grid;
+  Var::p_grid(ws) = Vector{5};
+
+  // The agendas add variables to the workspace and have to be defined
+  // before it is copied
+  ARTS::Agenda::forloop_agenda_copy_f_grid(ws);
+  const ::Agenda copy_f_grid = Var::forloop_agenda(ws).value();
+  ARTS::Agenda::forloop_agenda_double_f_grid(ws);
+  const ::Agenda double_f_grid = Var::forloop_agenda(ws).value();
+  ARTS::Agenda::ybatch_calc_agenda_double_f_grid(ws);
+
+  // A copy of a workspace shares the variables with the original
+  {
+    Workspace ws_copy(ws);
+    check("Copy shares variables",
+          ws_copy.is_shared(i_f_grid) and ws_copy[i_f_grid] == ws[i_f_grid]);
+
+    // An agenda that only reads a variable leaves it shared. A variable
+    // written inside the agenda belongs to the scope of the agenda and
+    // neither workspace sees the write afterwards
+    forloop_agendaExecute(ws_copy, 0, copy_f_grid);
+    check("Read variable stays shared",
+          ws_copy.is_shared(i_f_grid) and ws_copy[i_f_grid] == ws[i_f_grid]);
+    check("Written variable stays in the agenda scope",
+          Var::p_grid(ws).value().nelem() == 1 and
+              Var::p_grid(ws_copy).value().nelem() == 1 and
+              ws_copy[i_p_grid] == ws[i_p_grid]);
+
+    // A write to a shared variable goes to a private copy, the variable of
+    // the original workspace is not changed
+    forloop_agendaExecute(ws_copy, 0, double_f_grid);
+    const Vector& f_copy = Var::f_grid(ws_copy).value();
+    const Vector& f_orig = Var::f_grid(ws).value();
+    check("Write to a shared variable",
+          f_copy.nelem() == 3 and f_copy[0] == 1 and f_copy[2] == 3 and
+              f_orig[0] == 1 and f_orig[2] == 3);
+  }
+  check("Original intact after the copy is destroyed",
+        Var::f_grid(ws).value().nelem() == 3 and
+            Var::f_grid(ws).value()[1] == 2);
+
+  // Batch jobs run on workspace copies. The output shows that the jobs
+  // wrote to f_grid, the calling workspace still has the original values
+  Var::ybatch_start(ws) = 0;
+  Var::ybatch_n(ws) = 4;
+  Method::ybatchCalc(ws);
+  const ArrayOfVector& ybatch = Var::ybatch(ws).value();
+  check("ybatchCalc",
+        ybatch.nelem() == 4 and ybatch[0].nelem() == 3 and
+            ybatch[0][0] == 2 and ybatch[3][2] == 6 and
+            Var::f_grid(ws).value()[0] == 1 and
+            Var::f_grid(ws).value()[2] == 3);
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,122 @@
+#include <autoarts.h>
+#include <cstdio>
+#include "xml_io.h"
+#include "test_utils.h"
+
+//! Fills n contiguous values with distinct, non-integer values.
+void fill(Numeric* x, Index n) {
+  for (Index i = 0; i < n; i++) x[i] = -1.5 + 0.3 * Numeric(i) + 1e-7 * i * i;
+}
+
+//! Compares n contiguous values bit for bit.
+bool same(const Numeric* a, const Numeric* b, Index n) {
+  for (Index i = 0; i < n; i++)
+    if (a[i] != b[i]) return false;
+  return true;
+}
+
+//! Writes a value as binary XML and reads it back.
+template <typename T>
+T roundtrip(const T& x, const Verbosity& verbosity) {
+  const String filename = "test_xml_binary.xml";
+  xml_write_to_file(filename, x, FILE_TYPE_BINARY, 0, verbosity);
+  T y;
+  xml_read_from_file(filename, y, verbosity);
+  std::remove(filename.c_str());
+  std::remove((filename + ".bin").c_str());
+  return y;
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+  const Verbosity& verbosity = Var::verbosity(ws).value();
+
+  Vector v(17);
+  fill(v.get_c_array(), v.nelem());
+  const Vector v2 = roundtrip(v, verbosity);
+  check("Vector", v2.nelem() == 17 and same(v.get_c_array(), v2.get_c_array(), 17));
+  check("Empty Vector", roundtrip(Vector(), verbosity).nelem() == 0);
+
+  Matrix m(3, 5);
+  fill(m.get_c_array(), 15);
+  const Matrix m2 = roundtrip(m, verbosity);
+  check("Matrix", m2.nrows() == 3 and m2.ncols() == 5 and
+                      same(m.get_c_array(), m2.get_c_array(), 15));
+
+  Tensor3 t3(2, 3, 4);
+  fill(t3.get_c_array(), 24);
+  const Tensor3 t32 = roundtrip(t3, verbosity);
+  check("Tensor3", t32.npages() == 2 and t32.nrows() == 3 and
+                       t32.ncols() == 4 and
+                       same(t3.get_c_array(), t32.get_c_array(), 24));
+
+  Tensor4 t4(2, 3, 1, 4);
+  fill(t4.get_c_array(), 24);
+  const Tensor4 t42 = roundtrip(t4, verbosity);
+  check("Tensor4", t42.nbooks() == 2 and t42.npages() == 3 and
+                       t42.nrows() == 1 and t42.ncols() == 4 and
+                       same(t4.get_c_array(), t42.get_c_array(), 24));
+
+  Tensor5 t5(2, 1, 3, 2, 2);
+  fill(t5.get_c_array(), 24);
+  const Tensor5 t52 = roundtrip(t5, verbosity);
+  check("Tensor5", t52.nshelves() == 2 and t52.nbooks() == 1 and
+                       t52.npages() == 3 and t52.nrows() == 2 and
+                       t52.ncols() == 2 and
+                       same(t5.get_c_array(), t52.get_c_array(), 24));
+
+  Tensor6 t6(2, 1, 2, 3, 1, 2);
+  fill(t6.get_c_array(), 24);
+  const Tensor6 t62 = roundtrip(t6, verbosity);
+  check("Tensor6", t62.nvitrines() == 2 and t62.nshelves() == 1 and
+                       t62.nbooks() == 2 and t62.npages() == 3 and
+                       t62.nrows() == 1 and t62.ncols() == 2 and
+                       same(t6.get_c_array(), t62.get_c_array(), 24));
+
+  Tensor7 t7(1, 2, 1, 2, 3, 1, 2);
+  fill(t7.get_c_array(), 24);
+  const Tensor7 t72 = roundtrip(t7, verbosity);
+  check("Tensor7", t72.nlibraries() == 1 and t72.nvitrines() == 2 and
+                       t72.nshelves() == 1 and t72.nbooks() == 2 and
+                       t72.npages() == 3 and t72.nrows() == 1 and
+                       t72.ncols() == 2 and
+                       same(t7.get_c_array(), t72.get_c_array(), 24));
+
+  // Negative numbers must survive the 32-bit integers of the file
+  const ArrayOfIndex ai{0, 1, -1, 123456, -123456, 7};
+  check("ArrayOfIndex", roundtrip(ai, verbosity) == ai);
+  check("Empty ArrayOfIndex", roundtrip(ArrayOfIndex(), verbosity).empty());
+
+  const ArrayOfVector av{v, Vector(), Vector(3, -2.25)};
+  const ArrayOfVector av2 = roundtrip(av, verbosity);
+  check("ArrayOfVector",
+        av2.nelem() == 3 and av2[0].nelem() == 17 and
+            same(v.get_c_array(), av2[0].get_c_array(), 17) and
+            av2[1].nelem() == 0 and av2[2].nelem() == 3 and
+            av2[2][2] == -2.25);
+
+  const ArrayOfMatrix am{m, Matrix(2, 2, 0.125)};
+  const ArrayOfMatrix am2 = roundtrip(am, verbosity);
+  check("ArrayOfMatrix",
+        am2.nelem() == 2 and am2[0].nrows() == 3 and am2[0].ncols() == 5 and
+            same(m.get_c_array(), am2[0].get_c_array(), 15) and
+            am2[1].nrows() == 2 and am2[1](1, 1) == 0.125);
+
+  Sparse s(4, 5);
+  s.rw(0, 0) = 1.5;
+  s.rw(1, 3) = -2.75;
+  s.rw(3, 4) = 1e-300;
+  const Sparse s2 = roundtrip(s, verbosity);
+  check("Sparse", s2.nrows() == 4 and s2.ncols() == 5 and s2.nnz() == 3 and
+                      s2(0, 0) == 1.5 and s2(1, 3) == -2.75 and
+                      s2(3, 4) == 1e-300 and s2(2, 2) == 0);
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,125 @@
+#include <autoarts.h>
+#include "absorption.h"
+#include "test_utils.h"
+
+//! A band of nl lines of the first isotopologue of a species.
+/*!
+  The lines are spread from f0 in steps of df, with line strength and
+  broadening varying from line to line.
+*/
+Absorption::Lines species_band(const String& species,
+                               Index nl,
+                               Numeric f0,
+                               Numeric df) {
+  using LineShape::ModelParameters;
+  using LineShape::TemperatureModel;
+
+  std::vector<Absorption::SingleLine> lines;
+  for (Index i = 0; i < nl; i++) {
+    const Numeric x = 1 + 0.1 * Numeric(i);
+    std::vector<LineShape::SingleSpeciesModel> ssm(2);
+    ssm[0].G0() = ModelParameters(TemperatureModel::T1, 2e4 * x, 0.7);
+    ssm[1].G0() = ModelParameters(TemperatureModel::T1, 1e4 * x, 0.8);
+    lines.emplace_back(f0 + df * Numeric(i), 1e-20 * x, 1e-21 * x, 1, 1,
+                       1e-3, Zeeman::Model(), LineShape::Model(ssm));
+  }
+
+  return make_band(lines,
+                   {SpeciesTag("O2"), SpeciesTag("H2O")},
+                   QuantumIdentifier(QuantumIdentifier::TRANSITION,
+                                     species_index_from_species_name(species),
+                                     0));
+}
+
+//! Compares two matrices bit for bit.
+bool same(const Matrix& a, const Matrix& b) {
+  if (a.nrows() != b.nrows() or a.ncols() != b.ncols()) return false;
+  for (Index i = 0; i < a.nrows(); i++)
+    for (Index j = 0; j < a.ncols(); j++)
+      if (a(i, j) != b(i, j)) return false;
+  return true;
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  Method::abs_speciesSet(ws, ArrayOfString{"O2", "H2O"});
+  Method::partition_functionsInitFromBuiltin(ws);
+  Method::isotopologue_ratiosInitFromBuiltin(ws);
+  const auto& abs_species = Var::abs_species(ws).value();
+  const auto& isotopologue_ratios = Var::isotopologue_ratios(ws).value();
+  const auto& partition_functions = Var::partition_functions(ws).value();
+
+  // Bands of different sizes, including an empty one that has no tiles
+  const ArrayOfArrayOfAbsorptionLines abs_lines_per_species{
+      {species_band("O2", 4, 50e9, 3e9), species_band("O2", 1, 61e9, 0),
+       species_band("O2", 0, 0, 0)},
+      {species_band("H2O", 3, 22e9, 11e9), species_band("H2O", 2, 90e9, 5e9),
+       species_band("H2O", 1, 110e9, 0)}};
+  const ArrayOfIndex species{0, 1};
+
+  // A prime number of frequencies, so that no split of the grid is even
+  Vector f_grid;
+  nlinspace(f_grid, 10e9, 120e9, 97);
+  const Index nf = f_grid.nelem();
+
+  Method::SetNumberOfThreads(ws, 4);
+
+  // Five bands with lines give numbers of tiles that are no multiple of
+  // the number of threads
+  for (const Index np : {1, 3, 5}) {
+    Vector abs_p(np), abs_t(np);
+    Matrix abs_vmrs(2, np);
+    for (Index ip = 0; ip < np; ip++) {
+      abs_p[ip] = 1e5 * std::pow(0.5, Numeric(ip));
+      abs_t[ip] = 290 - 10 * Numeric(ip);
+      abs_vmrs(0, ip) = 0.21;
+      abs_vmrs(1, ip) = 1e-2 / Numeric(ip + 1);
+    }
+    const EnergyLevelMap abs_nlte;
+
+    // Band by band, as the serial path of abs_xsec_per_speciesAddLines
+    ArrayOfMatrix xsec(2, Matrix(nf, np, 0)), source(2, Matrix(nf, np, 0));
+    ArrayOfArrayOfMatrix dxsec_dx(2), dsource_dx(2);
+    Matrix phase(0, 0);
+    ArrayOfMatrix dphase_dx(0);
+    for (const Index i : species)
+      for (const auto& band : abs_lines_per_species[i])
+        xsec_species(
+            xsec[i], source[i], phase, dxsec_dx[i], dsource_dx[i], dphase_dx,
+            {}, {}, f_grid, abs_p, abs_t, abs_nlte, abs_vmrs, abs_species,
+            band,
+            isotopologue_ratios.getIsotopologueRatio(band.QuantumIdentity()),
+            partition_functions.getParamType(band.QuantumIdentity()),
+            partition_functions.getParam(band.QuantumIdentity()));
+
+    ArrayOfMatrix xsec_tiled(2, Matrix(nf, np, 0)),
+        source_tiled(2, Matrix(nf, np, 0));
+    ArrayOfArrayOfMatrix dxsec_dx_tiled(2), dsource_dx_tiled(2);
+    xsec_species_tiled(xsec_tiled, source_tiled, dxsec_dx_tiled,
+                       dsource_dx_tiled, {}, {}, f_grid, abs_p, abs_t,
+                       abs_nlte, abs_vmrs, abs_species, species,
+                       abs_lines_per_species, isotopologue_ratios,
+                       partition_functions);
+
+    std::ostringstream os;
+    os << np << " levels, " << 5 * np << " tiles";
+    bool nonzero = false;
+    for (Index i = 0; i < 2; i++) nonzero = nonzero or max(xsec[i]) > 0;
+    check("Cross-sections are not zero, " + os.str(), nonzero);
+    check("Tiled cross-sections match, " + os.str(),
+          same(xsec_tiled[0], xsec[0]) and same(xsec_tiled[1], xsec[1]));
+    check("Tiled source cross-sections match, " + os.str(),
+          same(source_tiled[0], source[0]) and
+              same(source_tiled[1], source[1]));
+  }
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,314 @@
+#include <autoarts.h>
+#include "arts_omp.h"
+#include "matpack_pool.h"
+
+namespace ARTS::Agenda {
+  Workspace& iy_main_agenda_emission(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    iy_main_agenda(ws, ppathCalc(ws), iyEmissionStandard(ws));
+    return ws;
+  }
+
+  Workspace& iy_space_agenda_cosmic_background(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    iy_space_agenda(ws, Ignore(ws, rtp_pos(ws)), Ignore(ws, rtp_los(ws)),
+                    MatrixCBR(ws, iy(ws), f_grid(ws)));
+    return ws;
+  }
+
+  Workspace& iy_surface_agenda_use_surface_property(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    iy_surface_agenda(ws, SurfaceDummy(ws), iySurfaceRtpropAgenda(ws));
+    return ws;
+  }
+
+  Workspace& ppath_agenda_follow_sensor_los(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    ppath_agenda(ws, Ignore(ws, rte_pos2(ws)), ppathStepByStep(ws));
+    return ws;
+  }
+
+  Workspace& ppath_step_agenda_geometric_path(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    ppath_step_agenda(ws, Ignore(ws, ppath_lraytrace(ws)), Ignore(ws, f_grid(ws)),
+                      ppath_stepGeometric(ws));
+    return ws;
+  }
+
+  Workspace& propmat_clearsky_agenda_on_the_fly(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    propmat_clearsky_agenda(ws, Ignore(ws, rtp_mag(ws)), Ignore(ws, rtp_los(ws)),
+                            propmat_clearskyInit(ws),
+                            propmat_clearskyAddOnTheFly(ws));
+    return ws;
+  }
+
+  Workspace& abs_xsec_agenda_standard(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    abs_xsec_agenda(ws, abs_xsec_per_speciesInit(ws),
+                    abs_xsec_per_speciesAddLines(ws),
+                    abs_xsec_per_speciesAddConts(ws));
+    return ws;
+  }
+
+  Workspace& surface_rtprop_agenda_blackbody_from_surface(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    surface_rtprop_agenda(
+      ws, InterpSurfaceFieldToPosition(ws, surface_skin_t(ws), t_surface(ws)),
+                          surfaceBlackbody(ws));
+    return ws;
+  }
+
+  Workspace& geo_pos_agenda_empty(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    geo_pos_agenda(ws, Ignore(ws, ppath(ws)),
+                   VectorSet(ws, geo_pos(ws), VectorCreate(ws, {}, "Default")));
+    return ws;
+  }
+
+  Workspace& ybatch_calc_agenda_perturb_t_field(Workspace& ws,
+                                                const Tensor3& t_field_orig,
+                                                const Vector& p_ret_grid) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    using namespace Var;
+    ybatch_calc_agenda(
+        ws,
+        AtmFieldPerturb(ws, t_field(ws),
+                        Tensor3Create(ws, t_field_orig, "test_t_field_orig"),
+                        VectorCreate(ws, p_ret_grid, "test_p_ret_grid"),
+                        VectorCreate(ws, {}, "test_lat_ret_grid"),
+                        VectorCreate(ws, {}, "test_lon_ret_grid"),
+                        ybatch_index(ws),
+                        NumericCreate(ws, 1.0, "test_pert_size")),
+        yCalc(ws));
+    return ws;
+  }
+
+  Workspace& water_p_eq_agenda_default(Workspace& ws) {
+    using namespace Agenda::Method;
+    using namespace Agenda::Define;
+    water_p_eq_agenda(ws, water_p_eq_fieldMK05(ws));
+    return ws;
+  }
+}  // namespace ARTS::Agenda
+
+//! Largest relative difference between two vectors of the same size.
+Numeric max_rel_diff(const Vector& a, const Vector& b) {
+  if (a.nelem() != b.nelem()) return std::numeric_limits<Numeric>::infinity();
+  Numeric d = 0;
+  for (Index i = 0; i < a.nelem(); i++)
+    d = std::max(d, std::abs(a[i] - b[i]) / std::max(std::abs(b[i]), 1e-300));
+  return d;
+}
+
+//! Fails the test if two vectors differ.
+void check_equal(const String& what, const Vector& a, const Vector& b) {
+  const Numeric d = max_rel_diff(a, b);
+  std::cout << what << ": relative difference " << d << '\n';
+  if (not(d <= 1e-12)) throw std::runtime_error(what + " differs");
+}
+
+//! Fails the test if two matrices differ.
+void check_equal(const String& what, const Matrix& a, const Matrix& b) {
+  if (a.nrows() != b.nrows() or a.ncols() != b.ncols())
+    throw std::runtime_error(what + " has the wrong size");
+  Vector va(a.nrows() * a.ncols()), vb(b.nrows() * b.ncols());
+  for (Index r = 0; r < a.nrows(); r++)
+    for (Index c = 0; c < a.ncols(); c++) {
+      va[r * a.ncols() + c] = a(r, c);
+      vb[r * a.ncols() + c] = b(r, c);
+    }
+  check_equal(what, va, vb);
+}
+
+//! Scratch pool hits summed over the worker threads of a team of n threads.
+/*!
+  Relies on the OpenMP runtime keeping its worker threads from one
+  parallel region to the next, as the common runtimes do.
+*/
+Index worker_scratch_hits(int n) {
+  Index hits = 0;
+#pragma omp parallel num_threads(n) reduction(+ : hits)
+  if (arts_omp_get_thread_num() != 0) hits += matpack_scratch_hits();
+  return hits;
+}
+
+int main() try {
+  using namespace ARTS;
+
+  auto ws = init(0, 0, 0);
+
+  ARTS::Agenda::iy_main_agenda_emission(ws);
+  ARTS::Agenda::iy_space_agenda_cosmic_background(ws);
+  ARTS::Agenda::iy_surface_agenda_use_surface_property(ws);
+  ARTS::Agenda::ppath_agenda_follow_sensor_los(ws);
+  ARTS::Agenda::ppath_step_agenda_geometric_path(ws);
+  ARTS::Agenda::propmat_clearsky_agenda_on_the_fly(ws);
+  ARTS::Agenda::abs_xsec_agenda_standard(ws);
+  ARTS::Agenda::surface_rtprop_agenda_blackbody_from_surface(ws);
+  ARTS::Agenda::geo_pos_agenda_empty(ws);
+  ARTS::Agenda::water_p_eq_agenda_default(ws);
+
+  Method::jacobianOff(ws);
+  Method::nlteOff(ws);
+  Var::iy_unit(ws) = "PlanckBT";
+  Method::Touch(ws, Var::iy_aux_vars(ws));
+  Method::Touch(ws, Var::surface_props_names(ws));
+
+  Method::abs_cont_descriptionInit(ws);
+  Method::abs_cont_descriptionAppend(ws, String{"H2O-PWR98"}, String{"Rosenkranz"});
+  Method::abs_cont_descriptionAppend(ws, String{"O2-PWR98"}, String{"Rosenkranz"});
+  Method::abs_speciesSet(ws, ArrayOfString{"H2O-PWR98", "O2-PWR98"});
+
+  Method::partition_functionsInitFromBuiltin(ws);
+  Method::isotopologue_ratiosInitFromBuiltin(ws);
+  Method::VectorNLogSpace(ws, Var::p_grid(ws).value(), 51, 1e+05, 1e-4);
+
+  Method::AtmosphereSet1D(ws);
+  Var::lat_true(ws) = Var::lat_grid(ws);
+  Var::lon_true(ws) = Var::lon_grid(ws);
+  Method::Touch(ws, Var::wind_u_field(ws));
+  Method::Touch(ws, Var::wind_v_field(ws));
+  Method::Touch(ws, Var::wind_w_field(ws));
+  Method::Touch(ws, Var::mag_u_field(ws));
+  Method::Touch(ws, Var::mag_v_field(ws));
+  Method::Touch(ws, Var::mag_w_field(ws));
+  Method::Touch(ws, Var::nlte_field(ws));
+  Method::Touch(ws, Var::rte_alonglos_v(ws));
+  Method::Touch(ws, Var::surface_props_data(ws));
+
+  Var::p_hse(ws) = 1e5;
+  Var::t_field(ws) = Tensor3(51, 1, 1, 250.0);
+  Var::vmr_field(ws) = Tensor4(2, 51, 1, 1, 1e-2);
+  Var::z_field(ws) = Tensor3(51, 1, 1, 0);
+  for (Index i=0; i<51; i++) Var::z_field(ws).value()(i, 0, 0) = 2e3 * Numeric(i);
+
+  Method::refellipsoidEarth(ws, String{"Sphere"});
+  Method::z_surfaceConstantAltitude(ws);
+  Var::t_surface(ws) = Matrix(1, 1, 250.0);
+
+  Method::Touch(ws, Var::abs_lines(ws));
+  Method::abs_lines_per_speciesCreateFromLines(ws);
+
+  Var::abs_f_interp_order(ws) = 1;
+  Var::stokes_dim(ws) = 1;
+  Var::ppath_lraytrace(ws) = 1e3;
+  Var::ppath_lmax(ws) = 1e3;
+  Var::rt_integration_option(ws) = "default";
+
+  Method::VectorNLinSpace(ws, Var::f_grid(ws).value(), 41, 22e9 - 2e9, 22e9 + 2e9);
+
+  // Two measurement blocks, fewer than the threads, so that yCalc can
+  // split f_grid into chunks
+  Var::sensor_pos(ws) = Matrix(2, 1, 100);
+  Var::sensor_los(ws) = Matrix(2, 1, 75);
+  Var::sensor_los(ws).value()(1, 0) = 45;
+  Method::Touch(ws, Var::transmitter_pos(ws));
+  Method::sensorOff(ws);
+  Method::cloudboxOff(ws);
+
+  Method::atmgeom_checkedCalc(ws);
+  Method::atmfields_checkedCalc(ws);
+  Method::cloudbox_checkedCalc(ws);
+  Method::sensor_checkedCalc(ws);
+  Method::propmat_clearsky_agenda_checkedCalc(ws);
+  Method::abs_xsec_agenda_checkedCalc(ws);
+  Method::lbl_checkedCalc(ws);
+
+  Method::SetNumberOfThreads(ws, 4);
+
+  // Frequency chunks
+  Method::yCalc(ws);
+  const Vector y = Var::y(ws).value();
+  const Vector y_f = Var::y_f(ws).value();
+  Method::yCalc(ws, 6);
+  check_equal("y with frequency chunks", Var::y(ws).value(), y);
+  check_equal("y_f with frequency chunks", Var::y_f(ws).value(), y_f);
+
+  // Pointing Jacobian by recalculation. With one thread, the mblocks are
+  // calculated one by one. With more threads than mblocks, the reruns
+  // inside jacobian_agenda are made in parallel over the mblocks.
+  Var::sensor_time(ws) = Vector{0, 1};
+  Method::jacobianInit(ws);
+  Method::jacobianAddPointingZa(ws, 0, String{"recalc"}, 0.01);
+  Method::jacobianClose(ws);
+
+  Method::SetNumberOfThreads(ws, 1);
+  Method::yCalc(ws);
+  const Matrix jacobian = Var::jacobian(ws).value();
+  Method::SetNumberOfThreads(ws, 4);
+  Method::yCalc(ws);
+  check_equal("y with pointing Jacobian", Var::y(ws).value(), y);
+  check_equal("Pointing Jacobian", Var::jacobian(ws).value(), jacobian);
+
+  // Temperature Jacobian from perturbed spectra. ybatchCalc runs the
+  // perturbations in parallel, each thread on its own copy of t_field.
+  Method::jacobianOff(ws);
+  const Vector p_ret_grid{1e5, 1e4, 1e3, 1e2, 1e1};
+  ARTS::Agenda::ybatch_calc_agenda_perturb_t_field(
+      ws, Var::t_field(ws).value(), p_ret_grid);
+  Method::yCalc(ws);
+  const Vector y0 = Var::y(ws).value();
+  Var::ybatch_start(ws) = 0;
+  Var::ybatch_n(ws) = p_ret_grid.nelem();
+
+  Method::SetNumberOfThreads(ws, 1);
+  Method::ybatchCalc(ws);
+  Method::jacobianFromYbatch(ws, 1.0);
+  const Matrix jacobian_t = Var::jacobian(ws).value();
+  Method::SetNumberOfThreads(ws, 4);
+  Method::ybatchCalc(ws);
+  Method::jacobianFromYbatch(ws, 1.0);
+  check_equal("Temperature Jacobian from ybatch", Var::jacobian(ws).value(),
+              jacobian_t);
+  Numeric dy_max = 0;
+  for (Index i = 0; i < jacobian_t.nrows(); i++)
+    for (Index j = 0; j < jacobian_t.ncols(); j++)
+      dy_max = std::max(dy_max, std::abs(jacobian_t(i, j)));
+  std::cout << "Largest temperature Jacobian: " << dy_max << '\n';
+  if (not(dy_max > 0))
+    throw std::runtime_error("Temperature Jacobian is zero");
+
+  // The perturbations are made on thread copies, not on t_field of ws
+  Method::yCalc(ws);
+  check_equal("y after ybatchCalc", Var::y(ws).value(), y0);
+
+  // With a single mblock and LOS, iyEmissionStandard runs its ppath loop
+  // in parallel, and the worker threads pool their temporaries
+  Var::sensor_pos(ws) = Matrix(1, 1, 100);
+  Var::sensor_los(ws) = Matrix(1, 1, 75);
+  Var::sensor_time(ws) = Vector{0};
+  Method::sensorOff(ws);
+  Method::sensor_checkedCalc(ws);
+  if (arts_omp_get_max_threads() > 1) {
+    const Index hits0 = worker_scratch_hits(4);
+    Method::yCalc(ws);
+    const Index hits = worker_scratch_hits(4) - hits0;
+    std::cout << "Scratch pool hits of worker threads: " << hits << '\n';
+    if (not(hits > 0))
+      throw std::runtime_error("Worker threads do not use the scratch pool");
+  }
+
+  return EXIT_SUCCESS;
+} catch(const std::exception& e) {
+  std::ostringstream os;
+  os << "EXITING WITH ERROR:\n" << e.what() << '\n';
+  std::cerr << os.str();
+  return EXIT_FAILURE;
+}
@@ -121,7 +121,7 @@ ostream& operator<<(ostream& os, const TokVal& a) {
     case Matrix_t:
       os << "[";
       for (Index i = 0; i < a.mm.nrows(); ++i) {
-        for (Index j = 0; i < a.mm.ncols(); ++j) {
+        for (Index j = 0; j < a.mm.ncols(); ++j) {
           if (first)
             first = false;
           else {
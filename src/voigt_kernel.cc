@@ -0,0 +1,168 @@
+/*!
+ * @file   voigt_kernel.cc
+ * @date   2026-10-15
+ *
+ * @brief  Selectable evaluation of the Faddeeva function for Voigt lines.
+ */
+
+#include "voigt_kernel.h"
+#include <Faddeeva/Faddeeva.hh>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include "constants.h"
+
+namespace Linefunctions {
+
+namespace {
+std::atomic<VoigtKernel> selected_kernel{VoigtKernel::Faddeeva};
+
+/** Number of terms of the Weideman approximation */
+constexpr Index weideman_n = 32;
+
+/** Limit of |Re z| + Im z above which Gauss-Hermite quadrature is used */
+constexpr Numeric asymptotic_limit = 8;
+
+/** Squared nodes and weights times 2/pi of 12-point Gauss-Hermite quadrature
+ *
+ * Only the positive nodes are needed, since the symmetric pairs are added up
+ * analytically: w(z) = i z sum_k c_k / (z^2 - t_k^2).
+ */
+constexpr std::array<std::array<Numeric, 2>, 6> gauss_hermite{{
+    {15.129959781108084, 1.6924865681223604e-07},
+    {9.1242480375311779, 5.4581786940397948e-05},
+    {5.1961525300544649, 0.0024862488649930528},
+    {2.5525898026681713, 0.032854664055133424},
+    {0.89830283456961757, 0.16583455526387558},
+    {0.098747014068481201, 0.36295936432815701},
+}};
+
+/** Polynomial coefficients of Weideman's approximation
+ *
+ * Computed once from a discrete Fourier transform as given in the
+ * original paper.
+ */
+struct WeidemanCoefficients {
+  Numeric L;
+  std::array<Numeric, weideman_n> a;
+
+  WeidemanCoefficients() : L(std::sqrt(weideman_n / std::sqrt(2.0))) {
+    constexpr Index M = 2 * weideman_n;
+    constexpr Index M2 = 2 * M;
+
+    std::array<Numeric, M2> f;
+    for (Index i = 0; i < M2; i++) {
+      // Index after fftshift of the samples at k = -M, ..., M-1
+      const Index k = (i < M) ? i : i - M2;
+      const Numeric t =
+          L * std::tan(Numeric(k) * Constant::pi / Numeric(2 * M));
+      f[i] = (k == -M) ? 0 : std::exp(-t * t) * (L * L + t * t);
+    }
+
+    for (Index n = 0; n < weideman_n; n++) {
+      const Index j = weideman_n - n;
+      Numeric s = 0;
+      for (Index i = 0; i < M2; i++)
+        s += f[i] * std::cos(2 * Constant::pi * Numeric(i * j) / Numeric(M2));
+      a[n] = s / Numeric(M2);
+    }
+  }
+};
+}  // namespace
+
+void set_voigt_kernel(VoigtKernel kernel) noexcept { selected_kernel = kernel; }
+
+VoigtKernel voigt_kernel() noexcept { return selected_kernel; }
+
+VoigtKernel toVoigtKernelOrThrow(const String& name) {
+  if (name == "Faddeeva") return VoigtKernel::Faddeeva;
+  if (name == "Weideman") return VoigtKernel::Weideman;
+
+  std::ostringstream os;
+  os << "Unknown Voigt kernel: \"" << name << "\"\n"
+     << "Valid kernels are \"Faddeeva\" and \"Weideman\".";
+  throw std::runtime_error(os.str());
+}
+
+void faddeeva_weideman(Complex* w, const Complex* z, Index n) {
+  static const WeidemanCoefficients wc;
+  const Numeric L = wc.L;
+  const Numeric* a = wc.a.data();
+
+  // Work in blocks with the real and imaginary parts in separate arrays
+  constexpr Index block = 64;
+  std::array<Numeric, block> x, y, wr, wi;
+  std::array<Index, block> inner;
+
+  for (Index i0 = 0; i0 < n; i0 += block) {
+    const Index nb = std::min(block, n - i0);
+
+    for (Index i = 0; i < nb; i++) {
+      x[i] = z[i0 + i].real();
+      y[i] = z[i0 + i].imag();
+    }
+
+    // Asymptotic region, evaluated for all points
+#pragma omp simd
+    for (Index i = 0; i < nb; i++) {
+      const Numeric z2r = x[i] * x[i] - y[i] * y[i];
+      const Numeric z2i = 2 * x[i] * y[i];
+      Numeric sr = 0, si = 0;
+      for (const auto& tc : gauss_hermite) {
+        const Numeric dr = z2r - tc[0];
+        const Numeric c = tc[1] / (dr * dr + z2i * z2i);
+        sr += c * dr;
+        si -= c * z2i;
+      }
+      // i z s
+      wr[i] = -(x[i] * si + y[i] * sr);
+      wi[i] = x[i] * sr - y[i] * si;
+    }
+
+    // Gather the points close to the line center
+    Index ninner = 0;
+    for (Index i = 0; i < nb; i++)
+      if (y[i] >= 0 and std::abs(x[i]) + y[i] <= asymptotic_limit)
+        inner[ninner++] = i;
+
+#pragma omp simd
+    for (Index j = 0; j < ninner; j++) {
+      const Index i = inner[j];
+      const Numeric xi = x[i];
+      const Numeric yi = y[i];
+
+      // r = 1 / (L - i z), Z = (L + i z) / (L - i z)
+      const Numeric den = 1 / ((L + yi) * (L + yi) + xi * xi);
+      const Numeric rr = (L + yi) * den;
+      const Numeric ri = xi * den;
+      const Numeric Zr = ((L - yi) * (L + yi) - xi * xi) * den;
+      const Numeric Zi = 2 * L * xi * den;
+
+      // Horner scheme of the polynomial in Z
+      Numeric pr = a[0], pi = 0;
+      for (Index k = 1; k < weideman_n; k++) {
+        const Numeric t = pr * Zr - pi * Zi + a[k];
+        pi = pr * Zi + pi * Zr;
+        pr = t;
+      }
+
+      // w = 2 p r^2 + r / sqrt(pi)
+      const Numeric r2r = rr * rr - ri * ri;
+      const Numeric r2i = 2 * rr * ri;
+      wr[i] = 2 * (pr * r2r - pi * r2i) + Constant::inv_sqrt_pi * rr;
+      wi[i] = 2 * (pr * r2i + pi * r2r) + Constant::inv_sqrt_pi * ri;
+    }
+
+    for (Index i = 0; i < nb; i++) {
+      if (y[i] < 0)
+        w[i0 + i] = Faddeeva::w(z[i0 + i]);
+      else
+        w[i0 + i] = Complex(wr[i], wi[i]);
+    }
+  }
+}
+
+}  // namespace Linefunctions
@@ -67,10 +67,12 @@ void Workspace::del(Index i) {
   WsvStruct *wsvs = ws[i].top();
 
   if (wsvs && wsvs->wsv) {
-    workspace_memory_handler.deallocate(wsv_data[i].Group(), wsvs->wsv);
+    if (!wsvs->shared)
+      workspace_memory_handler.deallocate(wsv_data[i].Group(), wsvs->wsv);
     wsvs->wsv = NULL;
     wsvs->auto_allocated = false;
     wsvs->initialized = false;
+    wsvs->shared = false;
   }
 }
 
@@ -89,6 +91,31 @@ void Workspace::duplicate(Index i) {
   ws[i].push(wsvs);
 }
 
+void Workspace::share(Index i) {
+  WsvStruct *wsvs = new WsvStruct;
+
+  wsvs->auto_allocated = false;
+  if (ws[i].size() && ws[i].top()->wsv) {
+    wsvs->wsv = ws[i].top()->wsv;
+    wsvs->initialized = ws[i].top()->initialized;
+    wsvs->shared = true;
+  } else {
+    wsvs->wsv = NULL;
+    wsvs->initialized = false;
+  }
+  ws[i].push(wsvs);
+}
+
+void Workspace::unshare(Index i) {
+  if (!is_shared(i)) return;
+
+  WsvStruct *wsvs = ws[i].top();
+  wsvs->wsv =
+      workspace_memory_handler.duplicate(wsv_data[i].Group(), wsvs->wsv);
+  wsvs->auto_allocated = true;
+  wsvs->shared = false;
+}
+
 Workspace::Workspace(const Workspace &workspace) : ws(workspace.ws.nelem()) {
 #ifndef NDEBUG
   context = workspace.context;
@@ -99,6 +126,7 @@ Workspace::Workspace(const Workspace &workspace) : ws(workspace.ws.nelem()) {
     if (workspace.ws[i].size() && workspace.ws[i].top()->wsv) {
       wsvs->wsv = workspace.ws[i].top()->wsv;
       wsvs->initialized = workspace.ws[i].top()->initialized;
+      wsvs->shared = true;
     } else {
       wsvs->wsv = NULL;
       wsvs->initialized = false;
@@ -141,7 +169,7 @@ void Workspace::pop_free(Index i) {
   WsvStruct *wsvs = ws[i].top();
 
   if (wsvs) {
-    if (wsvs->wsv)
+    if (wsvs->wsv && !wsvs->shared)
       workspace_memory_handler.deallocate(wsv_data[i].Group(), wsvs->wsv);
 
     delete wsvs;
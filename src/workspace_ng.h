@@ -25,12 +25,16 @@
 #ifndef WORKSPACE_NG_INCLUDED
 #define WORKSPACE_NG_INCLUDED
 
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <stack>
+#include <vector>
 
 class Workspace;
 
 #include "array.h"
+#include "arts_omp.h"
 #include "wsv_aux.h"
 
 /** Workspace class.
@@ -43,6 +47,8 @@ class Workspace {
     void *wsv;
     bool initialized;
     bool auto_allocated;
+    /** The WSV belongs to an outer scope and is only read here. */
+    bool shared = false;
   };
 
   /** Workspace variable container. */
@@ -69,7 +75,8 @@ class Workspace {
   /** Workspace copy constructor.
    *
    * Make a copy of a workspace. The copy constructor will only copy the topmost
-   * layer of the workspace variable stacks.
+   * layer of the workspace variable stacks. The variables themselves are
+   * shared with the original workspace, see share.
    *
    * @param[in] workspace The workspace to be copied
    */
@@ -104,6 +111,33 @@ class Workspace {
    */
   void duplicate(Index i);
 
+  /** Share WSV.
+   *
+   * Create another level of scope that refers to the same variable as the
+   * top element on the WSV stack. The variable is not copied until
+   * unshare is called, which has to happen before anything writes to it.
+   *
+   * @param[in] i WSV index.
+   */
+  void share(Index i);
+
+  /** Give a shared WSV its own copy.
+   *
+   * Does nothing if the topmost WSV is not shared.
+   *
+   * @param[in] i WSV index.
+   */
+  void unshare(Index i);
+
+  /** Checks if the topmost WSV is shared with an outer scope.
+   *
+   * @param[in] i WSV index.
+   * @return true if the WSV is shared.
+   */
+  bool is_shared(Index i) {
+    return ((ws[i].size() != 0) && (ws[i].top()->shared == true));
+  }
+
   /** Reset the size of the workspace.
    *
    * Resize the workspace to match the number of WSVs in wsv_data.
@@ -168,6 +202,54 @@ class Workspace {
   void *operator[](Index i);
 };
 
+/** Workspaces for the threads of a parallel loop that executes agendas.
+ *
+ * Agendas executed by different threads need their own workspace. If the
+ * loop runs in parallel, one copy of the workspace is made for each thread
+ * up front, and all iterations of a thread reuse it. No more threads are
+ * used than the loop has iterations, so a loop over few items only copies
+ * the workspace a few times. If the loop does not run in parallel, which
+ * is always the case when the caller itself runs inside a parallel region,
+ * the original workspace is used and nothing is copied.
+ *
+ * Use it together with
+ * "#pragma omp parallel for if (parallel()) num_threads(nthreads())".
+ */
+class ThreadWorkspaces {
+ public:
+  /** Set up the workspaces of all threads.
+   *
+   * @param[in] ws The workspace of the caller
+   * @param[in] niterations Number of iterations of the loop. Parallel
+   * execution requires more than one iteration, that the caller is not
+   * already inside a parallel region and that more than one thread is
+   * available.
+   */
+  ThreadWorkspaces(Workspace &ws, Index niterations) : mws(ws) {
+    const Index n = std::min(niterations, Index(arts_omp_get_max_threads()));
+    if (n > 1 && !arts_omp_in_parallel()) {
+      mcopies.resize(n);
+      for (auto &copy : mcopies) copy = std::make_unique<Workspace>(ws);
+    }
+  }
+
+  /** Whether the loop shall run in parallel. */
+  bool parallel() const { return !mcopies.empty(); }
+
+  /** The number of threads the loop shall use. */
+  int nthreads() const { return parallel() ? int(mcopies.size()) : 1; }
+
+  /** The workspace of the calling thread. */
+  Workspace &get() {
+    if (mcopies.empty()) return mws;
+    return *mcopies[arts_omp_get_thread_num()];
+  }
+
+ private:
+  Workspace &mws;
+  std::vector<std::unique_ptr<Workspace>> mcopies;
+};
+
 /** Print WSV name to output stream.
  *
  * Looks up the name of the WSV with index i and
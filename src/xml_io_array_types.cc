@@ -879,15 +879,37 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("nelem", nelem);
   aindex.resize(nelem);
 
-  Index n;
+  Index n = 0;
+  bool in_block = false;
   try {
-    for (n = 0; n < nelem; n++)
-      xml_read_from_stream(is_xml, aindex[n], pbifs, verbosity);
+    if (pbifs) {
+      // The values are stored as one block in the binary file, only the
+      // tags have to be read one by one.
+      in_block = true;
+      if (nelem) pbifs->readBlock(aindex.data(), nelem);
+      if (pbifs->fail()) {
+        xml_data_parse_error(tag, " in binary data block");
+      }
+      in_block = false;
+      ArtsXMLTag index_tag(verbosity);
+      for (n = 0; n < nelem; n++) {
+        index_tag.read_from_stream(is_xml);
+        index_tag.check_name("Index");
+        index_tag.read_from_stream(is_xml);
+        index_tag.check_name("/Index");
+      }
+    } else {
+      for (n = 0; n < nelem; n++)
+        xml_read_from_stream(is_xml, aindex[n], pbifs, verbosity);
+    }
   } catch (const std::runtime_error& e) {
     ostringstream os;
-    os << "Error reading ArrayOfIndex: "
-       << "\n Element: " << n << "\n"
-       << e.what();
+    os << "Error reading ArrayOfIndex: ";
+    if (in_block)
+      os << "\n Binary data block\n";
+    else
+      os << "\n Element: " << n << "\n";
+    os << e.what();
     throw runtime_error(os.str());
   }
 
@@ -919,8 +941,22 @@ void xml_write_to_stream(ostream& os_xml,
   open_tag.write_to_stream(os_xml);
   os_xml << '\n';
 
-  for (Index n = 0; n < aindex.nelem(); n++)
-    xml_write_to_stream(os_xml, aindex[n], pbofs, "", verbosity);
+  if (pbofs) {
+    // Write the values as one block, and the tags one by one.
+    if (aindex.nelem()) pbofs->writeBlock(aindex.data(), aindex.nelem());
+    ArtsXMLTag index_tag(verbosity);
+    ArtsXMLTag index_close_tag(verbosity);
+    index_tag.set_name("Index");
+    index_close_tag.set_name("/Index");
+    for (Index n = 0; n < aindex.nelem(); n++) {
+      index_tag.write_to_stream(os_xml);
+      index_close_tag.write_to_stream(os_xml);
+      os_xml << '\n';
+    }
+  } else {
+    for (Index n = 0; n < aindex.nelem(); n++)
+      xml_write_to_stream(os_xml, aindex[n], pbofs, "", verbosity);
+  }
 
   close_tag.set_name("/Array");
   close_tag.write_to_stream(os_xml);
@@ -237,17 +237,15 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   matrix.resize(nrows, ncols);
 
-  for (Index r = 0; r < nrows; r++) {
-    for (Index c = 0; c < ncols; c++) {
-      if (pbifs) {
-        *pbifs >> matrix(r, c);
-        if (pbifs->fail()) {
-          ostringstream os;
-          os << " near "
-             << "\n  Row   : " << r << "\n  Column: " << c;
-          xml_data_parse_error(tag, os.str());
-        }
-      } else {
+  if (pbifs) {
+    if (!matrix.empty())
+      pbifs->readBlock(matrix.get_c_array(), nrows * ncols);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index r = 0; r < nrows; r++) {
+      for (Index c = 0; c < ncols; c++) {
         is_xml >> double_imanip() >> matrix(r, c);
         if (is_xml.fail()) {
           ostringstream os;
@@ -289,20 +287,19 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index r = 0; r < matrix.nrows(); ++r) {
-    if (pbofs)
-      *pbofs << matrix(r, 0);
-    else
+  if (pbofs) {
+    if (!matrix.empty())
+      pbofs->writeBlock(matrix.get_c_array(), matrix.nrows() * matrix.ncols());
+  } else {
+    for (Index r = 0; r < matrix.nrows(); ++r) {
       os_xml << matrix(r, 0);
 
-    for (Index c = 1; c < matrix.ncols(); ++c) {
-      if (pbofs)
-        *pbofs << matrix(r, c);
-      else
+      for (Index c = 1; c < matrix.ncols(); ++c) {
         os_xml << " " << matrix(r, c);
-    }
+      }
 
-    if (!pbofs) os_xml << '\n';
+      os_xml << '\n';
+    }
   }
 
   close_tag.set_name("/Matrix");
@@ -468,16 +465,13 @@ void xml_read_from_stream(istream& is_xml,
   ArrayOfIndex rowind(nnz), colind(nnz);
   Vector data(nnz);
 
-  for (Index i = 0; i < nnz; i++) {
-    if (pbifs) {
-      *pbifs >> rowind[i];
-      if (pbifs->fail()) {
-        ostringstream os;
-        os << " near "
-           << "\n  Row index: " << i;
-        xml_data_parse_error(tag, os.str());
-      }
-    } else {
+  if (pbifs) {
+    if (nnz) pbifs->readBlock(rowind.data(), nnz);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index i = 0; i < nnz; i++) {
       is_xml >> rowind[i];
       if (is_xml.fail()) {
         ostringstream os;
@@ -493,16 +487,13 @@ void xml_read_from_stream(istream& is_xml,
   tag.read_from_stream(is_xml);
   tag.check_name("ColIndex");
 
-  for (Index i = 0; i < nnz; i++) {
-    if (pbifs) {
-      *pbifs >> colind[i];
-      if (pbifs->fail()) {
-        ostringstream os;
-        os << " near "
-           << "\n  Column index: " << i;
-        xml_data_parse_error(tag, os.str());
-      }
-    } else {
+  if (pbifs) {
+    if (nnz) pbifs->readBlock(colind.data(), nnz);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index i = 0; i < nnz; i++) {
       is_xml >> colind[i];
       if (is_xml.fail()) {
         ostringstream os;
@@ -518,16 +509,13 @@ void xml_read_from_stream(istream& is_xml,
   tag.read_from_stream(is_xml);
   tag.check_name("SparseData");
 
-  for (Index i = 0; i < nnz; i++) {
-    if (pbifs) {
-      *pbifs >> data[i];
-      if (pbifs->fail()) {
-        ostringstream os;
-        os << " near "
-           << "\n  Data element: " << i;
-        xml_data_parse_error(tag, os.str());
-      }
-    } else {
+  if (pbifs) {
+    if (nnz) pbifs->readBlock(data.get_c_array(), nnz);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index i = 0; i < nnz; i++) {
       is_xml >> double_imanip() >> data[i];
       if (is_xml.fail()) {
         ostringstream os;
@@ -588,12 +576,11 @@ void xml_write_to_stream(ostream& os_xml,
 
   // Write row indices.
 
-  for (Index i = 0; i < sparse.nnz(); i++) {
-    if (pbofs)
-      //FIXME: It should be the longer lines
-      *pbofs << rowind[i];
-    else
-      os_xml << rowind[i] << '\n';
+  if (pbofs) {
+    //FIXME: It should be the longer lines
+    if (sparse.nnz()) pbofs->writeBlock(rowind.data(), sparse.nnz());
+  } else {
+    for (Index i = 0; i < sparse.nnz(); i++) os_xml << rowind[i] << '\n';
   }
 
   close_tag.set_name("/RowIndex");
@@ -605,12 +592,11 @@ void xml_write_to_stream(ostream& os_xml,
 
   // Write column indices.
 
-  for (Index i = 0; i < sparse.nnz(); i++) {
-    if (pbofs)
-      //FIXME: It should be the longer lines
-      *pbofs << colind[i];
-    else
-      os_xml << colind[i] << '\n';
+  if (pbofs) {
+    //FIXME: It should be the longer lines
+    if (sparse.nnz()) pbofs->writeBlock(colind.data(), sparse.nnz());
+  } else {
+    for (Index i = 0; i < sparse.nnz(); i++) os_xml << colind[i] << '\n';
   }
 
   close_tag.set_name("/ColIndex");
@@ -623,11 +609,10 @@ void xml_write_to_stream(ostream& os_xml,
 
   // Write data.
 
-  for (Index i = 0; i < sparse.nnz(); i++) {
-    if (pbofs)
-      *pbofs << data[i];
-    else
-      os_xml << data[i] << ' ';
+  if (pbofs) {
+    if (sparse.nnz()) pbofs->writeBlock(data.get_c_array(), sparse.nnz());
+  } else {
+    for (Index i = 0; i < sparse.nnz(); i++) os_xml << data[i] << ' ';
   }
   os_xml << '\n';
   close_tag.set_name("/SparseData");
@@ -752,19 +737,16 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(npages, nrows, ncols);
 
-  for (Index p = 0; p < npages; p++) {
-    for (Index r = 0; r < nrows; r++) {
-      for (Index c = 0; c < ncols; c++) {
-        if (pbifs) {
-          *pbifs >> tensor(p, r, c);
-          if (pbifs->fail()) {
-            ostringstream os;
-            os << " near "
-               << "\n  Page  : " << p << "\n  Row   : " << r
-               << "\n  Column: " << c;
-            xml_data_parse_error(tag, os.str());
-          }
-        } else {
+  if (pbifs) {
+    if (!tensor.empty())
+      pbifs->readBlock(tensor.get_c_array(), npages * nrows * ncols);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index p = 0; p < npages; p++) {
+      for (Index r = 0; r < nrows; r++) {
+        for (Index c = 0; c < ncols; c++) {
           is_xml >> double_imanip() >> tensor(p, r, c);
           if (is_xml.fail()) {
             ostringstream os;
@@ -809,19 +791,19 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index p = 0; p < tensor.npages(); ++p) {
-    for (Index r = 0; r < tensor.nrows(); ++r) {
-      if (pbofs)
-        *pbofs << tensor(p, r, 0);
-      else
+  if (pbofs) {
+    if (!tensor.empty())
+      pbofs->writeBlock(tensor.get_c_array(),
+                        tensor.npages() * tensor.nrows() * tensor.ncols());
+  } else {
+    for (Index p = 0; p < tensor.npages(); ++p) {
+      for (Index r = 0; r < tensor.nrows(); ++r) {
         os_xml << tensor(p, r, 0);
-      for (Index c = 1; c < tensor.ncols(); ++c) {
-        if (pbofs)
-          *pbofs << tensor(p, r, c);
-        else
+        for (Index c = 1; c < tensor.ncols(); ++c) {
           os_xml << " " << tensor(p, r, c);
+        }
+        os_xml << '\n';
       }
-      if (!pbofs) os_xml << '\n';
     }
   }
 
@@ -855,20 +837,17 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(nbooks, npages, nrows, ncols);
 
-  for (Index b = 0; b < nbooks; b++) {
-    for (Index p = 0; p < npages; p++) {
-      for (Index r = 0; r < nrows; r++) {
-        for (Index c = 0; c < ncols; c++) {
-          if (pbifs) {
-            *pbifs >> tensor(b, p, r, c);
-            if (pbifs->fail()) {
-              ostringstream os;
-              os << " near "
-                 << "\n  Book  : " << b << "\n  Page  : " << p
-                 << "\n  Row   : " << r << "\n  Column: " << c;
-              xml_data_parse_error(tag, os.str());
-            }
-          } else {
+  if (pbifs) {
+    if (!tensor.empty())
+      pbifs->readBlock(tensor.get_c_array(), nbooks * npages * nrows * ncols);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index b = 0; b < nbooks; b++) {
+      for (Index p = 0; p < npages; p++) {
+        for (Index r = 0; r < nrows; r++) {
+          for (Index c = 0; c < ncols; c++) {
             is_xml >> double_imanip() >> tensor(b, p, r, c);
             if (is_xml.fail()) {
               ostringstream os;
@@ -915,20 +894,21 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index b = 0; b < tensor.nbooks(); ++b) {
-    for (Index p = 0; p < tensor.npages(); ++p) {
-      for (Index r = 0; r < tensor.nrows(); ++r) {
-        if (pbofs)
-          *pbofs << tensor(b, p, r, 0);
-        else
+  if (pbofs) {
+    if (!tensor.empty())
+      pbofs->writeBlock(tensor.get_c_array(),
+                        tensor.nbooks() * tensor.npages() * tensor.nrows() *
+                        tensor.ncols());
+  } else {
+    for (Index b = 0; b < tensor.nbooks(); ++b) {
+      for (Index p = 0; p < tensor.npages(); ++p) {
+        for (Index r = 0; r < tensor.nrows(); ++r) {
           os_xml << tensor(b, p, r, 0);
-        for (Index c = 1; c < tensor.ncols(); ++c) {
-          if (pbofs)
-            *pbofs << tensor(b, p, r, c);
-          else
+          for (Index c = 1; c < tensor.ncols(); ++c) {
             os_xml << " " << tensor(b, p, r, c);
+          }
+          os_xml << '\n';
         }
-        if (!pbofs) os_xml << '\n';
       }
     }
   }
@@ -964,22 +944,19 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(nshelves, nbooks, npages, nrows, ncols);
 
-  for (Index s = 0; s < nshelves; s++) {
-    for (Index b = 0; b < nbooks; b++) {
-      for (Index p = 0; p < npages; p++) {
-        for (Index r = 0; r < nrows; r++) {
-          for (Index c = 0; c < ncols; c++) {
-            if (pbifs) {
-              *pbifs >> tensor(s, b, p, r, c);
-              if (pbifs->fail()) {
-                ostringstream os;
-                os << " near "
-                   << "\n  Shelf : " << s << "\n  Book  : " << b
-                   << "\n  Page  : " << p << "\n  Row   : " << r
-                   << "\n  Column: " << c;
-                xml_data_parse_error(tag, os.str());
-              }
-            } else {
+  if (pbifs) {
+    if (!tensor.empty())
+      pbifs->readBlock(tensor.get_c_array(),
+                       nshelves * nbooks * npages * nrows * ncols);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index s = 0; s < nshelves; s++) {
+      for (Index b = 0; b < nbooks; b++) {
+        for (Index p = 0; p < npages; p++) {
+          for (Index r = 0; r < nrows; r++) {
+            for (Index c = 0; c < ncols; c++) {
               is_xml >> double_imanip() >> tensor(s, b, p, r, c);
               if (is_xml.fail()) {
                 ostringstream os;
@@ -1029,21 +1006,22 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index s = 0; s < tensor.nshelves(); ++s) {
-    for (Index b = 0; b < tensor.nbooks(); ++b) {
-      for (Index p = 0; p < tensor.npages(); ++p) {
-        for (Index r = 0; r < tensor.nrows(); ++r) {
-          if (pbofs)
-            *pbofs << tensor(s, b, p, r, 0);
-          else
+  if (pbofs) {
+    if (!tensor.empty())
+      pbofs->writeBlock(tensor.get_c_array(),
+                        tensor.nshelves() * tensor.nbooks() * tensor.npages() *
+                        tensor.nrows() * tensor.ncols());
+  } else {
+    for (Index s = 0; s < tensor.nshelves(); ++s) {
+      for (Index b = 0; b < tensor.nbooks(); ++b) {
+        for (Index p = 0; p < tensor.npages(); ++p) {
+          for (Index r = 0; r < tensor.nrows(); ++r) {
             os_xml << tensor(s, b, p, r, 0);
-          for (Index c = 1; c < tensor.ncols(); ++c) {
-            if (pbofs)
-              *pbofs << tensor(s, b, p, r, c);
-            else
+            for (Index c = 1; c < tensor.ncols(); ++c) {
               os_xml << " " << tensor(s, b, p, r, c);
+            }
+            os_xml << '\n';
           }
-          if (!pbofs) os_xml << '\n';
         }
       }
     }
@@ -1081,23 +1059,20 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(nvitrines, nshelves, nbooks, npages, nrows, ncols);
 
-  for (Index v = 0; v < nvitrines; v++) {
-    for (Index s = 0; s < nshelves; s++) {
-      for (Index b = 0; b < nbooks; b++) {
-        for (Index p = 0; p < npages; p++) {
-          for (Index r = 0; r < nrows; r++) {
-            for (Index c = 0; c < ncols; c++) {
-              if (pbifs) {
-                *pbifs >> tensor(v, s, b, p, r, c);
-                if (pbifs->fail()) {
-                  ostringstream os;
-                  os << " near "
-                     << "\n  Vitrine: " << v << "\n  Shelf  : " << s
-                     << "\n  Book   : " << b << "\n  Page   : " << p
-                     << "\n  Row    : " << r << "\n  Column : " << c;
-                  xml_data_parse_error(tag, os.str());
-                }
-              } else {
+  if (pbifs) {
+    if (!tensor.empty())
+      pbifs->readBlock(tensor.get_c_array(),
+                       nvitrines * nshelves * nbooks * npages * nrows * ncols);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index v = 0; v < nvitrines; v++) {
+      for (Index s = 0; s < nshelves; s++) {
+        for (Index b = 0; b < nbooks; b++) {
+          for (Index p = 0; p < npages; p++) {
+            for (Index r = 0; r < nrows; r++) {
+              for (Index c = 0; c < ncols; c++) {
                 is_xml >> double_imanip() >> tensor(v, s, b, p, r, c);
                 if (is_xml.fail()) {
                   ostringstream os;
@@ -1149,22 +1124,24 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index v = 0; v < tensor.nvitrines(); ++v) {
-    for (Index s = 0; s < tensor.nshelves(); ++s) {
-      for (Index b = 0; b < tensor.nbooks(); ++b) {
-        for (Index p = 0; p < tensor.npages(); ++p) {
-          for (Index r = 0; r < tensor.nrows(); ++r) {
-            if (pbofs)
-              *pbofs << tensor(v, s, b, p, r, 0);
-            else
+  if (pbofs) {
+    if (!tensor.empty())
+      pbofs->writeBlock(tensor.get_c_array(),
+                        tensor.nvitrines() * tensor.nshelves() *
+                        tensor.nbooks() * tensor.npages() * tensor.nrows() *
+                        tensor.ncols());
+  } else {
+    for (Index v = 0; v < tensor.nvitrines(); ++v) {
+      for (Index s = 0; s < tensor.nshelves(); ++s) {
+        for (Index b = 0; b < tensor.nbooks(); ++b) {
+          for (Index p = 0; p < tensor.npages(); ++p) {
+            for (Index r = 0; r < tensor.nrows(); ++r) {
               os_xml << tensor(v, s, b, p, r, 0);
-            for (Index c = 1; c < tensor.ncols(); ++c) {
-              if (pbofs)
-                *pbofs << tensor(v, s, b, p, r, c);
-              else
+              for (Index c = 1; c < tensor.ncols(); ++c) {
                 os_xml << " " << tensor(v, s, b, p, r, c);
+              }
+              os_xml << '\n';
             }
-            if (!pbofs) os_xml << '\n';
           }
         }
       }
@@ -1204,25 +1181,22 @@ void xml_read_from_stream(istream& is_xml,
   tag.get_attribute_value("ncols", ncols);
   tensor.resize(nlibraries, nvitrines, nshelves, nbooks, npages, nrows, ncols);
 
-  for (Index l = 0; l < nlibraries; l++) {
-    for (Index v = 0; v < nvitrines; v++) {
-      for (Index s = 0; s < nshelves; s++) {
-        for (Index b = 0; b < nbooks; b++) {
-          for (Index p = 0; p < npages; p++) {
-            for (Index r = 0; r < nrows; r++) {
-              for (Index c = 0; c < ncols; c++) {
-                if (pbifs) {
-                  *pbifs >> tensor(l, v, s, b, p, r, c);
-                  if (pbifs->fail()) {
-                    ostringstream os;
-                    os << " near "
-                       << "\n  Library: " << l << "\n  Vitrine: " << v
-                       << "\n  Shelf  : " << s << "\n  Book   : " << b
-                       << "\n  Page   : " << p << "\n  Row    : " << r
-                       << "\n  Column : " << c;
-                    xml_data_parse_error(tag, os.str());
-                  }
-                } else {
+  if (pbifs) {
+    if (!tensor.empty())
+      pbifs->readBlock(tensor.get_c_array(),
+                       nlibraries * nvitrines * nshelves * nbooks * npages *
+                       nrows * ncols);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index l = 0; l < nlibraries; l++) {
+      for (Index v = 0; v < nvitrines; v++) {
+        for (Index s = 0; s < nshelves; s++) {
+          for (Index b = 0; b < nbooks; b++) {
+            for (Index p = 0; p < npages; p++) {
+              for (Index r = 0; r < nrows; r++) {
+                for (Index c = 0; c < ncols; c++) {
                   is_xml >> double_imanip() >> tensor(l, v, s, b, p, r, c);
                   if (is_xml.fail()) {
                     ostringstream os;
@@ -1277,23 +1251,25 @@ void xml_write_to_stream(ostream& os_xml,
   xml_set_stream_precision(os_xml);
 
   // Write the elements:
-  for (Index l = 0; l < tensor.nlibraries(); ++l) {
-    for (Index v = 0; v < tensor.nvitrines(); ++v) {
-      for (Index s = 0; s < tensor.nshelves(); ++s) {
-        for (Index b = 0; b < tensor.nbooks(); ++b) {
-          for (Index p = 0; p < tensor.npages(); ++p) {
-            for (Index r = 0; r < tensor.nrows(); ++r) {
-              if (pbofs)
-                *pbofs << tensor(l, v, s, b, p, r, 0);
-              else
+  if (pbofs) {
+    if (!tensor.empty())
+      pbofs->writeBlock(tensor.get_c_array(),
+                        tensor.nlibraries() * tensor.nvitrines() *
+                        tensor.nshelves() * tensor.nbooks() * tensor.npages() *
+                        tensor.nrows() * tensor.ncols());
+  } else {
+    for (Index l = 0; l < tensor.nlibraries(); ++l) {
+      for (Index v = 0; v < tensor.nvitrines(); ++v) {
+        for (Index s = 0; s < tensor.nshelves(); ++s) {
+          for (Index b = 0; b < tensor.nbooks(); ++b) {
+            for (Index p = 0; p < tensor.npages(); ++p) {
+              for (Index r = 0; r < tensor.nrows(); ++r) {
                 os_xml << tensor(l, v, s, b, p, r, 0);
-              for (Index c = 1; c < tensor.ncols(); ++c) {
-                if (pbofs)
-                  *pbofs << tensor(l, v, s, b, p, r, c);
-                else
+                for (Index c = 1; c < tensor.ncols(); ++c) {
                   os_xml << " " << tensor(l, v, s, b, p, r, c);
+                }
+                os_xml << '\n';
               }
-              if (!pbofs) os_xml << '\n';
             }
           }
         }
@@ -1326,16 +1302,13 @@ void xml_parse_from_stream(istream& is_xml,
   tag.get_attribute_value("nelem", nelem);
   vector.resize(nelem);
 
-  for (Index n = 0; n < nelem; n++) {
-    if (pbifs) {
-      *pbifs >> vector[n];
-      if (pbifs->fail()) {
-        ostringstream os;
-        os << " near "
-           << "\n  Element: " << n;
-        xml_data_parse_error(tag, os.str());
-      }
-    } else {
+  if (pbifs) {
+    if (nelem) pbifs->readBlock(vector.get_c_array(), nelem);
+    if (pbifs->fail()) {
+      xml_data_parse_error(tag, " in binary data block");
+    }
+  } else {
+    for (Index n = 0; n < nelem; n++) {
       is_xml >> double_imanip() >> vector[n];
       if (is_xml.fail()) {
         ostringstream os;
@@ -1397,11 +1370,11 @@ void xml_write_to_stream(ostream& os_xml,
 
   xml_set_stream_precision(os_xml);
 
-  for (Index i = 0; i < n; ++i)
-    if (pbofs)
-      *pbofs << vector[i];
-    else
-      os_xml << vector[i] << '\n';
+  if (pbofs) {
+    if (n) pbofs->writeBlock(vector.get_c_array(), n);
+  } else {
+    for (Index i = 0; i < n; ++i) os_xml << vector[i] << '\n';
+  }
 
   close_tag.set_name("/Vector");
   close_tag.write_to_stream(os_xml);
@@ -370,7 +370,7 @@ void xml_read_from_stream(istream& is_xml,
   xml_read_from_stream(is_xml, gal.t_ref, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.t_pert, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.nls_pert, pbifs, verbosity);
-  xml_read_from_stream(is_xml, gal.xsec, pbifs, verbosity);
+  xml_read_from_stream(is_xml, gal.Xsec(), pbifs, verbosity);
 
   tag.read_from_stream(is_xml);
   tag.check_name("/GasAbsLookup");
@@ -411,8 +411,12 @@ void xml_write_to_stream(ostream& os_xml,
                       pbofs,
                       "NonlinearSpeciesVmrPerturbations",
                       verbosity);
-  xml_write_to_stream(
-      os_xml, gal.xsec, pbofs, "AbsorptionCrossSections", verbosity);
+  Tensor4 mapped_xsec;
+  xml_write_to_stream(os_xml,
+                      gal.XsecForOutput(mapped_xsec),
+                      pbofs,
+                      "AbsorptionCrossSections",
+                      verbosity);
 
   close_tag.set_name("/GasAbsLookup");
   close_tag.write_to_stream(os_xml);